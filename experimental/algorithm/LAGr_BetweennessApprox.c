@@ -0,0 +1,225 @@
+//------------------------------------------------------------------------------
+// LAGr_BetweennessApprox: betweenness centrality by adaptive sampling
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT is required).
+
+// LAGr_BetweennessApprox estimates the betweenness centrality that
+// LAGr_Betweenness computes when all n nodes are used as sources.  Sources
+// are drawn uniformly at random (with replacement), in batches, and the
+// dependencies from each batch are computed by LAGr_Betweenness.  If k
+// sources have been drawn, the estimate is (n/k) times the sum of their
+// dependencies.  With probability at least 1-delta, the result satisfies
+
+//      abs (centrality (i) - exact (i)) <= epsilon * n * (n-1)
+
+// for all nodes i, where exact is the result of LAGr_Betweenness with all
+// nodes as sources.  That is, epsilon bounds the error of the normalized
+// betweenness centrality.
+
+// The dependency of a node i on a single source s, divided by n-1, is a
+// random variable X(i) in the range [0,1], whose variance is at most its
+// mean.  Sampling stops at a sequence of checkpoints, with a doubling number
+// of sources, once an empirical Bernstein bound on the error (for all nodes,
+// using the node with the largest estimate) falls below epsilon, in the style
+// of KADABRA (Borassi and Natale, 2016).  The probability delta is split
+// between the checkpoints (delta/4 for the first, delta/8 for the next, ...)
+// and a Hoeffding bound, which gives the largest number of sources that is
+// ever needed.  If that number is n or more, the exact betweenness centrality
+// is computed instead.
+
+// LAGraph_Random_Init must be called before this method is used.
+
+#define LG_FREE_WORK                                    \
+{                                                       \
+    GrB_free (&Seed) ;                                  \
+    GrB_free (&C) ;                                     \
+    LAGraph_Free ((void **) &X, NULL) ;                 \
+    LAGraph_Free ((void **) &Src, NULL) ;               \
+}
+
+#define LG_FREE_ALL                                     \
+{                                                       \
+    LG_FREE_WORK ;                                      \
+    GrB_free (centrality) ;                             \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// number of sources in each call to LAGr_Betweenness
+#define LG_BCA_BATCH 64
+
+int LAGr_BetweennessApprox
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): estimated betweeness
+                                // centrality of i
+    int64_t *nsamples,          // # of sources used (may be NULL)
+    // input:
+    const LAGraph_Graph G,      // input graph
+    double epsilon,             // maximum error, relative to n*(n-1)
+    double delta,               // probability that the error exceeds epsilon
+    uint64_t seed,              // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector Seed = NULL, C = NULL ;
+    uint64_t *X = NULL ;
+    GrB_Index *Src = NULL ;
+
+    LG_ASSERT (centrality != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (epsilon > 0 && epsilon < 1, GrB_INVALID_VALUE,
+        "epsilon must be in the range (0,1)") ;
+    LG_ASSERT_MSG (delta > 0 && delta < 1, GrB_INVALID_VALUE,
+        "delta must be in the range (0,1)") ;
+    if (!(G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+          G->is_symmetric_structure == LAGraph_TRUE))
+    {
+        LG_ASSERT_MSG (G->AT != NULL, LAGRAPH_NOT_CACHED,
+            "G->AT is required") ;
+    }
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+
+    //--------------------------------------------------------------------------
+    // determine the largest number of sources needed
+    //--------------------------------------------------------------------------
+
+    // With kmax sources, Hoeffding's inequality and a union bound over all n
+    // nodes give an error of at most epsilon with probability 1-delta/2.
+    double kmax_bound = ceil (log (4 * ((double) n) / delta)
+        / (2 * epsilon * epsilon)) ;
+    bool exact = (n <= 2 || kmax_bound >= (double) n) ;
+    int64_t kmax = exact ? ((int64_t) n) : ((int64_t) kmax_bound) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace and the result
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Vector_new (centrality, GrB_FP64, n)) ;
+    GRB_TRY (GrB_assign (*centrality, NULL, NULL, (double) 0, GrB_ALL, n,
+        NULL)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Src, LG_BCA_BATCH, sizeof (GrB_Index),
+        msg)) ;
+    if (!exact)
+    {
+        // Seed: a dense vector of LG_BCA_BATCH random numbers
+        LG_TRY (LAGraph_Malloc ((void **) &X, LG_BCA_BATCH, sizeof (uint64_t),
+            msg)) ;
+        GRB_TRY (GrB_Vector_new (&Seed, GrB_UINT64, LG_BCA_BATCH)) ;
+        GRB_TRY (GrB_assign (Seed, NULL, NULL, (uint64_t) 0, GrB_ALL,
+            LG_BCA_BATCH, NULL)) ;
+        LG_TRY (LAGraph_Random_Seed (Seed, seed, msg)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sample the sources, checking the error bound at each checkpoint
+    //--------------------------------------------------------------------------
+
+    int64_t k = 0 ;
+    int64_t target = kmax ;
+    if (!exact)
+    {
+        // the bound cannot be met with fewer than L/epsilon sources
+        double L = log (2 * ((double) n) / delta) + 2 * log (2.0) ;
+        target = LAGRAPH_MIN (kmax, (int64_t) ceil (L / epsilon)) ;
+    }
+
+    for (int check = 1 ; ; check++)
+    {
+
+        //----------------------------------------------------------------------
+        // add sources until there are target of them
+        //----------------------------------------------------------------------
+
+        while (k < target)
+        {
+            int64_t m = LAGRAPH_MIN (LG_BCA_BATCH, target - k) ;
+            if (exact)
+            {
+                // the sources are the nodes k:k+m-1
+                for (int64_t i = 0 ; i < m ; i++)
+                {
+                    Src [i] = k + i ;
+                }
+            }
+            else
+            {
+                // draw m sources at random, using the high bits of each seed
+                GrB_Index nx = LG_BCA_BATCH ;
+                GRB_TRY (GrB_Vector_extractTuples (NULL, X, &nx, Seed)) ;
+                for (int64_t i = 0 ; i < m ; i++)
+                {
+                    Src [i] = (X [i] >> 16) % n ;
+                }
+                LG_TRY (LAGraph_Random_Next (Seed, msg)) ;
+            }
+            // centrality += dependencies on the sources Src [0..m-1]
+            LG_TRY (LAGr_Betweenness (&C, G, Src, (int32_t) m, msg)) ;
+            GRB_TRY (GrB_assign (*centrality, NULL, GrB_PLUS_FP64, C,
+                GrB_ALL, n, NULL)) ;
+            GRB_TRY (GrB_free (&C)) ;
+            k += m ;
+        }
+
+        if (k >= kmax) break ;
+
+        //----------------------------------------------------------------------
+        // check the empirical Bernstein bound
+        //----------------------------------------------------------------------
+
+        // This checkpoint fails with probability delta_c = delta/2^(c+1).
+        // With L = log (2n/delta_c), the error for node i is at most
+        // sqrt (2*mu(i)*L/k) + L/(3k), where mu(i) is the exact mean of X(i).
+        // mu(i) is unknown, but it is at most the largest x*x for which
+        // x*x - sqrt(2*L/k)*x - (mean(i) + L/(3k)) <= 0, where mean(i) is the
+        // sample mean.  The bound is largest for the largest mean(i).
+        double L = log (2 * ((double) n) / delta) + (check + 1) * log (2.0) ;
+        double smax = 0 ;
+        GRB_TRY (GrB_reduce (&smax, NULL, GrB_MAX_MONOID_FP64, *centrality,
+            NULL)) ;
+        double mean = LAGRAPH_MAX (smax, 0) / (((double) k) * (n-1)) ;
+        double a = sqrt (2 * L / k) ;
+        double x = (a + sqrt (a*a + 4 * (mean + L / (3*k)))) / 2 ;
+        double err = a * x + L / (3*k) ;
+        if (err <= epsilon) break ;
+
+        // double the number of sources for the next checkpoint
+        target = LAGRAPH_MIN (kmax, 2 * k) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // scale the result and free workspace
+    //--------------------------------------------------------------------------
+
+    if (!exact)
+    {
+        // centrality *= n/k
+        GRB_TRY (GrB_apply (*centrality, NULL, NULL, GrB_TIMES_FP64,
+            *centrality, ((double) n) / ((double) k), NULL)) ;
+    }
+    if (nsamples != NULL) (*nsamples) = k ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
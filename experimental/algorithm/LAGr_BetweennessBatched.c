@@ -0,0 +1,221 @@
+//------------------------------------------------------------------------------
+// LAGr_BetweennessBatched: betweenness centrality in memory-bounded batches
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT is required).
+
+// LAGr_BetweennessBatched computes the same betweenness centrality as
+// LAGr_Betweenness, but it splits the sources into batches so that the memory
+// used stays within a given budget.  If sources is NULL, all n nodes are used
+// as sources, which gives the exact betweenness centrality.
+
+// For a batch of b sources, LAGr_Betweenness holds the b-by-n matrices paths
+// and bc_update (both dense), the frontier and W workspace (up to b-by-n),
+// and the matrices S [0..depth-1].  Each node appears in just one S [i] for
+// each source, so all of the S [i] together hold at most b*n entries, plus a
+// row pointer array for each level.  The memory is thus bounded by about
+// LG_BC_BYTES*b*n bytes.  The largest b that fits in the budget is used, and
+// the results of the batches are summed.
+
+// If nthreads_outer > 1 (see LAGraph_SetNumThreads), up to nthreads_outer
+// batches are computed at the same time, each with nthreads_inner threads,
+// and the budget is split evenly among them.  If the budget is too small for
+// that, fewer batches are done at a time.  The batch results are summed in
+// the same order regardless of the number of threads.
+
+#define LG_FREE_WORK                                    \
+{                                                       \
+    if (C != NULL)                                      \
+    {                                                   \
+        for (int t = 0 ; t < nouter ; t++)              \
+        {                                               \
+            GrB_free (&(C [t])) ;                       \
+        }                                               \
+    }                                                   \
+    LAGraph_Free ((void **) &C, NULL) ;                 \
+    LAGraph_Free ((void **) &status, NULL) ;            \
+    LAGraph_Free ((void **) &tmsg, NULL) ;              \
+    LAGraph_Free ((void **) &Src, NULL) ;               \
+}
+
+#define LG_FREE_ALL                                     \
+{                                                       \
+    LG_FREE_WORK ;                                      \
+    GrB_free (centrality) ;                             \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// upper bound on the bytes used by LAGr_Betweenness, per source and per node
+#define LG_BC_BYTES 64
+
+int LAGr_BetweennessBatched
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): betweeness centrality of i
+    int64_t *batch_size,        // # of sources in each batch (may be NULL)
+    // input:
+    const LAGraph_Graph G,      // input graph
+    const GrB_Index *sources,   // source vertices, or NULL for all nodes
+    int64_t ns,                 // number of source vertices (ignored if
+                                // sources is NULL)
+    size_t memory_budget,       // maximum memory to use, in bytes
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector *C = NULL ;
+    int *status = NULL ;
+    char *tmsg = NULL ;
+    GrB_Index *Src = NULL ;
+    int nouter = 0 ;
+
+    LG_ASSERT (centrality != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Matrix AT = NULL ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE)
+    {
+        // A and A' have the same structure
+        AT = G->A ;
+    }
+    else
+    {
+        // A and A' differ
+        AT = G->AT ;
+        LG_ASSERT_MSG (AT != NULL, LAGRAPH_NOT_CACHED, "G->AT is required") ;
+    }
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    if (sources == NULL)
+    {
+        // use all nodes as sources
+        ns = n ;
+    }
+    LG_ASSERT_MSG (ns >= 0, GrB_INVALID_VALUE, "ns must be >= 0") ;
+
+    //--------------------------------------------------------------------------
+    // determine the batch size
+    //--------------------------------------------------------------------------
+
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+
+    // each source in a batch takes LG_BC_BYTES*n bytes, plus its index if the
+    // sources are generated here
+    double per_source = ((double) LG_BC_BYTES) * n +
+        ((sources == NULL) ? sizeof (GrB_Index) : 0) ;
+    int64_t b = 0 ;
+    for (nouter = LAGRAPH_MAX (nthreads_outer, 1) ; nouter >= 1 ; nouter--)
+    {
+        // the result, plus one result vector for each batch done at once
+        double fixed = ((double) (nouter + 1)) * n * sizeof (double) ;
+        double avail = (((double) memory_budget) - fixed) / nouter ;
+        b = (avail > 0) ? ((int64_t) (avail / per_source)) : 0 ;
+        if (b >= 1) break ;
+    }
+    LG_ASSERT_MSG (b >= 1, GrB_INVALID_VALUE,
+        "memory budget is too small for a single source") ;
+    b = LAGRAPH_MIN (b, LAGRAPH_MAX (ns, 1)) ;
+    b = LAGRAPH_MIN (b, INT32_MAX) ;
+    if (batch_size != NULL) (*batch_size) = b ;
+    int64_t nbatches = (ns + b - 1) / b ;
+    nouter = (int) LAGRAPH_MIN (nouter, LAGRAPH_MAX (nbatches, 1)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace and the result
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Calloc ((void **) &C, nouter, sizeof (GrB_Vector), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &status, nouter, sizeof (int), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &tmsg, nouter * LAGRAPH_MSG_LEN,
+        sizeof (char), msg)) ;
+    if (sources == NULL)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &Src, nouter * b,
+            sizeof (GrB_Index), msg)) ;
+    }
+
+    GRB_TRY (GrB_Vector_new (centrality, GrB_FP64, n)) ;
+    GRB_TRY (GrB_assign (*centrality, NULL, NULL, (double) 0, GrB_ALL, n,
+        NULL)) ;
+
+    // finish any pending work on G->A and G->AT, so that the batches can
+    // safely read them at the same time
+    GRB_TRY (GrB_wait (G->A, GrB_MATERIALIZE)) ;
+    GRB_TRY (GrB_wait (AT, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // compute the batches, nouter at a time
+    //--------------------------------------------------------------------------
+
+    for (int64_t first = 0 ; first < nbatches ; first += nouter)
+    {
+        int nround = (int) LAGRAPH_MIN (nouter, nbatches - first) ;
+
+        int t ;
+        #pragma omp parallel for num_threads(nround) schedule(static,1)
+        for (t = 0 ; t < nround ; t++)
+        {
+            int64_t s1 = (first + t) * b ;
+            int64_t s2 = LAGRAPH_MIN (s1 + b, ns) ;
+            const GrB_Index *batch ;
+            if (sources == NULL)
+            {
+                // this batch uses the nodes s1:s2-1 as its sources
+                GrB_Index *my_sources = Src + t * b ;
+                for (int64_t k = s1 ; k < s2 ; k++)
+                {
+                    my_sources [k - s1] = k ;
+                }
+                batch = my_sources ;
+            }
+            else
+            {
+                batch = sources + s1 ;
+            }
+            status [t] = LAGr_Betweenness (&(C [t]), G, batch,
+                (int32_t) (s2 - s1), tmsg + t * LAGRAPH_MSG_LEN) ;
+        }
+
+        // sum the results of this round, in order
+        for (t = 0 ; t < nround ; t++)
+        {
+            if (status [t] < GrB_SUCCESS && msg != NULL)
+            {
+                strncpy (msg, tmsg + t * LAGRAPH_MSG_LEN, LAGRAPH_MSG_LEN-1) ;
+            }
+            LG_TRY (status [t]) ;
+            GRB_TRY (GrB_assign (*centrality, NULL, GrB_PLUS_FP64, C [t],
+                GrB_ALL, n, NULL)) ;
+            GRB_TRY (GrB_free (&(C [t]))) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
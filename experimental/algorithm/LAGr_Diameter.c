@@ -0,0 +1,382 @@
+//------------------------------------------------------------------------------
+// LAGr_Diameter: exact diameter, radius, and eccentricity bounds
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGr_Diameter computes the exact diameter of an undirected graph, and
+// optionally its radius, without a BFS from every node.  It is the
+// bound-tightening method of Takes and Kosters ("Determining the diameter of
+// small world networks", CIKM 2011), which generalizes the double-sweep and
+// iFUB lower bounds.
+
+// This is an Advanced algorithm (G->is_symmetric_structure is required if G
+// is directed; G->out_degree is used if present but not required, and if not
+// present, the degrees are computed here but not cached in G).
+
+// The eccentricity ecc(v) of a node v is the largest distance from v to any
+// node reachable from v.  The diameter is the largest eccentricity, and the
+// radius is the smallest.  If the graph is disconnected, eccentricities are
+// taken within each connected component.
+
+// Each node v keeps a lower bound ecc_lower(v) and an upper bound
+// ecc_upper(v).  A BFS from a source s with eccentricity ecc(s) tightens the
+// bounds of every node v reached from s:
+//
+//      ecc_lower(v) = max (ecc_lower(v), d(s,v), ecc(s) - d(s,v))
+//      ecc_upper(v) = min (ecc_upper(v), ecc(s) + d(s,v))
+//
+// A node stays a candidate only while it can still raise the diameter
+// (ecc_upper(v) > largest ecc_lower) or, if the radius is requested, lower
+// the radius (ecc_lower(v) < smallest ecc_upper).  When no candidates
+// remain, both values are exact.
+
+// Sources are chosen from the candidates by alternating between the node
+// with the largest upper bound and the node with the smallest lower bound,
+// with ties broken by larger degree and then by smaller node id.  The first
+// two rounds use a single source each: a BFS from the highest-degree node,
+// then one from the node farthest from it.  This is the classical double
+// sweep.  Each subsequent round takes up to batch_size candidates and runs
+// their BFS traversals all at once, as a multi-source BFS that advances a
+// batch_size-by-n frontier with GrB_mxm.
+
+// The values of G->A are ignored; just its structure is used.  Self-edges
+// are OK.
+
+// ecc_lower and ecc_upper are returned as full GrB_INT64 vectors of size n.
+// Each of radius, ecc_lower, ecc_upper, and nbfs may be NULL, in which case
+// it is not returned.  If radius is NULL, fewer BFS traversals are typically
+// needed since only the diameter must be made exact.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                                            \
+{                                                               \
+    GrB_free (&frontier) ;                                      \
+    GrB_free (&D) ;                                             \
+    GrB_free (&E) ;                                             \
+    GrB_free (&T) ;                                             \
+    GrB_free (&ecc) ;                                           \
+    GrB_free (&Lo) ;                                            \
+    GrB_free (&Hi) ;                                            \
+    LAGraph_Free ((void **) &Lo_x, NULL) ;                      \
+    LAGraph_Free ((void **) &Hi_x, NULL) ;                      \
+    LAGraph_Free ((void **) &Deg, NULL) ;                       \
+    LAGraph_Free ((void **) &I, NULL) ;                         \
+    LAGraph_Free ((void **) &X, NULL) ;                         \
+    LAGraph_Free ((void **) &K0, NULL) ;                        \
+    LAGraph_Free ((void **) &K1, NULL) ;                        \
+    LAGraph_Free ((void **) &K2, NULL) ;                        \
+    LAGraph_Free ((void **) &K3, NULL) ;                        \
+    LAGraph_Free ((void **) &K4, NULL) ;                        \
+    LAGraph_Free ((void **) &K5, NULL) ;                        \
+    LAGraph_Free ((void **) &active, NULL) ;                    \
+    LAGraph_Free ((void **) &picked, NULL) ;                    \
+    LAGraph_Free ((void **) &sources, NULL) ;                   \
+}
+
+#define LG_FREE_ALL                                             \
+{                                                               \
+    LG_FREE_WORK ;                                              \
+    if (ecc_lower != NULL) GrB_free (ecc_lower) ;               \
+    if (ecc_upper != NULL) GrB_free (ecc_upper) ;               \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// LG_get_vector: extract an int64 vector into a dense array
+//------------------------------------------------------------------------------
+
+static int LG_get_vector
+(
+    int64_t *x,         // size n, x (i) = v (i) if present, or xdefault
+    GrB_Vector v,
+    int64_t xdefault,
+    GrB_Index n,
+    GrB_Index *I,       // workspace of size n
+    int64_t *X          // workspace of size n
+)
+{
+    GrB_Index nvals = n ;
+    int info = GrB_Vector_extractTuples_INT64 (I, X, &nvals, v) ;
+    if (info < 0) return (info) ;
+    int64_t i ;
+    #pragma omp parallel for schedule(static)
+    for (i = 0 ; i < (int64_t) n ; i++)
+    {
+        x [i] = xdefault ;
+    }
+    #pragma omp parallel for schedule(static)
+    for (i = 0 ; i < (int64_t) nvals ; i++)
+    {
+        x [I [i]] = X [i] ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_Diameter
+//------------------------------------------------------------------------------
+
+int LAGr_Diameter
+(
+    // output:
+    int64_t *diameter,      // exact diameter of G
+    int64_t *radius,        // exact radius of G; not computed if NULL
+    GrB_Vector *ecc_lower,  // lower bounds on the eccentricities; may be NULL
+    GrB_Vector *ecc_upper,  // upper bounds on the eccentricities; may be NULL
+    int64_t *nbfs,          // # of BFS traversals performed; may be NULL
+    // input:
+    const LAGraph_Graph G,  // input graph
+    int64_t batch_size,     // max # of BFS traversals done together
+                            // (32 is used if batch_size <= 0)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix frontier = NULL, D = NULL, E = NULL, T = NULL ;
+    GrB_Vector ecc = NULL, Lo = NULL, Hi = NULL ;
+    int64_t *Lo_x = NULL, *Hi_x = NULL, *Deg = NULL, *X = NULL ;
+    int64_t *K0 = NULL, *K1 = NULL, *K2 = NULL ;
+    int64_t *K3 = NULL, *K4 = NULL, *K5 = NULL ;
+    GrB_Index *I = NULL, *sources = NULL ;
+    bool *active = NULL, *picked = NULL ;
+
+    if (ecc_lower != NULL) (*ecc_lower) = NULL ;
+    if (ecc_upper != NULL) (*ecc_upper) = NULL ;
+    LG_ASSERT (diameter != NULL, GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    LG_ASSERT_MSG ((G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+         G->is_symmetric_structure == LAGraph_TRUE)),
+        LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED,
+        "G->A must be known to be symmetric") ;
+
+    if (batch_size <= 0) batch_size = 32 ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    batch_size = LAGRAPH_MIN (batch_size, (int64_t) n) ;
+
+    LG_TRY (LAGraph_Malloc ((void **) &Lo_x, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Hi_x, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Deg , n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &X   , n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &K0  , n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &K1  , n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &K2  , n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &K3  , n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &K4  , n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &K5  , n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &I   , n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &active, n, sizeof (bool), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &picked, n, sizeof (bool), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &sources, batch_size,
+        sizeof (GrB_Index), msg)) ;
+
+    // Lo = 0, as a full vector
+    GRB_TRY (GrB_Vector_new (&Lo, GrB_INT64, n)) ;
+    GRB_TRY (GrB_Vector_new (&Hi, GrB_INT64, n)) ;
+    GRB_TRY (GrB_assign (Lo, NULL, NULL, (int64_t) 0, GrB_ALL, n, NULL)) ;
+
+    // Deg (i) = out-degree of node i, used to pick the first source and to
+    // break ties
+    if (G->out_degree != NULL)
+    {
+        GRB_TRY (LG_get_vector (Deg, G->out_degree, 0, n, I, X)) ;
+    }
+    else
+    {
+        // Hi = A*Lo with the plus_one semiring, as in LAGraph_Cached_OutDegree
+        GRB_TRY (GrB_mxv (Hi, NULL, NULL, LAGraph_plus_one_int64, A, Lo,
+            NULL)) ;
+        GRB_TRY (LG_get_vector (Deg, Hi, 0, n, I, X)) ;
+    }
+
+    // Hi = n, as a full vector
+    GRB_TRY (GrB_assign (Hi, NULL, NULL, (int64_t) n, GrB_ALL, n, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // tighten the bounds until no candidates remain
+    //--------------------------------------------------------------------------
+
+    int64_t diam_lo = 0, rad_hi = n, nsources_total = 0 ;
+    int64_t i ;
+    #pragma omp parallel for schedule(static)
+    for (i = 0 ; i < (int64_t) n ; i++)
+    {
+        active [i] = true ;
+    }
+
+    for (int64_t round = 0 ; ; round++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the current bounds and prune the candidates
+        //----------------------------------------------------------------------
+
+        GRB_TRY (LG_get_vector (Lo_x, Lo, 0, n, I, X)) ;
+        GRB_TRY (LG_get_vector (Hi_x, Hi, n, n, I, X)) ;
+        GRB_TRY (GrB_reduce (&diam_lo, NULL, GrB_MAX_MONOID_INT64, Lo, NULL)) ;
+        GRB_TRY (GrB_reduce (&rad_hi,  NULL, GrB_MIN_MONOID_INT64, Hi, NULL)) ;
+
+        int64_t ncand = 0 ;
+        for (i = 0 ; i < (int64_t) n ; i++)
+        {
+            if (!active [i]) continue ;
+            bool keep = (Hi_x [i] > diam_lo) ||
+                (radius != NULL && Lo_x [i] < rad_hi) ;
+            active [i] = keep ;
+            if (keep)
+            {
+                // sort key for the largest upper bound
+                K0 [ncand] = -Hi_x [i] ;
+                K1 [ncand] = -Deg [i] ;
+                K2 [ncand] = i ;
+                // sort key for the smallest lower bound
+                K3 [ncand] = Lo_x [i] ;
+                K4 [ncand] = -Deg [i] ;
+                K5 [ncand] = i ;
+                ncand++ ;
+            }
+        }
+        if (ncand == 0) break ;
+
+        //----------------------------------------------------------------------
+        // select the next batch of sources
+        //----------------------------------------------------------------------
+
+        int64_t ns = (round < 2) ? 1 : LAGRAPH_MIN (batch_size, ncand) ;
+        LG_TRY (LG_msort3 (K0, K1, K2, ncand, msg)) ;
+        if (ns > 1)
+        {
+            LG_TRY (LG_msort3 (K3, K4, K5, ncand, msg)) ;
+        }
+        int64_t p_hi = 0, p_lo = 0 ;
+        for (int64_t k = 0 ; k < ns ; k++)
+        {
+            int64_t s = -1 ;
+            if (k % 2 == 0)
+            {
+                // take the candidate with the largest upper bound
+                while (p_hi < ncand && picked [K2 [p_hi]]) p_hi++ ;
+                if (p_hi < ncand) s = K2 [p_hi] ;
+            }
+            if (s < 0)
+            {
+                // take the candidate with the smallest lower bound
+                while (p_lo < ncand && picked [K5 [p_lo]]) p_lo++ ;
+                if (p_lo < ncand) s = K5 [p_lo] ;
+            }
+            picked [s] = true ;
+            sources [k] = s ;
+        }
+        for (int64_t k = 0 ; k < ns ; k++)
+        {
+            picked [sources [k]] = false ;
+        }
+        nsources_total += ns ;
+
+        //----------------------------------------------------------------------
+        // multi-source BFS: D (k,:) = distances from sources [k]
+        //----------------------------------------------------------------------
+
+        GRB_TRY (GrB_Matrix_new (&frontier, GrB_BOOL, ns, n)) ;
+        GRB_TRY (GrB_Matrix_new (&D, GrB_INT64, ns, n)) ;
+        for (int64_t k = 0 ; k < ns ; k++)
+        {
+            GRB_TRY (GrB_Matrix_setElement (frontier, true, k, sources [k])) ;
+            GRB_TRY (GrB_Matrix_setElement (D, (int64_t) 0, k, sources [k])) ;
+        }
+
+        for (int64_t depth = 1 ; depth < (int64_t) n ; depth++)
+        {
+            // frontier<!D> = frontier*A
+            GRB_TRY (GrB_mxm (frontier, D, NULL, LAGraph_any_one_bool,
+                frontier, A, GrB_DESC_RSC)) ;
+            GrB_Index nvals ;
+            GRB_TRY (GrB_Matrix_nvals (&nvals, frontier)) ;
+            if (nvals == 0) break ;
+            // D<frontier> = depth
+            GRB_TRY (GrB_assign (D, frontier, NULL, depth, GrB_ALL, ns,
+                GrB_ALL, n, GrB_DESC_S)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // tighten the bounds of all nodes reached
+        //----------------------------------------------------------------------
+
+        // ecc (k) = max (D (k,:)), the eccentricity of each source
+        GRB_TRY (GrB_Vector_new (&ecc, GrB_INT64, ns)) ;
+        GRB_TRY (GrB_reduce (ecc, NULL, NULL, GrB_MAX_MONOID_INT64, D, NULL)) ;
+
+        // E<D> = ecc (k) in each row k
+        GRB_TRY (GrB_Matrix_diag (&E, ecc, 0)) ;
+        GRB_TRY (GrB_Matrix_new (&T, GrB_INT64, ns, n)) ;
+        GRB_TRY (GrB_mxm (T, NULL, NULL, GrB_MIN_FIRST_SEMIRING_INT64, E, D,
+            NULL)) ;
+        GrB_free (&E) ;
+        E = T ;
+        T = NULL ;
+
+        // Lo = max (Lo, max (D (k,:), E (k,:) - D (k,:)) over all k)
+        GRB_TRY (GrB_Matrix_new (&T, GrB_INT64, ns, n)) ;
+        GRB_TRY (GrB_eWiseMult (T, NULL, NULL, GrB_MINUS_INT64, E, D, NULL)) ;
+        GRB_TRY (GrB_eWiseMult (T, NULL, NULL, GrB_MAX_INT64, T, D, NULL)) ;
+        GRB_TRY (GrB_reduce (Lo, NULL, GrB_MAX_INT64, GrB_MAX_MONOID_INT64, T,
+            GrB_DESC_T0)) ;
+
+        // Hi = min (Hi, min (E (k,:) + D (k,:)) over all k)
+        GRB_TRY (GrB_eWiseMult (T, NULL, NULL, GrB_PLUS_INT64, E, D, NULL)) ;
+        GRB_TRY (GrB_reduce (Hi, NULL, GrB_MIN_INT64, GrB_MIN_MONOID_INT64, T,
+            GrB_DESC_T0)) ;
+
+        GrB_free (&frontier) ;
+        GrB_free (&D) ;
+        GrB_free (&E) ;
+        GrB_free (&T) ;
+        GrB_free (&ecc) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*diameter) = diam_lo ;
+    if (radius != NULL) (*radius) = rad_hi ;
+    if (nbfs != NULL) (*nbfs) = nsources_total ;
+    if (ecc_lower != NULL)
+    {
+        (*ecc_lower) = Lo ;
+        Lo = NULL ;
+    }
+    if (ecc_upper != NULL)
+    {
+        (*ecc_upper) = Hi ;
+        Hi = NULL ;
+    }
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,313 @@
+//------------------------------------------------------------------------------
+// LAGr_KCliqueCount: count (and optionally list) the k-cliques of a graph
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->nself_edges, G->out_degree,
+// G->is_symmetric_structure are required).
+
+// LAGr_KCliqueCount counts the k-cliques of an undirected graph (sets of k
+// nodes that are all pairwise connected), for any k >= 2.  With k = 3, this
+// is the number of triangles.  The total count, the number of k-cliques that
+// contain each node, or both, can be returned.  If a callback is given, it is
+// called once for each k-clique, so the cliques can be listed without being
+// stored.
+
+// The nodes are ordered by ascending degree (with LAGr_SortByDegree), and each
+// edge is oriented from the node that comes first in this order to the other
+// one (see LG_OrientByDegree).  This gives a directed acyclic graph D in which
+// each k-clique appears exactly once, as a node u followed by a (k-1)-clique
+// of its out-neighbors.
+// Ordering by degree bounds the out-degree of the hub nodes, which keeps the
+// candidate sets small (Chiba and Nishizeki, "Arboricity and subgraph listing
+// algorithms", SIAM J. Computing 1985; Danisch, Balalau, Sozio, "Listing
+// k-cliques in sparse real-world graphs", WWW 2018).
+
+// For each node u, the candidates C are the out-neighbors of u.  Each node v
+// in C is added to the clique in turn, and the candidates for the next level
+// are the intersection of C with the out-neighbors of v.  At the last level,
+// each remaining candidate completes a k-clique.  The nodes u are shared
+// cyclically among the threads, each of which has its own workspace.  If the
+// count vector is requested, each thread also has its own Count array of size
+// n, and these are summed when all threads are done, so no atomics are
+// needed.
+
+// The callback, if not NULL, is called with an array of the k nodes of the
+// clique (in the original node numbering of G), k itself, and the user
+// callback_arg.  It may be called concurrently from several threads, so it
+// must be thread-safe.
+
+#define LG_FREE_WORK                                                        \
+{                                                                           \
+    LAGraph_Free ((void **) &P, NULL) ;                                     \
+    LAGraph_Free ((void **) &Dp, NULL) ;                                    \
+    LAGraph_Free ((void **) &Dj, NULL) ;                                    \
+    LAGraph_Free ((void **) &Count, NULL) ;                                 \
+    LAGraph_Free ((void **) &Work, NULL) ;                                  \
+}
+
+#define LG_FREE_ALL                                                         \
+{                                                                           \
+    LG_FREE_WORK ;                                                          \
+    if (count != NULL) GrB_free (count) ;                                   \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// LG_kclique_work: workspace for one thread
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    int k ;                         // size of the cliques
+    const int64_t *Dp ;             // out-neighbors of node r in the DAG are
+    const int64_t *Dj ;             // Dj [Dp [r] ... Dp [r+1]-1], sorted
+    const int64_t *P ;              // node P [r] of G is node r of the DAG
+    uint64_t *Count ;               // Count [r]: # cliques containing r found
+                                    // by this thread, or NULL if not computed
+    LAGr_KCliqueCallback callback ; // callback, or NULL
+    void *callback_arg ;
+    int64_t *clique ;               // current clique, of size k
+    int64_t *nodes ;                // clique in the nodes of G, of size k
+    int64_t *Cand ;                 // candidates: Cand + level*dmax
+    int64_t dmax ;                  // max out-degree in the DAG
+}
+LG_kclique_work ;
+
+//------------------------------------------------------------------------------
+// LG_kclique_recurse: count the cliques that extend the current clique
+//------------------------------------------------------------------------------
+
+// The first level nodes of the clique are in W->clique [0:level-1], and the
+// nc candidates for the remaining k-level nodes are in C, in ascending order.
+// Returns the number of k-cliques found.
+
+static uint64_t LG_kclique_recurse
+(
+    LG_kclique_work *W,
+    int level,
+    const int64_t *C,
+    int64_t nc
+)
+{
+    const int k = W->k ;
+
+    if (level == k-1)
+    {
+
+        //----------------------------------------------------------------------
+        // each candidate completes a k-clique
+        //----------------------------------------------------------------------
+
+        if (W->Count != NULL)
+        {
+            for (int t = 0 ; t < level ; t++)
+            {
+                W->Count [W->clique [t]] += nc ;
+            }
+            for (int64_t i = 0 ; i < nc ; i++)
+            {
+                W->Count [C [i]] ++ ;
+            }
+        }
+        if (W->callback != NULL)
+        {
+            for (int t = 0 ; t < level ; t++)
+            {
+                W->nodes [t] = W->P [W->clique [t]] ;
+            }
+            for (int64_t i = 0 ; i < nc ; i++)
+            {
+                W->nodes [level] = W->P [C [i]] ;
+                W->callback (W->nodes, k, W->callback_arg) ;
+            }
+        }
+        return ((uint64_t) nc) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // add each candidate v to the clique, and recurse
+    //--------------------------------------------------------------------------
+
+    uint64_t ncliques = 0 ;
+    const int64_t *Dp = W->Dp ;
+    const int64_t *Dj = W->Dj ;
+    int64_t *C2 = W->Cand + (level+1) * W->dmax ;
+    const int64_t need = k - level - 1 ;   // # of nodes needed after v
+
+    for (int64_t i = 0 ; i + need < nc ; i++)
+    {
+        const int64_t v = C [i] ;
+        const int64_t pv_start = Dp [v] ;
+        const int64_t pv_end = Dp [v+1] ;
+        if (pv_end - pv_start < need) continue ;
+
+        // C2 = C (i+1:nc-1) intersected with the out-neighbors of v
+        int64_t n2 = 0 ;
+        int64_t pa = i+1, pb = pv_start ;
+        while (pa < nc && pb < pv_end)
+        {
+            const int64_t ia = C [pa] ;
+            const int64_t ib = Dj [pb] ;
+            C2 [n2] = ia ;
+            n2 += (ia == ib) ;
+            pa += (ia <= ib) ;
+            pb += (ib <= ia) ;
+        }
+
+        if (n2 >= need)
+        {
+            W->clique [level] = v ;
+            ncliques += LG_kclique_recurse (W, level+1, C2, n2) ;
+        }
+    }
+    return (ncliques) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_KCliqueCount
+//------------------------------------------------------------------------------
+
+int LAGr_KCliqueCount
+(
+    // output:
+    uint64_t *ncliques,     // total number of k-cliques (may be NULL)
+    GrB_Vector *count,      // count(i): # of k-cliques containing node i
+                            // (may be NULL)
+    // input:
+    const LAGraph_Graph G,
+    int k,                  // size of the cliques, k >= 2
+    LAGr_KCliqueCallback callback,  // called for each k-clique (may be NULL)
+    void *callback_arg,     // passed to the callback
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    int64_t *P = NULL, *Dp = NULL, *Dj = NULL, *Work = NULL ;
+    uint64_t *Count = NULL ;
+
+    if (count != NULL) (*count) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (G->nself_edges == 0, LAGRAPH_NO_SELF_EDGES_ALLOWED) ;
+    LG_ASSERT_MSG ((G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE)),
+        LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED,
+        "G->A must be known to be symmetric") ;
+    LG_ASSERT_MSG (G->out_degree != NULL, LAGRAPH_NOT_CACHED,
+        "G->out_degree is required") ;
+    LG_ASSERT_MSG (k >= 2, GrB_INVALID_VALUE, "k must be 2 or more") ;
+
+    //--------------------------------------------------------------------------
+    // orient the edges of G by ascending degree
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    int64_t dmax ;
+    LG_TRY (LG_OrientByDegree (&Dp, &Dj, &P, &dmax, G, msg)) ;
+    int64_t nvals = Dp [n] ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = LAGRAPH_MAX (nthreads_outer * nthreads_inner, 1) ;
+    nthreads = (int) LAGRAPH_MIN (nthreads, 1 + nvals / 4096) ;
+    dmax = LAGRAPH_MAX (dmax, 1) ;
+
+    // each thread has a clique and its nodes (2*k), and k levels of
+    // candidates (k*dmax)
+    size_t wsize = 2 * k + ((size_t) k) * dmax ;
+    LG_TRY (LAGraph_Malloc ((void **) &Work, nthreads * wsize,
+        sizeof (int64_t), msg)) ;
+    if (count != NULL)
+    {
+        // each thread has its own Count array
+        LG_TRY (LAGraph_Calloc ((void **) &Count, ((size_t) nthreads) * n,
+            sizeof (uint64_t), msg)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the k-cliques
+    //--------------------------------------------------------------------------
+
+    uint64_t total = 0 ;
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+        reduction(+:total)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t *work = Work + tid * wsize ;
+        LG_kclique_work W ;
+        W.k = k ;
+        W.Dp = Dp ;
+        W.Dj = Dj ;
+        W.P = P ;
+        W.Count = (Count == NULL) ? NULL : (Count + ((size_t) tid) * n) ;
+        W.callback = callback ;
+        W.callback_arg = callback_arg ;
+        W.clique = work ;
+        W.nodes = work + k ;
+        W.Cand = work + 2 * k ;
+        W.dmax = dmax ;
+        for (int64_t u = tid ; u < (int64_t) n ; u += nthreads)
+        {
+            // the candidates for u are its out-neighbors
+            const int64_t du = Dp [u+1] - Dp [u] ;
+            if (du < k-1) continue ;
+            W.clique [0] = u ;
+            total += LG_kclique_recurse (&W, 1, Dj + Dp [u], du) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the count vector, in the original node numbering of G
+    //--------------------------------------------------------------------------
+
+    if (count != NULL)
+    {
+        // Count [0:n-1] = sum of the Count arrays of all threads
+        int64_t r ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (r = 0 ; r < (int64_t) n ; r++)
+        {
+            uint64_t c = Count [r] ;
+            for (int t = 1 ; t < nthreads ; t++)
+            {
+                c += Count [((size_t) t) * n + r] ;
+            }
+            Count [r] = c ;
+        }
+        GRB_TRY (GrB_Vector_new (count, GrB_INT64, n)) ;
+        GRB_TRY (GrB_Vector_build_INT64 (*count, (GrB_Index *) P,
+            (int64_t *) Count, n, GrB_PLUS_INT64)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    if (ncliques != NULL) (*ncliques) = total ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,338 @@
+//------------------------------------------------------------------------------
+// LAGr_Landmarks: select landmarks for goal-directed shortest path queries
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (Delta must be provided, and G->AT is
+// required if G is directed).
+
+// LAGr_Landmarks selects k landmark nodes and computes the shortest path
+// lengths between each landmark and all nodes of the graph.  These are used
+// by LAGr_PointToPointShortestPath to compute lower bounds on the length of
+// the shortest path between any two nodes, with the triangle inequality (the
+// ALT method of Goldberg and Harrelson: A*, landmarks, and triangle
+// inequality).
+
+// On output, Dfrom is an n-by-k full GrB_FP64 matrix, where Dfrom (i,j) is
+// the length of the shortest path from landmarks [j] to node i, or INFINITY
+// if i is not reachable from that landmark.  If G is directed, Dto (i,j) is
+// the length of the shortest path from node i to landmarks [j], computed with
+// G->AT.  If G is undirected, Dto is not needed and is returned as NULL.  The
+// rows of Dfrom and Dto hold all k distances of a single node, so that a
+// query can find its bounds with a single contiguous scan.
+
+// The landmarks are selected by farthest-point selection.  The first landmark
+// is the node farthest from the seed node.  Each following landmark is the
+// node farthest from all landmarks selected so far (the node with the largest
+// distance to its closest landmark).  If G is directed, the distance between
+// a node and a landmark is the length of the round trip, in both directions.
+// A node not reached by any landmark is infinitely far from all of them, so
+// such nodes are selected first, in order of their index: each component of
+// a disconnected graph (each strongly connected component, if G is directed)
+// gets a landmark before any component gets a second one, as long as k is
+// large enough.  If all nodes are covered before k landmarks are found, k is
+// reduced, and Dfrom and Dto have fewer than k columns.
+
+// The shortest paths are computed with LAGr_SingleSourceShortestPath, so the
+// edge weights of G->A must not be negative, and the same types of G->A are
+// supported.
+
+#define LG_FREE_ALL GrB_free (d) ;
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// LG_landmark_distances: shortest path lengths from one node, in FP64
+//------------------------------------------------------------------------------
+
+// r (i) is the length of the shortest path from the source to node i, for all
+// nodes i reachable from the source.  Unreachable nodes do not appear in r.
+
+static int LG_landmark_distances
+(
+    GrB_Vector r,               // output, FP64 of size n, already created
+    GrB_Vector *d,              // workspace
+    const LAGraph_Graph G,
+    GrB_Index source,
+    GrB_Scalar Delta,
+    double infinity,            // path length of unreachable nodes
+    char *msg
+)
+{
+    LG_TRY (LAGr_SingleSourceShortestPath (d, G, source, Delta, msg)) ;
+    GRB_TRY (GrB_select (r, NULL, NULL, GrB_VALUELT_FP64, *d, infinity,
+        GrB_DESC_R)) ;
+    GRB_TRY (GrB_free (d)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_Landmarks
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#undef  LG_FREE_ALL
+#define LG_FREE_WORK                    \
+{                                       \
+    GrB_free (&GT) ;                    \
+    LAGraph_Delete (&GT_graph, NULL) ;  \
+    GrB_free (&d) ;                     \
+    GrB_free (&r) ;                     \
+    GrB_free (&rt) ;                    \
+    GrB_free (&s) ;                     \
+    GrB_free (&mind) ;                  \
+    GrB_free (&e) ;                     \
+}
+
+#define LG_FREE_ALL                     \
+{                                       \
+    LG_FREE_WORK ;                      \
+    GrB_free (Dfrom) ;                  \
+    GrB_free (Dto) ;                    \
+}
+
+int LAGr_Landmarks
+(
+    // output:
+    GrB_Matrix *Dfrom,          // Dfrom (i,j): path length from landmark j to i
+    GrB_Matrix *Dto,            // Dto (i,j): path length from i to landmark j,
+                                // or NULL on output if G is undirected
+    int64_t *landmarks,         // optional; size k, the landmarks selected
+    int64_t *nlandmarks,        // number of landmarks selected (at most k)
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    int64_t k,                  // number of landmarks to select
+    GrB_Index seed,             // the first landmark is farthest from seed
+    GrB_Scalar Delta,           // delta value for delta stepping
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix GT = NULL ;
+    LAGraph_Graph GT_graph = NULL ;
+    GrB_Vector d = NULL, r = NULL, rt = NULL, s = NULL, mind = NULL, e = NULL ;
+
+    LG_ASSERT (Dfrom != NULL && Dto != NULL && nlandmarks != NULL,
+        GrB_NULL_POINTER) ;
+    (*Dfrom) = NULL ;
+    (*Dto) = NULL ;
+    (*nlandmarks) = 0 ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (k > 0, GrB_INVALID_VALUE, "k must be positive") ;
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    LG_ASSERT_MSG (seed < n, GrB_INVALID_INDEX, "invalid seed node") ;
+    k = LAGRAPH_MIN (k, (int64_t) n) ;
+
+    bool directed = (G->kind == LAGraph_ADJACENCY_DIRECTED) ;
+    if (directed)
+    {
+        LG_ASSERT_MSG (G->AT != NULL, LAGRAPH_NOT_CACHED,
+            "G->AT is required") ;
+    }
+
+    // get the path length of unreachable nodes, from the type of G->A
+    GrB_Type etype ;
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, G->A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&etype, typename, msg)) ;
+    double infinity = INFINITY ;
+    if (etype == GrB_INT32)
+    {
+        infinity = (double) INT32_MAX ;
+    }
+    else if (etype == GrB_INT64)
+    {
+        infinity = (double) INT64_MAX ;
+    }
+    else if (etype == GrB_UINT32)
+    {
+        infinity = (double) UINT32_MAX ;
+    }
+    else if (etype == GrB_UINT64)
+    {
+        infinity = (double) UINT64_MAX ;
+    }
+
+    //--------------------------------------------------------------------------
+    // create the transposed graph, if G is directed
+    //--------------------------------------------------------------------------
+
+    if (directed)
+    {
+        GRB_TRY (GrB_Matrix_dup (&GT, G->AT)) ;
+        LG_TRY (LAGraph_New (&GT_graph, &GT, LAGraph_ADJACENCY_DIRECTED,
+            msg)) ;
+        if (G->emin != NULL)
+        {
+            GRB_TRY (GrB_Scalar_dup (&(GT_graph->emin), G->emin)) ;
+            GT_graph->emin_state = G->emin_state ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the result and workspace
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_new (Dfrom, GrB_FP64, n, k)) ;
+    GRB_TRY (GrB_assign (*Dfrom, NULL, NULL, (double) INFINITY, GrB_ALL, n,
+        GrB_ALL, k, NULL)) ;
+    if (directed)
+    {
+        GRB_TRY (GrB_Matrix_new (Dto, GrB_FP64, n, k)) ;
+        GRB_TRY (GrB_assign (*Dto, NULL, NULL, (double) INFINITY, GrB_ALL, n,
+            GrB_ALL, k, NULL)) ;
+    }
+    GRB_TRY (GrB_Vector_new (&r, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&rt, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&s, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&mind, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&e, GrB_INT64, n)) ;
+
+    //--------------------------------------------------------------------------
+    // farthest-point selection
+    //--------------------------------------------------------------------------
+
+    // The first pass (j = -1) finds the distances from the seed, which is not
+    // a landmark.  mind (i) is the distance from node i to its closest
+    // landmark, for all nodes i reachable from (and, if G is directed, to)
+    // at least one landmark.
+
+    int64_t center = seed, nlm = 0 ;
+    for (int64_t j = -1 ; j < k ; j++)
+    {
+
+        //----------------------------------------------------------------------
+        // find the distances from (and to) the current center
+        //----------------------------------------------------------------------
+
+        LG_TRY (LG_landmark_distances (r, &d, G, center, Delta, infinity,
+            msg)) ;
+        if (directed)
+        {
+            LG_TRY (LG_landmark_distances (rt, &d, GT_graph, center, Delta,
+                infinity, msg)) ;
+            // s = r + rt, the length of the round trip
+            GRB_TRY (GrB_eWiseMult (s, NULL, NULL, GrB_PLUS_FP64, r, rt,
+                NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GrB_assign (s, NULL, NULL, r, GrB_ALL, n, NULL)) ;
+        }
+
+        if (j >= 0)
+        {
+            // save the distances of landmark j
+            if (landmarks != NULL) landmarks [j] = center ;
+            GRB_TRY (GrB_Col_assign (*Dfrom, r, NULL, r, GrB_ALL, n, j,
+                GrB_DESC_S)) ;
+            if (directed)
+            {
+                GRB_TRY (GrB_Col_assign (*Dto, rt, NULL, rt, GrB_ALL, n, j,
+                    GrB_DESC_S)) ;
+            }
+            nlm = j + 1 ;
+            if (nlm == k) break ;
+            // mind = min (mind, s)
+            GRB_TRY (GrB_eWiseAdd (mind, NULL, NULL, GrB_MIN_FP64, mind, s,
+                NULL)) ;
+        }
+        else
+        {
+            GRB_TRY (GrB_assign (mind, NULL, NULL, s, GrB_ALL, n, NULL)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // select the next landmark
+        //----------------------------------------------------------------------
+
+        GrB_Index ne = 0 ;
+        if (j >= 0)
+        {
+            // e = the nodes not reached by any landmark.  These are infinitely
+            // far from all landmarks, so they are selected first.
+            GRB_TRY (GrB_assign (e, mind, NULL, (int64_t) 0, GrB_ALL, n,
+                GrB_DESC_RSC)) ;
+            GRB_TRY (GrB_Vector_nvals (&ne, e)) ;
+        }
+        if (ne == 0)
+        {
+            double dmax = 0 ;
+            GRB_TRY (GrB_reduce (&dmax, NULL, GrB_MAX_MONOID_FP64, mind,
+                NULL)) ;
+            if (dmax > 0)
+            {
+                // e = the nodes farthest from all landmarks (or from the seed)
+                GRB_TRY (GrB_select (e, NULL, NULL, GrB_VALUEEQ_FP64, mind,
+                    dmax, GrB_DESC_R)) ;
+            }
+            else if (j == -1)
+            {
+                // all nodes reached from the seed are at distance zero:
+                // e = the nodes not reached from the seed
+                GRB_TRY (GrB_assign (e, mind, NULL, (int64_t) 0, GrB_ALL, n,
+                    GrB_DESC_RSC)) ;
+            }
+            else
+            {
+                // all nodes are covered
+                GRB_TRY (GrB_Vector_clear (e)) ;
+            }
+            GRB_TRY (GrB_Vector_nvals (&ne, e)) ;
+        }
+        if (j == -1)
+        {
+            // the seed is not a landmark, so it does not cover any node
+            GRB_TRY (GrB_Vector_clear (mind)) ;
+        }
+
+        // the next landmark is the first node in e.  If e is empty after the
+        // first pass, the seed itself is the first landmark.
+        if (ne == 0)
+        {
+            if (j >= 0) break ;
+            continue ;
+        }
+        GRB_TRY (GrB_apply (e, NULL, NULL, GrB_ROWINDEX_INT64, e, 0, NULL)) ;
+        GRB_TRY (GrB_reduce (&center, NULL, GrB_MIN_MONOID_INT64, e, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // remove any unused columns
+    //--------------------------------------------------------------------------
+
+    if (nlm < k)
+    {
+        GRB_TRY (GrB_Matrix_resize (*Dfrom, n, nlm)) ;
+        if (directed)
+        {
+            GRB_TRY (GrB_Matrix_resize (*Dto, n, nlm)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*nlandmarks) = nlm ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
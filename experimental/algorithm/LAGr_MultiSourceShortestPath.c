@@ -0,0 +1,559 @@
+//------------------------------------------------------------------------------
+// LAGr_MultiSourceShortestPath: batched multi-source shortest paths
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->emin is required for best performance).
+
+// LAGr_MultiSourceShortestPath computes the shortest path lengths from each
+// of ns source nodes to all nodes in the graph, with the same delta-stepping
+// method as LAGr_SingleSourceShortestPath.  The result is an ns-by-n matrix
+// D, where D(k,i) is the length of the shortest path from sources [k] to i.
+// D is full; if node i is not reachable from sources [k], D(k,i) is INFINITY
+// for GrB_FP32 and GrB_FP64, or the maximum integer for the other types, as
+// in LAGr_SingleSourceShortestPath.
+
+// Calling LAGr_SingleSourceShortestPath once per source recomputes the light
+// and heavy edge matrices AL and AH for each source, and each bucket is
+// typically too small to keep all threads busy.  Here, AL and AH are
+// computed just once.  All ns searches then advance together: the vectors
+// of LAGr_SingleSourceShortestPath become ns-by-n matrices, and each GrB_vxm
+// becomes a single GrB_mxm.  Bucket k of every search is processed in the
+// same step; a search whose bucket is empty simply contributes no entries.
+
+// If LAGraph has been configured for nested parallelism (nthreads_outer > 1,
+// see LAGraph_SetNumThreads), the sources are split into nthreads_outer
+// groups that are searched in parallel, each with nthreads_inner threads
+// inside GraphBLAS.  AL and AH are shared by all groups.
+
+// NOTE: this method gets stuck in an infinite loop when there are negative-
+// weight cycles in the graph.
+
+#define LG_FREE_WORK            \
+{                               \
+    GrB_free (&lBound) ;        \
+    GrB_free (&uBound) ;        \
+    GrB_free (&Tmasked) ;       \
+    GrB_free (&TReq) ;          \
+    GrB_free (&Tless) ;         \
+    GrB_free (&S) ;             \
+    GrB_free (&Reach) ;         \
+    GrB_free (&Empty) ;         \
+}
+
+#define LG_FREE_ALL             \
+{                               \
+    LG_FREE_WORK ;              \
+    GrB_free (&T) ;             \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// LG_msssp_ops: type-specific operators, shared by all groups of sources
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    GrB_Type etype ;
+    GrB_IndexUnaryOp ne, ge, lt ;
+    GrB_BinaryOp less_than ;
+    GrB_Semiring min_plus ;
+    GrB_Scalar Infinity ;           // infinity (or max int) of type etype
+    bool negative_edge_weights ;
+    int tcode ;
+    int32_t  delta_int32  ;
+    int64_t  delta_int64  ;
+    uint32_t delta_uint32 ;
+    uint64_t delta_uint64 ;
+    float    delta_fp32   ;
+    double   delta_fp64   ;
+}
+LG_msssp_ops ;
+
+#define setelement(s, k)                                                      \
+{                                                                             \
+    switch (ops->tcode)                                                       \
+    {                                                                         \
+        default:                                                              \
+        case 0 : GrB_Scalar_setElement_INT32  (s, k * ops->delta_int32 ) ;    \
+                 break ;                                                      \
+        case 1 : GrB_Scalar_setElement_INT64  (s, k * ops->delta_int64 ) ;    \
+                 break ;                                                      \
+        case 2 : GrB_Scalar_setElement_UINT32 (s, k * ops->delta_uint32) ;    \
+                 break ;                                                      \
+        case 3 : GrB_Scalar_setElement_UINT64 (s, k * ops->delta_uint64) ;    \
+                 break ;                                                      \
+        case 4 : GrB_Scalar_setElement_FP32   (s, k * ops->delta_fp32  ) ;    \
+                 break ;                                                      \
+        case 5 : GrB_Scalar_setElement_FP64   (s, k * ops->delta_fp64  ) ;    \
+                 break ;                                                      \
+    }                                                                         \
+}
+
+//------------------------------------------------------------------------------
+// LG_msssp: delta stepping for a group of ns sources
+//------------------------------------------------------------------------------
+
+static int LG_msssp
+(
+    // output:
+    GrB_Matrix *D,              // ns-by-n matrix of path lengths
+    // input:
+    const GrB_Matrix AL,        // light edges
+    const GrB_Matrix AH,        // heavy edges
+    const GrB_Index *sources,   // size ns
+    int64_t ns,
+    GrB_Index n,
+    const LG_msssp_ops *ops,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GrB_Scalar lBound = NULL ;  // the threshold for GrB_select
+    GrB_Scalar uBound = NULL ;  // the threshold for GrB_select
+    GrB_Matrix T = NULL ;       // tentative shortest path lengths
+    GrB_Matrix Tmasked = NULL ;
+    GrB_Matrix TReq = NULL ;
+    GrB_Matrix Tless = NULL ;
+    GrB_Matrix S = NULL ;
+    GrB_Matrix Reach = NULL ;
+    GrB_Matrix Empty = NULL ;
+    GrB_Type etype = ops->etype ;
+
+    GRB_TRY (GrB_Scalar_new (&lBound, etype)) ;
+    GRB_TRY (GrB_Scalar_new (&uBound, etype)) ;
+    GRB_TRY (GrB_Matrix_new (&T, etype, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&Tmasked, etype, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&TReq, etype, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&Empty, GrB_BOOL, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&Tless, GrB_BOOL, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&S, GrB_BOOL, ns, n)) ;
+    GRB_TRY (GrB_Matrix_new (&Reach, GrB_BOOL, ns, n)) ;
+
+#if LAGRAPH_SUITESPARSE
+    // optional hints for SuiteSparse:GraphBLAS
+    GRB_TRY (GxB_set (T, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    GRB_TRY (GxB_set (Tmasked, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (TReq, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (Tless, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (S, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (Reach, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+#endif
+
+    // T (:,:) = infinity
+    GRB_TRY (GrB_Matrix_assign_Scalar (T, NULL, NULL, ops->Infinity,
+        GrB_ALL, ns, GrB_ALL, n, NULL)) ;
+
+    for (int64_t k = 0 ; k < ns ; k++)
+    {
+        // T (k,src) = 0, Reach (k,src) = true, S (k,src) = true
+        GrB_Index src = sources [k] ;
+        GRB_TRY (GrB_Matrix_setElement (T, 0, k, src)) ;
+        GRB_TRY (GrB_Matrix_setElement (Reach, true, k, src)) ;
+        GRB_TRY (GrB_Matrix_setElement (S, true, k, src)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // while (T >= step*Delta) not empty
+    //--------------------------------------------------------------------------
+
+    for (int64_t step = 0 ; ; step++)
+    {
+
+        //----------------------------------------------------------------------
+        // Tmasked = all entries in T<Reach> that are less than (step+1)*Delta
+        //----------------------------------------------------------------------
+
+        setelement (uBound, (step+1)) ;        // uBound = (step+1) * Delta
+        GRB_TRY (GrB_Matrix_clear (Tmasked)) ;
+
+        // Tmasked<Reach> = T
+        GRB_TRY (GrB_assign (Tmasked, Reach, NULL, T, GrB_ALL, ns, GrB_ALL, n,
+            NULL)) ;
+        // Tmasked = select (Tmasked < (step+1)*Delta)
+        GRB_TRY (GrB_select (Tmasked, NULL, NULL, ops->lt, Tmasked, uBound,
+            NULL)) ;
+
+        GrB_Index Tmasked_nvals ;
+        GRB_TRY (GrB_Matrix_nvals (&Tmasked_nvals, Tmasked)) ;
+
+        //----------------------------------------------------------------------
+        // continue while the current buckets (Tmasked) are not all empty
+        //----------------------------------------------------------------------
+
+        while (Tmasked_nvals > 0)
+        {
+            // TReq = Tmasked*AL using the min_plus semiring
+            GRB_TRY (GrB_mxm (TReq, NULL, NULL, ops->min_plus, Tmasked, AL,
+                NULL)) ;
+
+            // S<struct(Tmasked)> = true
+            GRB_TRY (GrB_assign (S, Tmasked, NULL, (bool) true, GrB_ALL, ns,
+                GrB_ALL, n, GrB_DESC_S)) ;
+
+            // if nvals (TReq) is 0, no need to continue the rest of this loop
+            GrB_Index TReq_nvals ;
+            GRB_TRY (GrB_Matrix_nvals (&TReq_nvals, TReq)) ;
+            if (TReq_nvals == 0) break ;
+
+            // Tless = (TReq .< T) using set intersection
+            GRB_TRY (GrB_eWiseMult (Tless, NULL, NULL, ops->less_than, TReq, T,
+                NULL)) ;
+
+            // remove explicit zeros from Tless so it can be used as a
+            // structural mask
+            GrB_Index Tless_nvals ;
+            GRB_TRY (GrB_select (Tless, NULL, NULL, ops->ne, Tless, 0, NULL)) ;
+            GRB_TRY (GrB_Matrix_nvals (&Tless_nvals, Tless)) ;
+            if (Tless_nvals == 0) break ;
+
+            // update reachable node list/mask
+            // Reach<struct(Tless)> = true
+            GRB_TRY (GrB_assign (Reach, Tless, NULL, (bool) true, GrB_ALL, ns,
+                GrB_ALL, n, GrB_DESC_S)) ;
+
+            // Tmasked<struct(Tless)> = select (TReq < (step+1)*Delta)
+            GRB_TRY (GrB_Matrix_clear (Tmasked)) ;
+            GRB_TRY (GrB_select (Tmasked, Tless, NULL, ops->lt, TReq, uBound,
+                GrB_DESC_S)) ;
+
+            // For general graph with some negative weights:
+            if (ops->negative_edge_weights)
+            {
+                setelement (lBound, (step)) ;  // lBound = step*Delta
+                // Tmasked = select entries in Tmasked that are >= step*Delta
+                GRB_TRY (GrB_select (Tmasked, NULL, NULL, ops->ge, Tmasked,
+                    lBound, NULL)) ;
+            }
+
+            // T<struct(Tless)> = TReq
+            GRB_TRY (GrB_assign (T, Tless, NULL, TReq, GrB_ALL, ns, GrB_ALL, n,
+                GrB_DESC_S)) ;
+            GRB_TRY (GrB_Matrix_nvals (&Tmasked_nvals, Tmasked)) ;
+        }
+
+        // Tmasked<S> = T
+        GRB_TRY (GrB_Matrix_clear (Tmasked)) ;
+        GRB_TRY (GrB_assign (Tmasked, S, NULL, T, GrB_ALL, ns, GrB_ALL, n,
+            GrB_DESC_S)) ;
+
+        // TReq = Tmasked*AH using the min_plus semiring
+        GRB_TRY (GrB_mxm (TReq, NULL, NULL, ops->min_plus, Tmasked, AH,
+            NULL)) ;
+
+        // Tless = (TReq .< T) using set intersection
+        GRB_TRY (GrB_eWiseMult (Tless, NULL, NULL, ops->less_than, TReq, T,
+            NULL)) ;
+
+        // T<Tless> = TReq, which computes T = min (T, TReq)
+        GRB_TRY (GrB_assign (T, Tless, NULL, TReq, GrB_ALL, ns, GrB_ALL, n,
+            NULL)) ;
+
+        //----------------------------------------------------------------------
+        // find out how many left to be computed
+        //----------------------------------------------------------------------
+
+        // update reachable node list
+        // Reach<Tless> = true
+        GRB_TRY (GrB_assign (Reach, Tless, NULL, (bool) true, GrB_ALL, ns,
+            GrB_ALL, n, NULL)) ;
+
+        // remove previous buckets
+        // Reach<struct(S)> = Empty
+        GRB_TRY (GrB_assign (Reach, S, NULL, Empty, GrB_ALL, ns, GrB_ALL, n,
+            GrB_DESC_S)) ;
+        GrB_Index nreach ;
+        GRB_TRY (GrB_Matrix_nvals (&nreach, Reach)) ;
+        if (nreach == 0) break ;
+
+        GRB_TRY (GrB_Matrix_clear (S)) ; // clear S for the next iteration
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*D) = T ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_MultiSourceShortestPath
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                        \
+{                                                           \
+    GrB_free (&AL) ;                                        \
+    GrB_free (&AH) ;                                        \
+    GrB_free (&(ops.Infinity)) ;                            \
+    if (Dgroup != NULL)                                     \
+    {                                                       \
+        for (int g = 0 ; g < ngroups ; g++)                 \
+        {                                                   \
+            GrB_free (&(Dgroup [g])) ;                      \
+        }                                                   \
+    }                                                       \
+    LAGraph_Free ((void **) &Dgroup, NULL) ;                \
+    LAGraph_Free ((void **) &Rows, NULL) ;                  \
+    LAGraph_Free ((void **) &Status, NULL) ;                \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                         \
+{                                                           \
+    LG_FREE_WORK ;                                          \
+    GrB_free (D) ;                                          \
+}
+
+int LAGr_MultiSourceShortestPath
+(
+    // output:
+    GrB_Matrix *D,              // D (k,i) is the length of the shortest path
+                                // from sources [k] to node i
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    const GrB_Index *sources,   // source nodes, of size ns
+    int64_t ns,                 // number of source nodes
+    GrB_Scalar Delta,           // delta value for delta stepping
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix AL = NULL ;      // graph containing the light weight edges
+    GrB_Matrix AH = NULL ;      // graph containing the heavy weight edges
+    GrB_Matrix *Dgroup = NULL ; // Dgroup [g]: path lengths for group g
+    GrB_Index *Rows = NULL ;
+    int *Status = NULL ;
+    int ngroups = 0 ;
+    LG_msssp_ops ops ;
+    ops.Infinity = NULL ;
+
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (D != NULL && Delta != NULL, GrB_NULL_POINTER) ;
+    (*D) = NULL ;
+    LG_ASSERT (sources != NULL || ns == 0, GrB_NULL_POINTER) ;
+    LG_ASSERT_MSG (ns >= 0, GrB_INVALID_VALUE, "ns must be >= 0") ;
+
+    GrB_Index nvals ;
+    LG_TRY (GrB_Scalar_nvals (&nvals, Delta)) ;
+    LG_ASSERT_MSG (nvals == 1, GrB_EMPTY_OBJECT, "Delta is missing") ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    for (int64_t k = 0 ; k < ns ; k++)
+    {
+        LG_ASSERT_MSG (sources [k] < n, GrB_INVALID_INDEX,
+            "invalid source node") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // select the operators
+    //--------------------------------------------------------------------------
+
+    // get the type of the A matrix
+    GrB_Type etype ;
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&etype, typename, msg)) ;
+
+    GRB_TRY (GrB_Scalar_new (&(ops.Infinity), etype)) ;
+    ops.etype = etype ;
+    ops.negative_edge_weights = true ;
+    GrB_IndexUnaryOp le, gt ;
+
+    if (etype == GrB_INT32)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&(ops.delta_int32), Delta)) ;
+        GRB_TRY (GrB_Scalar_setElement (ops.Infinity, (int32_t) INT32_MAX)) ;
+        ops.ne = GrB_VALUENE_INT32 ;
+        le     = GrB_VALUELE_INT32 ;
+        ops.ge = GrB_VALUEGE_INT32 ;
+        ops.lt = GrB_VALUELT_INT32 ;
+        gt     = GrB_VALUEGT_INT32 ;
+        ops.less_than = GrB_LT_INT32 ;
+        ops.min_plus = GrB_MIN_PLUS_SEMIRING_INT32 ;
+        ops.tcode = 0 ;
+    }
+    else if (etype == GrB_INT64)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&(ops.delta_int64), Delta)) ;
+        GRB_TRY (GrB_Scalar_setElement (ops.Infinity, (int64_t) INT64_MAX)) ;
+        ops.ne = GrB_VALUENE_INT64 ;
+        le     = GrB_VALUELE_INT64 ;
+        ops.ge = GrB_VALUEGE_INT64 ;
+        ops.lt = GrB_VALUELT_INT64 ;
+        gt     = GrB_VALUEGT_INT64 ;
+        ops.less_than = GrB_LT_INT64 ;
+        ops.min_plus = GrB_MIN_PLUS_SEMIRING_INT64 ;
+        ops.tcode = 1 ;
+    }
+    else if (etype == GrB_UINT32)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&(ops.delta_uint32), Delta)) ;
+        GRB_TRY (GrB_Scalar_setElement (ops.Infinity, (uint32_t) UINT32_MAX)) ;
+        ops.ne = GrB_VALUENE_UINT32 ;
+        le     = GrB_VALUELE_UINT32 ;
+        ops.ge = GrB_VALUEGE_UINT32 ;
+        ops.lt = GrB_VALUELT_UINT32 ;
+        gt     = GrB_VALUEGT_UINT32 ;
+        ops.less_than = GrB_LT_UINT32 ;
+        ops.min_plus = GrB_MIN_PLUS_SEMIRING_UINT32 ;
+        ops.tcode = 2 ;
+        ops.negative_edge_weights = false ;
+    }
+    else if (etype == GrB_UINT64)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&(ops.delta_uint64), Delta)) ;
+        GRB_TRY (GrB_Scalar_setElement (ops.Infinity, (uint64_t) UINT64_MAX)) ;
+        ops.ne = GrB_VALUENE_UINT64 ;
+        le     = GrB_VALUELE_UINT64 ;
+        ops.ge = GrB_VALUEGE_UINT64 ;
+        ops.lt = GrB_VALUELT_UINT64 ;
+        gt     = GrB_VALUEGT_UINT64 ;
+        ops.less_than = GrB_LT_UINT64 ;
+        ops.min_plus = GrB_MIN_PLUS_SEMIRING_UINT64 ;
+        ops.tcode = 3 ;
+        ops.negative_edge_weights = false ;
+    }
+    else if (etype == GrB_FP32)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&(ops.delta_fp32), Delta)) ;
+        GRB_TRY (GrB_Scalar_setElement (ops.Infinity, (float) INFINITY)) ;
+        ops.ne = GrB_VALUENE_FP32 ;
+        le     = GrB_VALUELE_FP32 ;
+        ops.ge = GrB_VALUEGE_FP32 ;
+        ops.lt = GrB_VALUELT_FP32 ;
+        gt     = GrB_VALUEGT_FP32 ;
+        ops.less_than = GrB_LT_FP32 ;
+        ops.min_plus = GrB_MIN_PLUS_SEMIRING_FP32 ;
+        ops.tcode = 4 ;
+    }
+    else if (etype == GrB_FP64)
+    {
+        GRB_TRY (GrB_Scalar_extractElement (&(ops.delta_fp64), Delta)) ;
+        GRB_TRY (GrB_Scalar_setElement (ops.Infinity, (double) INFINITY)) ;
+        ops.ne = GrB_VALUENE_FP64 ;
+        le     = GrB_VALUELE_FP64 ;
+        ops.ge = GrB_VALUEGE_FP64 ;
+        ops.lt = GrB_VALUELT_FP64 ;
+        gt     = GrB_VALUEGT_FP64 ;
+        ops.less_than = GrB_LT_FP64 ;
+        ops.min_plus = GrB_MIN_PLUS_SEMIRING_FP64 ;
+        ops.tcode = 5 ;
+    }
+    else
+    {
+        LG_ASSERT_MSG (false, GrB_NOT_IMPLEMENTED, "type not supported") ;
+    }
+
+    // check if the graph might have negative edge weights
+    if (ops.negative_edge_weights)
+    {
+        double emin = -1 ;
+        if (G->emin != NULL &&
+            (G->emin_state == LAGraph_VALUE ||
+             G->emin_state == LAGraph_BOUND))
+        {
+            GRB_TRY (GrB_Scalar_extractElement_FP64 (&emin, G->emin)) ;
+        }
+        ops.negative_edge_weights = (emin < 0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // split the edges into light and heavy edges, just once for all sources
+    //--------------------------------------------------------------------------
+
+    // AL = A .* (A <= Delta)
+    GRB_TRY (GrB_Matrix_new (&AL, etype, n, n)) ;
+    GRB_TRY (GrB_select (AL, NULL, NULL, le, A, Delta, NULL)) ;
+    GRB_TRY (GrB_wait (AL, GrB_MATERIALIZE)) ;
+
+    // AH = A .* (A > Delta)
+    GRB_TRY (GrB_Matrix_new (&AH, etype, n, n)) ;
+    GRB_TRY (GrB_select (AH, NULL, NULL, gt, A, Delta, NULL)) ;
+    GRB_TRY (GrB_wait (AH, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // search from all sources, in ngroups groups
+    //--------------------------------------------------------------------------
+
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    ngroups = (int) LAGRAPH_MAX (1, LAGRAPH_MIN (nthreads_outer, ns)) ;
+
+    if (ngroups == 1)
+    {
+        // all sources together, with all threads used inside GraphBLAS
+        LG_TRY (LG_msssp (D, AL, AH, sources, ns, n, &ops, msg)) ;
+        LG_FREE_WORK ;
+        return (GrB_SUCCESS) ;
+    }
+
+    LG_TRY (LAGraph_Calloc ((void **) &Dgroup, ngroups, sizeof (GrB_Matrix),
+        msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Status, ngroups, sizeof (int), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Rows, ns, sizeof (GrB_Index), msg)) ;
+
+    int g ;
+    #pragma omp parallel for num_threads(ngroups) schedule(dynamic,1)
+    for (g = 0 ; g < ngroups ; g++)
+    {
+        int64_t k1, k2 ;
+        LG_PARTITION (k1, k2, ns, g, ngroups) ;
+        Status [g] = LG_msssp (&(Dgroup [g]), AL, AH, sources + k1, k2 - k1,
+            n, &ops, NULL) ;
+    }
+
+    for (g = 0 ; g < ngroups ; g++)
+    {
+        LG_TRY (Status [g]) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // D (k1:k2-1,:) = Dgroup [g] for each group g
+    //--------------------------------------------------------------------------
+
+    for (int64_t k = 0 ; k < ns ; k++)
+    {
+        Rows [k] = k ;
+    }
+    GRB_TRY (GrB_Matrix_new (D, etype, ns, n)) ;
+    for (g = 0 ; g < ngroups ; g++)
+    {
+        int64_t k1, k2 ;
+        LG_PARTITION (k1, k2, ns, g, ngroups) ;
+        GRB_TRY (GrB_assign (*D, NULL, NULL, Dgroup [g], Rows + k1, k2 - k1,
+            GrB_ALL, n, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
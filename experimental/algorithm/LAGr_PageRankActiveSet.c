@@ -0,0 +1,242 @@
+//------------------------------------------------------------------------------
+// LAGr_PageRankActiveSet: pagerank that skips nodes whose rank has settled
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT and G->out_degree are required).
+
+// LAGr_PageRankActiveSet computes the same pagerank as LAGr_PageRank, with the
+// same inputs, and with sinks handled the same way.  LAGr_PageRank recomputes
+// the rank of every node in each iteration, but on many graphs most of the
+// ranks settle after a few iterations.  Here, only the ranks of the active
+// nodes are recomputed, with r<active> = teleport + AT*w, where the mask makes
+// GrB_mxv compute just the rows of the active nodes.
+
+// A node whose rank changes by more than a threshold (initially tol/n) keeps
+// its out-neighbors active for the next iteration; all other nodes are frozen.
+// A frozen node is reactivated only when one of its in-neighbors changes by
+// more than the threshold.  If the change in the rank of the sinks moves the
+// teleport value by more than the threshold, all nodes are active.
+
+// The first iteration recomputes all ranks.  When the active set becomes
+// empty, the changes ignored for frozen nodes may still add up, so a full
+// iteration is done, exactly as in LAGr_PageRank.  The method stops only when
+// a full iteration has sum (abs (r - rold)) <= tol, which is the stopping rule
+// of LAGr_PageRank.  Otherwise, the threshold is halved, and the nodes that
+// changed by more than the threshold in the full iteration restart the active
+// set.
+
+// iters is the total number of iterations, both full and on the active set
+// only.  itermax limits both kinds of iterations.
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&d1) ;                \
+    GrB_free (&d) ;                 \
+    GrB_free (&t) ;                 \
+    GrB_free (&w) ;                 \
+    GrB_free (&delta) ;             \
+    GrB_free (&active) ;            \
+    GrB_free (&changed) ;           \
+    GrB_free (&sink) ;              \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (&r) ;                 \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGr_PageRankActiveSet
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector r = NULL, d = NULL, t = NULL, w = NULL, d1 = NULL ;
+    GrB_Vector delta = NULL, active = NULL, changed = NULL, sink = NULL ;
+    LG_ASSERT (centrality != NULL && iters != NULL, GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    GrB_Matrix AT ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE)
+    {
+        // A and A' have the same structure
+        AT = G->A ;
+    }
+    else
+    {
+        // A and A' differ
+        AT = G->AT ;
+        LG_ASSERT_MSG (AT != NULL, LAGRAPH_NOT_CACHED, "G->AT is required") ;
+    }
+    GrB_Vector d_out = G->out_degree ;
+    LG_ASSERT_MSG (d_out != NULL,
+        LAGRAPH_NOT_CACHED, "G->out_degree is required") ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    (*centrality) = NULL ;
+    GRB_TRY (GrB_Matrix_nrows (&n, AT)) ;
+
+    const float damping_over_n = damping / n ;
+    const float scaled_damping = (1 - damping) / n ;
+    float threshold = tol / n ;
+
+    // r = 1 / n
+    GRB_TRY (GrB_Vector_new (&t, GrB_FP32, n)) ;
+    GRB_TRY (GrB_Vector_new (&r, GrB_FP32, n)) ;
+    GRB_TRY (GrB_Vector_new (&w, GrB_FP32, n)) ;
+    GRB_TRY (GrB_Vector_new (&delta, GrB_FP32, n)) ;
+    GRB_TRY (GrB_Vector_new (&changed, GrB_FP32, n)) ;
+    GRB_TRY (GrB_Vector_new (&active, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_assign (r, NULL, NULL, (float) (1.0 / n), GrB_ALL, n, NULL)) ;
+
+    // find all sinks, as in LAGr_PageRank
+    GrB_Index nsinks, nvals ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, d_out)) ;
+    nsinks = n - nvals ;
+    if (nsinks > 0)
+    {
+        // sink<!struct(d_out)> = true
+        GRB_TRY (GrB_Vector_new (&sink, GrB_BOOL, n)) ;
+        GRB_TRY (GrB_assign (sink, d_out, NULL, (bool) true, GrB_ALL, n,
+            GrB_DESC_SC)) ;
+    }
+
+    // d = max (d_out / damping, 1 / damping), as in LAGr_PageRank
+    GRB_TRY (GrB_Vector_new (&d, GrB_FP32, n)) ;
+    GRB_TRY (GrB_apply (d, NULL, NULL, GrB_DIV_FP32, d_out, damping, NULL)) ;
+    float dmin = 1.0 / damping ;
+    GRB_TRY (GrB_Vector_new (&d1, GrB_FP32, n)) ;
+    GRB_TRY (GrB_assign (d1, NULL, NULL, dmin, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_eWiseAdd (d, NULL, NULL, GrB_MAX_FP32, d1, d, NULL)) ;
+    GrB_free (&d1) ;
+
+    // w = r ./ d
+    GRB_TRY (GrB_eWiseMult (w, NULL, NULL, GrB_DIV_FP32, r, d, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // pagerank iterations
+    //--------------------------------------------------------------------------
+
+    bool full = true ;      // first iteration is a full one
+    bool verify = false ;   // true if the active set has become empty
+    for ((*iters) = 0 ; ; (*iters)++)
+    {
+        // check for convergence
+        LG_ASSERT_MSGF ((*iters) < itermax, LAGRAPH_CONVERGENCE_FAILURE,
+            "pagerank failed to converge in %d iterations", itermax) ;
+
+        // determine teleport from the rank of the sinks
+        float teleport = scaled_damping ; // teleport = (1 - damping) / n
+        float sum_rsink = 0 ;
+        if (nsinks > 0)
+        {
+            // delta = r (sink)
+            GRB_TRY (GrB_eWiseMult (delta, NULL, NULL, GrB_FIRST_FP32, r,
+                sink, NULL)) ;
+            GRB_TRY (GrB_reduce (&sum_rsink, NULL, GrB_PLUS_MONOID_FP32,
+                delta, NULL)) ;
+            teleport += damping_over_n * sum_rsink ;
+        }
+
+        // t = teleport + AT*w, for all nodes or just the active ones
+        GrB_Vector mask = full ? NULL : active ;
+        GRB_TRY (GrB_assign (t, mask, NULL, teleport, GrB_ALL, n,
+            full ? NULL : GrB_DESC_RS)) ;
+        GRB_TRY (GrB_mxv (t, mask, GrB_PLUS_FP32, LAGraph_plus_second_fp32,
+            AT, w, full ? NULL : GrB_DESC_S)) ;
+
+        // delta = t - r, for the nodes in t
+        GRB_TRY (GrB_eWiseMult (delta, NULL, NULL, GrB_MINUS_FP32, t, r,
+            NULL)) ;
+        // r<struct(t)> = t, and w<struct(t)> = r ./ d
+        GRB_TRY (GrB_assign (r, t, NULL, t, GrB_ALL, n, GrB_DESC_S)) ;
+        GRB_TRY (GrB_eWiseMult (w, t, NULL, GrB_DIV_FP32, r, d, GrB_DESC_S)) ;
+
+        // changed = abs (delta), and rdiff = sum (changed)
+        float rdiff = 0 ;
+        GRB_TRY (GrB_apply (changed, NULL, NULL, GrB_ABS_FP32, delta, NULL)) ;
+        GRB_TRY (GrB_reduce (&rdiff, NULL, GrB_PLUS_MONOID_FP32, changed,
+            NULL)) ;
+        if (full)
+        {
+            // a full iteration: stop if converged, as in LAGr_PageRank
+            if (rdiff <= tol)
+            {
+                (*iters)++ ;
+                break ;
+            }
+            // otherwise, if this iteration was done because the active set
+            // became empty, tighten the threshold
+            if (verify) threshold /= 2 ;
+        }
+
+        // find the change in teleport for the next iteration
+        float dsink = 0 ;
+        if (nsinks > 0)
+        {
+            GRB_TRY (GrB_eWiseMult (delta, NULL, NULL, GrB_FIRST_FP32, delta,
+                sink, NULL)) ;
+            GRB_TRY (GrB_reduce (&dsink, NULL, GrB_PLUS_MONOID_FP32, delta,
+                NULL)) ;
+        }
+
+        if (fabsf (damping_over_n * dsink) > threshold)
+        {
+            // teleport has changed for all nodes, so all are active
+            full = true ;
+            verify = false ;
+            continue ;
+        }
+
+        // changed = the nodes whose rank changed by more than the threshold
+        GRB_TRY (GrB_select (changed, NULL, NULL, GrB_VALUEGT_FP32, changed,
+            threshold, NULL)) ;
+        // active = the out-neighbors of the changed nodes
+        GRB_TRY (GrB_vxm (active, NULL, NULL, LAGraph_any_one_bool, changed,
+            G->A, NULL)) ;
+        GRB_TRY (GrB_Vector_nvals (&nvals, active)) ;
+        // if no nodes are active, check for convergence with a full iteration
+        full = (nvals == 0) ;
+        verify = full ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*centrality) = r ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,261 @@
+//------------------------------------------------------------------------------
+// LAGr_PageRankGaussSeidel: pagerank with Gauss-Seidel iterations
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT and G->out_degree are required).
+
+// LAGr_PageRankGaussSeidel computes the same pagerank as LAGr_PageRank, with
+// the same inputs, and with sinks handled the same way.  LAGr_PageRank is a
+// Jacobi iteration: each iteration computes all of the new ranks from the old
+// ones, with about five passes over vectors of size n (w = t./d, r = teleport,
+// r += AT*w, t -= r, and the reduction of abs (t)).  Here, G->AT is unpacked
+// in CSR form, and each iteration is a single pass over its rows.  The new
+// rank of node i is computed from the latest ranks of its in-neighbors, and
+// written in place, so changes propagate within the same iteration
+// (Gauss-Seidel).  The L1 norm of the change and the rank of the sinks are
+// accumulated in the same pass.  This typically takes about half the
+// iterations of LAGr_PageRank.
+
+// The rows are split into contiguous blocks, one per task.  Each task uses
+// the latest ranks of the nodes in its own block, and the ranks of the other
+// nodes from the start of the iteration, so the result does not depend on the
+// order in which the tasks run.  With a single task, this is the classic
+// Gauss-Seidel method.  The rank of the sinks is taken from the prior
+// iteration, as in LAGr_PageRank.
+
+// The iterations stop when sum (abs (r - rold)) <= tol, the same stopping
+// rule as LAGr_PageRank.
+
+// G->AT (or G->A if the graph is undirected or has a symmetric structure) is
+// unpacked and then packed back, so it is modified (but restored) while this
+// method runs.  If SuiteSparse:GraphBLAS is not in use, LAGr_PageRank is used
+// instead.
+
+#define LG_FREE_WORK                                                        \
+{                                                                           \
+    GrB_free (&dv) ;                                                        \
+    LAGraph_Free ((void **) &w, NULL) ;                                     \
+    LAGraph_Free ((void **) &wold, NULL) ;                                  \
+    LAGraph_Free ((void **) &dinv, NULL) ;                                  \
+    if (ATp != NULL)                                                        \
+    {                                                                       \
+        /* pack AT back into G */                                           \
+        GxB_Matrix_pack_CSR (AT, &ATp, &ATj, &ATx, ATp_size, ATj_size,      \
+            ATx_size, AT_iso, AT_jumbled, NULL) ;                           \
+    }                                                                       \
+}
+
+#define LG_FREE_ALL                                                         \
+{                                                                           \
+    LG_FREE_WORK ;                                                          \
+    LAGraph_Free ((void **) &r, NULL) ;                                     \
+    GrB_free (centrality) ;                                                 \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// each task has at least LG_PR_CHUNK rows
+#define LG_PR_CHUNK 4096
+
+int LAGr_PageRankGaussSeidel
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph, modified then restored
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+)
+{
+
+#if !LAGRAPH_SUITESPARSE
+
+    return (LAGr_PageRank (centrality, iters, G, damping, tol, itermax, msg)) ;
+
+#else
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector dv = NULL ;
+    GrB_Index *ATp = NULL, *ATj = NULL, ATp_size, ATj_size, ATx_size ;
+    void *ATx = NULL ;
+    bool AT_iso = false, AT_jumbled = false ;
+    float *r = NULL, *w = NULL, *wold = NULL, *dinv = NULL ;
+    GrB_Matrix AT = NULL ;
+
+    LG_ASSERT (centrality != NULL && iters != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE)
+    {
+        // A and A' have the same structure
+        AT = G->A ;
+    }
+    else
+    {
+        // A and A' differ
+        AT = G->AT ;
+        LG_ASSERT_MSG (AT != NULL, LAGRAPH_NOT_CACHED, "G->AT is required") ;
+    }
+    GrB_Vector d_out = G->out_degree ;
+    LG_ASSERT_MSG (d_out != NULL,
+        LAGRAPH_NOT_CACHED, "G->out_degree is required") ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, AT)) ;
+
+    const float damping_over_n = damping / n ;
+    const float scaled_damping = (1 - damping) / n ;
+
+    // dinv = damping ./ d_out, or zero for sinks
+    GRB_TRY (GrB_Vector_new (&dv, GrB_FP32, n)) ;
+    GRB_TRY (GrB_assign (dv, NULL, NULL, (float) 0, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_apply (dv, d_out, NULL, GrB_DIV_FP32, damping, d_out,
+        GrB_DESC_S)) ;
+    GrB_Index dinv_size ;
+    bool dinv_iso ;
+    GRB_TRY (GxB_Vector_unpack_Full (dv, (void **) &dinv, &dinv_size,
+        &dinv_iso, NULL)) ;
+    if (dinv_iso)
+    {
+        // all nodes have the same out-degree; expand dinv to size n
+        float d0 = dinv [0] ;
+        LG_TRY (LAGraph_Realloc ((void **) &dinv, n, 1, sizeof (float), msg)) ;
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            dinv [i] = d0 ;
+        }
+    }
+    GrB_free (&dv) ;
+
+    // r = 1/n, and w = r .* dinv
+    LG_TRY (LAGraph_Malloc ((void **) &r, n, sizeof (float), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &w, n, sizeof (float), msg)) ;
+    double sum_rsink = 0 ;
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        r [i] = (float) (1.0 / n) ;
+        w [i] = r [i] * dinv [i] ;
+        if (dinv [i] == 0) sum_rsink += r [i] ;
+    }
+
+    // split the rows into ntasks blocks
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int64_t nthreads = ((int64_t) nthreads_outer) * nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, n / LG_PR_CHUNK) ;
+    int ntasks = (int) LAGRAPH_MAX (nthreads, 1) ;
+    int64_t bsize = (n + ntasks - 1) / ntasks ;
+    if (ntasks > 1)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &wold, n, sizeof (float), msg)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // unpack AT in CSR format
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GxB_Matrix_unpack_CSR (AT, &ATp, &ATj, &ATx, &ATp_size,
+        &ATj_size, &ATx_size, &AT_iso, &AT_jumbled, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // pagerank iterations
+    //--------------------------------------------------------------------------
+
+    double rdiff = 1 ;      // first iteration is always done
+    for ((*iters) = 0 ; rdiff > tol ; (*iters)++)
+    {
+        // check for convergence
+        LG_ASSERT_MSGF ((*iters) < itermax, LAGRAPH_CONVERGENCE_FAILURE,
+            "pagerank failed to converge in %d iterations", itermax) ;
+
+        // teleport = (1 - damping) / n + (damping/n) * sum (r (sink))
+        const float teleport = scaled_damping +
+            damping_over_n * (float) sum_rsink ;
+        if (ntasks > 1)
+        {
+            memcpy (wold, w, n * sizeof (float)) ;
+        }
+
+        rdiff = 0 ;
+        sum_rsink = 0 ;
+        int tid ;
+        #pragma omp parallel for num_threads(ntasks) schedule(static,1) \
+            reduction(+:rdiff,sum_rsink)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            const int64_t i1 = tid * bsize ;
+            const int64_t i2 = LAGRAPH_MIN (i1 + bsize, (int64_t) n) ;
+            double my_rdiff = 0, my_rsink = 0 ;
+            for (int64_t i = i1 ; i < i2 ; i++)
+            {
+                // rnew = teleport + sum (w (AT (i,:)))
+                float rnew = teleport ;
+                if (ntasks == 1)
+                {
+                    for (int64_t p = ATp [i] ; p < ATp [i+1] ; p++)
+                    {
+                        rnew += w [ATj [p]] ;
+                    }
+                }
+                else
+                {
+                    for (int64_t p = ATp [i] ; p < ATp [i+1] ; p++)
+                    {
+                        int64_t j = ATj [p] ;
+                        rnew += (j >= i1 && j < i2) ? w [j] : wold [j] ;
+                    }
+                }
+                // accumulate the change and the rank of the sinks
+                my_rdiff += fabsf (rnew - r [i]) ;
+                if (dinv [i] == 0) my_rsink += rnew ;
+                // update r(i) and w(i) in place
+                r [i] = rnew ;
+                w [i] = rnew * dinv [i] ;
+            }
+            rdiff += my_rdiff ;
+            sum_rsink += my_rsink ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // pack AT back into G, and pack r into the centrality vector
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GxB_Matrix_pack_CSR (AT, &ATp, &ATj, &ATx, ATp_size, ATj_size,
+        ATx_size, AT_iso, AT_jumbled, NULL)) ;
+    GRB_TRY (GrB_Vector_new (centrality, GrB_FP32, n)) ;
+    GRB_TRY (GxB_Vector_pack_Full (*centrality, (void **) &r,
+        n * sizeof (float), false, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+#endif
+}
@@ -0,0 +1,283 @@
+//------------------------------------------------------------------------------
+// LAGr_PageRankIncremental: update the pagerank after a batch of edge changes
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->out_degree is required).
+
+// On input, centrality is the pagerank of a graph G0, as computed by
+// LAGr_PageRank (with the same damping factor).  G is the graph G0 after a
+// batch of edges has been inserted and/or deleted, and E holds the pattern of
+// the changed edges: E(i,j) is present if the edge (i,j) was inserted or
+// deleted (it was inserted if G->A(i,j) is present, or deleted otherwise).
+// The values of E are ignored.  If G is undirected, both E(i,j) and E(j,i)
+// must be present for each changed edge.  On output, centrality is updated to
+// the pagerank of G.  The method is a residual-driven (Gauss-Southwell)
+// push method, so its cost depends on the size of the change, not on the size
+// of the graph.
+
+// The pagerank r of G, as computed by LAGr_PageRank, satisfies r = b + M*r,
+// where b = (1-damping)/n, and M*r = damping * (A'*(r./d_out) + sum(r(sink))/n)
+// handles the sinks just as LAGr_PageRank does.  The residual of the input r
+// is res = b + M*r - r.  Since r satisfies this equation for G0, res is found
+// from just the rows of A and A0 that differ, which are the rows of E:
+
+//      res = damping * (x_new'*A - x_old'*A0) + sigma
+
+// where x_new = r ./ d_out for the nodes with a changed row in G, and x_old is
+// the same for G0.  The scalar sigma is the change in the sink mass,
+// damping*(sum (r (sink)) - sum (r (sink0)))/n, which is the same for all
+// nodes.  The degrees of G0 are found from d_out and E, so G0 is not needed.
+
+// Each step then pushes the residual of all nodes with |res(i)| > tol/n: the
+// residual res(i) is moved into r(i), and damping*res(i)/d_out(i) is added to
+// the residual of each out-neighbor of i, with a single GrB_vxm with G->A.
+// This touches only the nodes in the frontier and their out-edges.  If i is
+// a sink, damping*res(i)/n is instead added to sigma.  The iterations stop when
+// sum (abs (res)) <= tol, the same as the stopping rule of LAGr_PageRank.
+
+// The uniform residual sigma is never pushed.  The correction it causes in r
+// is (I-M)\(sigma*ones(n,1)), which is s = sigma*n/(1-damping) times the
+// pagerank r* of G itself.  The pushed result is thus r = r* - s*r*, and so r
+// is scaled by 1/(1-s) when done.
+
+// iters is the number of push steps taken.  If the pagerank of G0 was computed
+// only to within a tolerance, the result is only as accurate as that.  On
+// error, the contents of centrality are undefined.
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&E1) ;                \
+    GrB_free (&Ein) ;               \
+    GrB_free (&Edel) ;              \
+    GrB_free (&U) ;                 \
+    GrB_free (&nin) ;               \
+    GrB_free (&ndel) ;              \
+    GrB_free (&dU) ;                \
+    GrB_free (&dold) ;              \
+    GrB_free (&xnew) ;              \
+    GrB_free (&xold) ;              \
+    GrB_free (&y) ;                 \
+    GrB_free (&res) ;               \
+    GrB_free (&a) ;                 \
+    GrB_free (&rF) ;                \
+    GrB_free (&w) ;                 \
+}
+
+#define LG_FREE_ALL LG_FREE_WORK
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGr_PageRankIncremental
+(
+    // input/output:
+    GrB_Vector centrality,  // on input: pagerank of G0; on output: of G
+    // output:
+    int *iters,             // number of push steps taken
+    // input:
+    const LAGraph_Graph G,  // input graph, after the edge changes
+    const GrB_Matrix E,     // E(i,j) present if edge (i,j) has changed
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of push steps
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix E1 = NULL, Ein = NULL, Edel = NULL ;
+    GrB_Vector U = NULL, nin = NULL, ndel = NULL, dU = NULL, dold = NULL ;
+    GrB_Vector xnew = NULL, xold = NULL, y = NULL, res = NULL, a = NULL ;
+    GrB_Vector rF = NULL, w = NULL ;
+    GrB_Vector r = centrality ;
+    LG_ASSERT (centrality != NULL && iters != NULL && E != NULL,
+        GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    GrB_Matrix A = G->A ;
+    GrB_Vector d_out = G->out_degree ;
+    LG_ASSERT_MSG (d_out != NULL,
+        LAGRAPH_NOT_CACHED, "G->out_degree is required") ;
+
+    GrB_Index n, nr, nrows, ncols, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Vector_size (&nr, r)) ;
+    GRB_TRY (GrB_Matrix_nrows (&nrows, E)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, E)) ;
+    LG_ASSERT_MSG (nr == n && nrows == n && ncols == n,
+        GrB_DIMENSION_MISMATCH, "centrality and E must have dimension n") ;
+
+    GRB_TRY (GrB_Vector_nvals (&nvals, d_out)) ;
+    GrB_Index nsinks = n - nvals ;
+    (*iters) = 0 ;
+
+    //--------------------------------------------------------------------------
+    // find the changed rows, and the out-degrees of G0 for those rows
+    //--------------------------------------------------------------------------
+
+    // E1 = pattern of E, with all entries equal to 1
+    GRB_TRY (GrB_Matrix_new (&E1, GrB_FP32, n, n)) ;
+    GRB_TRY (GrB_apply (E1, NULL, NULL, GrB_ONEB_FP32, E, (float) 0, NULL)) ;
+    // Ein = E1 .* A: the inserted edges
+    GRB_TRY (GrB_Matrix_new (&Ein, GrB_FP32, n, n)) ;
+    GRB_TRY (GrB_eWiseMult (Ein, NULL, NULL, GrB_FIRST_FP32, E1, A, NULL)) ;
+    // Edel<!struct(Ein)> = E1: the deleted edges
+    GRB_TRY (GrB_Matrix_new (&Edel, GrB_FP32, n, n)) ;
+    GRB_TRY (GrB_assign (Edel, Ein, NULL, E1, GrB_ALL, n, GrB_ALL, n,
+        GrB_DESC_SC)) ;
+
+    // U = sum (E1,2): the nodes whose out-edges have changed
+    GRB_TRY (GrB_Vector_new (&U, GrB_FP32, n)) ;
+    GRB_TRY (GrB_reduce (U, NULL, NULL, GrB_PLUS_MONOID_FP32, E1, NULL)) ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, U)) ;
+    if (nvals == 0)
+    {
+        // nothing to do
+        LG_FREE_WORK ;
+        return (GrB_SUCCESS) ;
+    }
+    // nin = sum (Ein,2) and ndel = sum (Edel,2)
+    GRB_TRY (GrB_Vector_new (&nin, GrB_FP32, n)) ;
+    GRB_TRY (GrB_reduce (nin, NULL, NULL, GrB_PLUS_MONOID_FP32, Ein, NULL)) ;
+    GRB_TRY (GrB_Vector_new (&ndel, GrB_FP32, n)) ;
+    GRB_TRY (GrB_reduce (ndel, NULL, NULL, GrB_PLUS_MONOID_FP32, Edel, NULL)) ;
+
+    // dU = d_out (U), for the nodes in U that are not sinks in G
+    GRB_TRY (GrB_Vector_new (&dU, GrB_FP32, n)) ;
+    GRB_TRY (GrB_eWiseMult (dU, NULL, NULL, GrB_FIRST_FP32, d_out, U, NULL)) ;
+    // dold = dU + ndel - nin, for the nodes in U that are not sinks in G0
+    GRB_TRY (GrB_Vector_new (&dold, GrB_FP32, n)) ;
+    GRB_TRY (GrB_eWiseAdd (dold, NULL, NULL, GrB_PLUS_FP32, dU, ndel, NULL)) ;
+    GRB_TRY (GrB_apply (nin, NULL, NULL, GrB_AINV_FP32, nin, NULL)) ;
+    GRB_TRY (GrB_eWiseAdd (dold, NULL, NULL, GrB_PLUS_FP32, dold, nin, NULL)) ;
+    GRB_TRY (GrB_select (dold, NULL, NULL, GrB_VALUEGT_FP32, dold, (float) 0.5,
+        NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // compute the initial residual
+    //--------------------------------------------------------------------------
+
+    // xnew = r ./ dU and xold = r ./ dold
+    GRB_TRY (GrB_Vector_new (&xnew, GrB_FP32, n)) ;
+    GRB_TRY (GrB_eWiseMult (xnew, NULL, NULL, GrB_DIV_FP32, r, dU, NULL)) ;
+    GRB_TRY (GrB_Vector_new (&xold, GrB_FP32, n)) ;
+    GRB_TRY (GrB_eWiseMult (xold, NULL, NULL, GrB_DIV_FP32, r, dold, NULL)) ;
+
+    // sigma = damping * (sum (r (sink)) - sum (r (sink0))) / n, where only
+    // the nodes in U can differ; a node in U is a sink in G if it is not in
+    // dU, and a sink in G0 if it is not in dold
+    GRB_TRY (GrB_Vector_new (&a, GrB_FP32, n)) ;
+    float sum_new = 0, sum_old = 0 ;
+    GRB_TRY (GrB_eWiseMult (a, NULL, NULL, GrB_FIRST_FP32, r, dU, NULL)) ;
+    GRB_TRY (GrB_reduce (&sum_new, NULL, GrB_PLUS_MONOID_FP32, a, NULL)) ;
+    GRB_TRY (GrB_eWiseMult (a, NULL, NULL, GrB_FIRST_FP32, r, dold, NULL)) ;
+    GRB_TRY (GrB_reduce (&sum_old, NULL, GrB_PLUS_MONOID_FP32, a, NULL)) ;
+    double sigma = ((double) damping) * (sum_old - sum_new) / n ;
+
+    // res = damping * (xnew'*A - xold'*A0), where the rows U of A0 are
+    // A(U,:) - Ein(U,:) + Edel(U,:), so that
+    // res = damping * ((xnew - xold)'*A + xold'*Ein - xold'*Edel)
+    GRB_TRY (GrB_Vector_new (&y, GrB_FP32, n)) ;
+    GRB_TRY (GrB_eWiseAdd (y, NULL, NULL, GrB_MINUS_FP32, xnew, xold, NULL)) ;
+    // eWiseAdd gives y(i) = xold(i) where xnew(i) is not present; negate it
+    GRB_TRY (GrB_apply (y, xnew, NULL, GrB_AINV_FP32, y, GrB_DESC_SC)) ;
+    GRB_TRY (GrB_Vector_new (&res, GrB_FP32, n)) ;
+    GRB_TRY (GrB_vxm (res, NULL, NULL, LAGraph_plus_first_fp32, y, A, NULL)) ;
+    GRB_TRY (GrB_vxm (res, NULL, GrB_PLUS_FP32, LAGraph_plus_first_fp32,
+        xold, Ein, NULL)) ;
+    // y = -(xold'*Edel), so that res(j) is negated where it is not yet
+    // present, which GrB_MINUS_FP32 as the accum operator would not do
+    GRB_TRY (GrB_vxm (y, NULL, NULL, LAGraph_plus_first_fp32, xold, Edel,
+        NULL)) ;
+    GRB_TRY (GrB_apply (y, NULL, NULL, GrB_AINV_FP32, y, NULL)) ;
+    GRB_TRY (GrB_eWiseAdd (res, NULL, NULL, GrB_PLUS_FP32, res, y, NULL)) ;
+    GRB_TRY (GrB_apply (res, NULL, NULL, GrB_TIMES_FP32, res, damping, NULL)) ;
+
+    GrB_free (&E1) ;
+    GrB_free (&Ein) ;
+    GrB_free (&Edel) ;
+    GrB_free (&xnew) ;
+    GrB_free (&xold) ;
+    GrB_free (&y) ;
+
+    //--------------------------------------------------------------------------
+    // push the residual until it is small
+    //--------------------------------------------------------------------------
+
+    const float eps = tol / n ;
+    GRB_TRY (GrB_Vector_new (&rF, GrB_FP32, n)) ;
+    GRB_TRY (GrB_Vector_new (&w, GrB_FP32, n)) ;
+
+    for ( ; ; (*iters)++)
+    {
+        // a = abs (res), and rnorm = sum (a)
+        float rnorm = 0 ;
+        GRB_TRY (GrB_apply (a, NULL, NULL, GrB_ABS_FP32, res, NULL)) ;
+        GRB_TRY (GrB_reduce (&rnorm, NULL, GrB_PLUS_MONOID_FP32, a, NULL)) ;
+        if (rnorm <= tol) break ;
+
+        // check for convergence
+        LG_ASSERT_MSGF ((*iters) < itermax, LAGRAPH_CONVERGENCE_FAILURE,
+            "pagerank failed to converge in %d iterations", itermax) ;
+
+        // the frontier is the set of nodes with abs (res) > eps.  It is not
+        // empty, since sum (abs (res)) > tol.
+        GRB_TRY (GrB_select (a, NULL, NULL, GrB_VALUEGT_FP32, a, eps, NULL)) ;
+        // rF = res (frontier), and remove the frontier from res
+        GRB_TRY (GrB_eWiseMult (rF, NULL, NULL, GrB_FIRST_FP32, res, a, NULL)) ;
+        GRB_TRY (GrB_assign (res, a, NULL, res, GrB_ALL, n, GrB_DESC_RSC)) ;
+
+        // r += rF
+        GRB_TRY (GrB_assign (r, NULL, GrB_PLUS_FP32, rF, GrB_ALL, n, NULL)) ;
+
+        // w = rF ./ d_out, for the nodes in the frontier that are not sinks
+        GRB_TRY (GrB_eWiseMult (w, NULL, NULL, GrB_DIV_FP32, rF, d_out,
+            NULL)) ;
+
+        if (nsinks > 0)
+        {
+            // sigma += damping * sum (rF (sink)) / n
+            float sum_rF = 0, sum_nonsink = 0 ;
+            GRB_TRY (GrB_reduce (&sum_rF, NULL, GrB_PLUS_MONOID_FP32, rF,
+                NULL)) ;
+            GRB_TRY (GrB_eWiseMult (a, NULL, NULL, GrB_FIRST_FP32, rF, d_out,
+                NULL)) ;
+            GRB_TRY (GrB_reduce (&sum_nonsink, NULL, GrB_PLUS_MONOID_FP32, a,
+                NULL)) ;
+            sigma += ((double) damping) * (sum_rF - sum_nonsink) / n ;
+        }
+
+        // res += damping * w'*A
+        GRB_TRY (GrB_apply (w, NULL, NULL, GrB_TIMES_FP32, w, damping, NULL)) ;
+        GRB_TRY (GrB_vxm (res, NULL, GrB_PLUS_FP32, LAGraph_plus_first_fp32,
+            w, A, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // apply the uniform residual, free workspace, and return result
+    //--------------------------------------------------------------------------
+
+    if (sigma != 0)
+    {
+        // r = r / (1 - sigma*n/(1-damping))
+        float scale = (float) (1 / (1 - sigma * n / (1 - damping))) ;
+        GRB_TRY (GrB_apply (r, NULL, NULL, GrB_TIMES_FP32, r, scale, NULL)) ;
+    }
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,70 @@
+//------------------------------------------------------------------------------
+// LAGr_PageRankPrecision: pagerank in single, double, or mixed precision
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT and G->out_degree are required).
+
+// LAGr_PageRankPrecision is the same method as LAGr_PageRank, with sinks
+// handled the same way, but with a choice of the precision used:
+
+// LAGr_PageRank_FP32: all work is done in single precision, as in
+//      LAGr_PageRank.  centrality is returned as a GrB_FP32 vector.
+
+// LAGr_PageRank_FP64: all work is done in double precision, with the
+//      LAGraph_plus_second_fp64 semiring.  centrality is returned as a
+//      GrB_FP64 vector.  This doubles the memory traffic of each iteration.
+
+// LAGr_PageRank_Mixed: the vectors d, r, t, and w are held in single
+//      precision, and AT*w is computed in single precision, so the memory
+//      traffic is the same as LAGr_PageRank.  The sum of abs (t-r) and the sum
+//      of the rank of the sinks are accumulated in double precision, and
+//      teleport is computed in double precision.  centrality is returned as a
+//      GrB_FP32 vector.
+
+// For very large graphs, 1/n approaches the resolution of single precision,
+// and the single precision sums of n terms used for the stopping rule and the
+// sinks are no longer accurate enough to reach a small tol.  The mixed method
+// avoids this.  Near convergence, each difference t(i)-r(i) of two nearby
+// single precision values is exact, so it is only the sums that lose
+// accuracy, and these are done in double precision.
+
+// The iteration is done by LG_PageRank, the same method as LAGr_PageRank.
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGr_PageRankPrecision
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    LAGr_PageRank_Precision precision,  // FP32, FP64, or mixed
+    double damping,         // damping factor (typically 0.85)
+    double tol,             // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT_MSG (precision == LAGr_PageRank_FP32 ||
+        precision == LAGr_PageRank_FP64 || precision == LAGr_PageRank_Mixed,
+        GrB_INVALID_VALUE, "invalid precision") ;
+    // the ranks are double precision only for FP64, and the sums are single
+    // precision only for FP32
+    return (LG_PageRank (centrality, iters, G, NULL,
+        (precision == LAGr_PageRank_FP64) ? GrB_FP64 : GrB_FP32,
+        (precision != LAGr_PageRank_FP32), damping, tol, itermax, msg)) ;
+}
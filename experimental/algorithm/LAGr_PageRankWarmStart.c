@@ -0,0 +1,52 @@
+//------------------------------------------------------------------------------
+// LAGr_PageRankWarmStart: pagerank, starting from a given rank vector
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT and G->out_degree are required).
+
+// LAGr_PageRankWarmStart is identical to LAGr_PageRank, except that the
+// iterations start from the rank vector r0 instead of the uniform vector
+// r = 1/n.  If the graph has changed only a little since r0 was computed (for
+// example, r0 is the PageRank of G before a small batch of edges was inserted
+// or deleted), then r0 is already close to the new PageRank, and far fewer
+// iterations are needed.  The result is the same as LAGr_PageRank, to within
+// the tolerance tol; only the number of iterations differs.
+
+// r0 is typecasted to GrB_FP32.  Entries not present in r0 are taken as zero,
+// and r0 is scaled so that it sums to 1.  If r0 is NULL, the uniform vector
+// 1/n is used, just as in LAGr_PageRank.
+
+// The iteration is done by LG_PageRank, the same method as LAGr_PageRank, in
+// single precision.
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGr_PageRankWarmStart
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Vector r0,    // initial rank vector (may be NULL)
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+)
+{
+    return (LG_PageRank (centrality, iters, G, r0, GrB_FP32, false,
+        damping, tol, itermax, msg)) ;
+}
@@ -0,0 +1,449 @@
+//------------------------------------------------------------------------------
+// LAGr_PointToPointShortestPath: goal-directed shortest path between two nodes
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT is required if G is directed, and the
+// landmark distances should be computed by LAGr_Landmarks).
+
+// LAGr_PointToPointShortestPath computes the length of the shortest path from
+// the src node to the dest node, with a bidirectional Dijkstra search guided
+// by the landmark distances Dfrom and Dto (the ALT method).  The forward
+// search from src uses the out-edges in G->A, and the reverse search from
+// dest uses the in-edges in G->AT (or G->A if G is undirected).  Only the
+// nodes near the shortest path are typically visited, so a query is far
+// faster than a single-source search of the whole graph.
+
+// For each landmark L, the triangle inequality gives two lower bounds on the
+// length of the shortest path from v to dest:
+
+//      d(v,dest) >= d(L,dest) - d(L,v)
+//      d(v,dest) >= d(v,L) - d(dest,L)
+
+// and likewise for d(src,v).  pi_t(v) and pi_s(v) are the largest of these
+// bounds on d(v,dest) and d(src,v), over all landmarks.  Both searches use
+// the average potential p(v) = (pi_t(v) - pi_s(v))/2, with the key
+// d(src,v) + p(v) in the forward search and d(v,dest) - p(v) in the reverse
+// search.  The reduced edge weights are then nonnegative in both searches,
+// and the search stops when the sum of the two smallest keys reaches the
+// length of the shortest path found so far.  A node v with pi_t(v) = INFINITY
+// cannot reach dest, and is pruned from the forward search (likewise for
+// pi_s(v) and the reverse search).
+
+// If Dfrom is NULL, all lower bounds are zero, and a plain bidirectional
+// Dijkstra search is done.  The edge weights must not be negative.  Each
+// query takes O(n) time to allocate its workspace with calloc, and otherwise
+// only touches the nodes it visits.
+
+// G->A, G->AT, Dfrom, and Dto are unpacked and then packed back, so they are
+// modified (but restored) while this method runs.  This method requires
+// SuiteSparse:GraphBLAS.
+
+#define LG_FREE_ALL ;
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+#if LAGRAPH_SUITESPARSE
+
+//------------------------------------------------------------------------------
+// LG_alt_heap: a binary min-heap of (key, slot) entries
+//------------------------------------------------------------------------------
+
+// Entries are not removed when their key decreases; a new entry is added
+// instead, and stale entries are skipped when they reach the top of the heap.
+
+typedef struct
+{
+    double key ;        // search key of the node
+    int64_t slot ;      // position of the node in the Node table
+}
+LG_alt_entry ;
+
+typedef struct
+{
+    LG_alt_entry *e ;   // e [0..nheap-1] is the heap
+    int64_t nheap ;     // number of entries in the heap
+    int64_t nmax ;      // size of e
+}
+LG_alt_heap ;
+
+static int LG_alt_push (LG_alt_heap *H, double key, int64_t slot, char *msg)
+{
+    if (H->nheap == H->nmax)
+    {
+        int64_t nmax = LAGRAPH_MAX (2 * H->nmax, 1024) ;
+        LG_TRY (LAGraph_Realloc ((void **) &(H->e), nmax, H->nmax,
+            sizeof (LG_alt_entry), msg)) ;
+        H->nmax = nmax ;
+    }
+    // sift the new entry up from the bottom of the heap
+    int64_t p = H->nheap++ ;
+    while (p > 0)
+    {
+        int64_t parent = (p-1) / 2 ;
+        if (H->e [parent].key <= key) break ;
+        H->e [p] = H->e [parent] ;
+        p = parent ;
+    }
+    H->e [p].key = key ;
+    H->e [p].slot = slot ;
+    return (GrB_SUCCESS) ;
+}
+
+static LG_alt_entry LG_alt_pop (LG_alt_heap *H)
+{
+    LG_alt_entry top = H->e [0] ;
+    LG_alt_entry last = H->e [--(H->nheap)] ;
+    // sift the last entry down from the top of the heap
+    int64_t p = 0, nheap = H->nheap ;
+    while (true)
+    {
+        int64_t c = 2*p + 1 ;
+        if (c >= nheap) break ;
+        if (c+1 < nheap && H->e [c+1].key < H->e [c].key) c++ ;
+        if (last.key <= H->e [c].key) break ;
+        H->e [p] = H->e [c] ;
+        p = c ;
+    }
+    if (nheap > 0) H->e [p] = last ;
+    return (top) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_alt_node: the state of a node visited by either search
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    double dist [2] ;   // dist [0]: path length from src to the node,
+                        // dist [1]: path length from the node to dest
+    double pi [2] ;     // pi [0]: lower bound on the path length to dest,
+                        // pi [1]: lower bound on the path length from src
+    int64_t node ;
+    bool done [2] ;     // true if settled in the forward (0) or reverse (1)
+                        // search
+}
+LG_alt_node ;
+
+// the weight of the edge at position e of the CSR matrix, as a double
+static inline double LG_alt_weight (const void *Ax, bool iso, int64_t e,
+    GrB_Type etype)
+{
+    if (iso) e = 0 ;
+    if (etype == GrB_INT32 ) return ((double) ((int32_t  *) Ax) [e]) ;
+    if (etype == GrB_INT64 ) return ((double) ((int64_t  *) Ax) [e]) ;
+    if (etype == GrB_UINT32) return ((double) ((uint32_t *) Ax) [e]) ;
+    if (etype == GrB_UINT64) return ((double) ((uint64_t *) Ax) [e]) ;
+    if (etype == GrB_FP32  ) return ((double) ((float    *) Ax) [e]) ;
+    return (((double *) Ax) [e]) ;
+}
+
+// largest lower bound on d(x,y), given Dx = D(x,:) and Dy = D(y,:) where
+// D(i,j) is the path length from node i to landmark j (or from landmark j to
+// node i, with x and y swapped).  d(x,y) >= D(x,j) - D(y,j) holds if D(y,j)
+// is finite, and it is INFINITY if D(x,j) is not.
+static inline double LG_alt_bound (const double *Dx, const double *Dy,
+    bool iso, int64_t k)
+{
+    double pi = 0 ;
+    for (int64_t j = 0 ; j < k ; j++)
+    {
+        double dy = Dy [iso ? 0 : j] ;
+        if (dy < INFINITY) pi = LAGRAPH_MAX (pi, Dx [iso ? 0 : j] - dy) ;
+    }
+    return (pi) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// LAGr_PointToPointShortestPath
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                                        \
+{                                                                           \
+    LAGraph_Free ((void **) &slot_of, NULL) ;                               \
+    LAGraph_Free ((void **) &Node, NULL) ;                                  \
+    LAGraph_Free ((void **) &(Heap [0].e), NULL) ;                          \
+    LAGraph_Free ((void **) &(Heap [1].e), NULL) ;                          \
+    if (Ap != NULL)                                                         \
+    {                                                                       \
+        GxB_Matrix_pack_CSR (G->A, &Ap, &Aj, &Ax, Ap_size, Aj_size,         \
+            Ax_size, A_iso, A_jumbled, NULL) ;                              \
+    }                                                                       \
+    if (ATp != NULL)                                                        \
+    {                                                                       \
+        GxB_Matrix_pack_CSR (G->AT, &ATp, &ATj, &ATx, ATp_size, ATj_size,   \
+            ATx_size, AT_iso, AT_jumbled, NULL) ;                           \
+    }                                                                       \
+    if (Fx != NULL)                                                         \
+    {                                                                       \
+        GxB_Matrix_pack_FullR (Dfrom, (void **) &Fx, Fx_size, F_iso,        \
+            NULL) ;                                                         \
+    }                                                                       \
+    if (Tx != NULL)                                                         \
+    {                                                                       \
+        GxB_Matrix_pack_FullR (Dto, (void **) &Tx, Tx_size, T_iso, NULL) ;  \
+    }                                                                       \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL LG_FREE_WORK
+
+int LAGr_PointToPointShortestPath
+(
+    // output:
+    double *path_length,        // length of the shortest path from src to
+                                // dest, or INFINITY if dest is not reachable
+    // input:
+    const LAGraph_Graph G,      // input graph, modified then restored
+    GrB_Index src,              // source node
+    GrB_Index dest,             // destination node
+    GrB_Matrix Dfrom,           // landmark distances from LAGr_Landmarks, or
+                                // NULL; modified then restored
+    GrB_Matrix Dto,             // from LAGr_Landmarks, if G is directed;
+                                // modified then restored
+    char *msg
+)
+{
+
+#if !LAGRAPH_SUITESPARSE
+    return (GrB_NOT_IMPLEMENTED) ;
+#else
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *Ap = NULL, *Aj = NULL, Ap_size, Aj_size, Ax_size ;
+    GrB_Index *ATp = NULL, *ATj = NULL, ATp_size, ATj_size, ATx_size ;
+    void *Ax = NULL, *ATx = NULL ;
+    bool A_iso = false, A_jumbled = false, AT_iso = false, AT_jumbled = false ;
+    double *Fx = NULL, *Tx = NULL ;
+    GrB_Index Fx_size, Tx_size ;
+    bool F_iso = false, T_iso = false ;
+    int64_t *slot_of = NULL ;
+    LG_alt_node *Node = NULL ;
+    LG_alt_heap Heap [2] ;
+    memset (Heap, 0, 2 * sizeof (LG_alt_heap)) ;
+
+    LG_ASSERT (path_length != NULL, GrB_NULL_POINTER) ;
+    (*path_length) = INFINITY ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    LG_ASSERT_MSG (src < n && dest < n, GrB_INVALID_INDEX,
+        "invalid src or dest node") ;
+
+    bool directed = (G->kind == LAGraph_ADJACENCY_DIRECTED) ;
+    if (directed)
+    {
+        LG_ASSERT_MSG (G->AT != NULL, LAGRAPH_NOT_CACHED,
+            "G->AT is required") ;
+    }
+
+    // get the type of the A matrix
+    GrB_Type etype ;
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, G->A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&etype, typename, msg)) ;
+    LG_ASSERT_MSG (etype == GrB_INT32  || etype == GrB_INT64  ||
+                   etype == GrB_UINT32 || etype == GrB_UINT64 ||
+                   etype == GrB_FP32   || etype == GrB_FP64,
+        GrB_NOT_IMPLEMENTED, "type not supported") ;
+
+    // check the landmark distances
+    GrB_Index k = 0 ;
+    if (Dfrom != NULL)
+    {
+        LG_ASSERT_MSG (Dto != NULL || !directed, GrB_NULL_POINTER,
+            "Dto is required if G is directed") ;
+        GrB_Index nrows, ncols ;
+        for (int kind = 0 ; kind <= 1 ; kind++)
+        {
+            GrB_Matrix D = (kind == 0) ? Dfrom : Dto ;
+            if (D == NULL) continue ;
+            GRB_TRY (GrB_Matrix_nrows (&nrows, D)) ;
+            GRB_TRY (GrB_Matrix_ncols (&ncols, D)) ;
+            if (kind == 0) k = ncols ;
+            LG_ASSERT_MSG (nrows == n && ncols == k, GrB_DIMENSION_MISMATCH,
+                "landmark distances have the wrong size") ;
+            LG_TRY (LAGraph_Matrix_TypeName (typename, D, msg)) ;
+            LG_ASSERT_MSG (MATCHNAME (typename, "double"),
+                GrB_DOMAIN_MISMATCH, "landmark distances must be GrB_FP64") ;
+        }
+    }
+
+    if (src == dest)
+    {
+        (*path_length) = 0 ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // unpack the graph and the landmark distances
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GxB_Matrix_unpack_CSR (G->A, &Ap, &Aj, &Ax, &Ap_size, &Aj_size,
+        &Ax_size, &A_iso, &A_jumbled, NULL)) ;
+    if (directed)
+    {
+        GRB_TRY (GxB_Matrix_unpack_CSR (G->AT, &ATp, &ATj, &ATx, &ATp_size,
+            &ATj_size, &ATx_size, &AT_iso, &AT_jumbled, NULL)) ;
+    }
+    if (k > 0)
+    {
+        GRB_TRY (GxB_Matrix_unpack_FullR (Dfrom, (void **) &Fx, &Fx_size,
+            &F_iso, NULL)) ;
+        if (directed)
+        {
+            GRB_TRY (GxB_Matrix_unpack_FullR (Dto, (void **) &Tx, &Tx_size,
+                &T_iso, NULL)) ;
+        }
+    }
+
+    // the forward search uses A, and the reverse search uses A'
+    const GrB_Index *Sp [2] = { Ap, directed ? ATp : Ap } ;
+    const GrB_Index *Sj [2] = { Aj, directed ? ATj : Aj } ;
+    const void *Sx [2] = { Ax, directed ? ATx : Ax } ;
+    const bool S_iso [2] = { A_iso, directed ? AT_iso : A_iso } ;
+
+    // the distances from the landmarks (F) and to the landmarks (T)
+    const double *F = Fx, *T = directed ? Tx : Fx ;
+    const bool f_iso = F_iso, t_iso = directed ? T_iso : F_iso ;
+    #define LG_ROW(X,x_iso,i) ((X) + ((x_iso) ? 0 : (i) * k))
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    // slot_of [i] is zero if node i has not been visited, or 1 + its position
+    // in the Node table otherwise
+    LG_TRY (LAGraph_Calloc ((void **) &slot_of, n, sizeof (int64_t), msg)) ;
+    int64_t nnodes = 0, nodes_max = 0 ;
+
+    // create a new slot for node i, and find its lower bounds
+    #define LG_VISIT(i)                                                     \
+    {                                                                       \
+        if (nnodes == nodes_max)                                            \
+        {                                                                   \
+            int64_t nmax = LAGRAPH_MAX (2 * nodes_max, 1024) ;              \
+            LG_TRY (LAGraph_Realloc ((void **) &Node, nmax, nodes_max,      \
+                sizeof (LG_alt_node), msg)) ;                               \
+            nodes_max = nmax ;                                              \
+        }                                                                   \
+        LG_alt_node *V = &(Node [nnodes]) ;                                 \
+        V->node = (i) ;                                                     \
+        V->dist [0] = INFINITY ;                                            \
+        V->dist [1] = INFINITY ;                                            \
+        V->done [0] = false ;                                               \
+        V->done [1] = false ;                                               \
+        V->pi [0] = 0 ;                                                     \
+        V->pi [1] = 0 ;                                                     \
+        if (k > 0)                                                          \
+        {                                                                   \
+            const double *Fi = LG_ROW (F, f_iso, i) ;                       \
+            const double *Ti = LG_ROW (T, t_iso, i) ;                       \
+            V->pi [0] = LAGRAPH_MAX (                                       \
+                LG_alt_bound (Fdest, Fi, f_iso, k),                         \
+                LG_alt_bound (Ti, Tdest, t_iso, k)) ;                       \
+            V->pi [1] = LAGRAPH_MAX (                                       \
+                LG_alt_bound (Fi, Fsrc, f_iso, k),                          \
+                LG_alt_bound (Tsrc, Ti, t_iso, k)) ;                        \
+        }                                                                   \
+        slot_of [i] = ++nnodes ;                                            \
+    }
+
+    const double *Fsrc = NULL, *Fdest = NULL, *Tsrc = NULL, *Tdest = NULL ;
+    if (k > 0)
+    {
+        Fsrc  = LG_ROW (F, f_iso, src) ;
+        Fdest = LG_ROW (F, f_iso, dest) ;
+        Tsrc  = LG_ROW (T, t_iso, src) ;
+        Tdest = LG_ROW (T, t_iso, dest) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // start the forward search at src and the reverse search at dest
+    //--------------------------------------------------------------------------
+
+    LG_VISIT (src) ;
+    LG_VISIT (dest) ;
+    double mu = INFINITY ;
+    if (Node [0].pi [0] < INFINITY)
+    {
+        // the potential p(v) of each node v is (pi [0] - pi [1]) / 2
+        Node [0].dist [0] = 0 ;
+        Node [1].dist [1] = 0 ;
+        LG_TRY (LG_alt_push (&(Heap [0]),
+            (Node [0].pi [0] - Node [0].pi [1]) / 2, 0, msg)) ;
+        LG_TRY (LG_alt_push (&(Heap [1]),
+            (Node [1].pi [1] - Node [1].pi [0]) / 2, 1, msg)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // bidirectional search
+    //--------------------------------------------------------------------------
+
+    for (int side = 0 ; Heap [0].nheap > 0 && Heap [1].nheap > 0 ;
+        side = 1 - side)
+    {
+
+        // stop if no shorter path can be found
+        if (Heap [0].e [0].key + Heap [1].e [0].key >= mu) break ;
+
+        // get the next node u of this search, skipping stale entries
+        LG_alt_entry top = LG_alt_pop (&(Heap [side])) ;
+        LG_alt_node *U = &(Node [top.slot]) ;
+        double pu = (side == 0 ? 1 : -1) * (U->pi [0] - U->pi [1]) / 2 ;
+        if (U->done [side] || top.key > U->dist [side] + pu) continue ;
+        U->done [side] = true ;
+        double du = U->dist [side] ;
+        int64_t u = U->node ;
+
+        // relax the edges of u
+        const GrB_Index *LG_RESTRICT Xp = Sp [side] ;
+        const GrB_Index *LG_RESTRICT Xj = Sj [side] ;
+        for (int64_t e = Xp [u] ; e < Xp [u+1] ; e++)
+        {
+            int64_t v = Xj [e] ;
+            if (slot_of [v] == 0) LG_VISIT (v) ;
+            int64_t slot = slot_of [v] - 1 ;
+            LG_alt_node *V = &(Node [slot]) ;
+            // prune v if it cannot lie on a path from src to dest
+            if (V->pi [side] == INFINITY) continue ;
+            double t = du + LG_alt_weight (Sx [side], S_iso [side], e, etype) ;
+            if (t < V->dist [side])
+            {
+                V->dist [side] = t ;
+                double pv = (side == 0 ? 1 : -1) * (V->pi [0] - V->pi [1]) / 2 ;
+                LG_TRY (LG_alt_push (&(Heap [side]), t + pv, slot, msg)) ;
+                // update the shortest path found so far
+                mu = LAGRAPH_MIN (mu, t + V->dist [1-side]) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*path_length) = mu ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+#endif
+}
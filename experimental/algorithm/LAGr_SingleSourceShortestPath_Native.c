@@ -0,0 +1,360 @@
+//------------------------------------------------------------------------------
+// LAGr_SingleSourceShortestPath_Native: delta stepping on the CSR of A
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (Delta must be provided).
+
+// LAGr_SingleSourceShortestPath_Native computes the same result as
+// LAGr_SingleSourceShortestPath, with the same inputs, but it works directly
+// on the CSR form of G->A instead of using GraphBLAS operations.  Each step of
+// LAGr_SingleSourceShortestPath takes about a dozen GraphBLAS calls, even when
+// the bucket holds just a few nodes.  This overhead dominates for graphs with
+// many small buckets, such as road networks with integer weights.  Here, G->A
+// is unpacked once, the light and heavy edges are not split into two
+// matrices, and each step is a few passes over the nodes in the bucket and
+// their edges.  The kernel is in LG_sssp_native_template.h.
+
+// Each task owns a contiguous range of nodes, with its own bucket lists.
+// Relaxations are sent to the owner of each node through per-task request
+// lists, instead of using an atomic min, since only the owner of a node
+// modifies its path length.
+
+// G->A is unpacked and then packed back, so it is modified (but restored)
+// while this method runs.  It may change from hypersparse or bitmap to sparse.
+// If SuiteSparse:GraphBLAS is not in use, LAGr_SingleSourceShortestPath is
+// used instead.
+
+// NOTE: like LAGr_SingleSourceShortestPath, this method gets stuck in an
+// infinite loop when there are negative-weight cycles in the graph.
+
+#define LG_FREE_WORK                                                        \
+{                                                                           \
+    LG_sssp_free_work (&W) ;                                                \
+    LAGraph_Free ((void **) &relaxed, NULL) ;                               \
+    if (Ap != NULL)                                                         \
+    {                                                                       \
+        /* pack A back into G->A */                                         \
+        GxB_Matrix_pack_CSR (A, &Ap, &Aj, &Ax, Ap_size, Aj_size, Ax_size,   \
+            A_iso, A_jumbled, NULL) ;                                       \
+    }                                                                       \
+}
+
+#define LG_FREE_ALL                                                         \
+{                                                                           \
+    LG_FREE_WORK ;                                                          \
+    LAGraph_Free ((void **) &dist, NULL) ;                                  \
+    GrB_free (path_length) ;                                                \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+#if LAGRAPH_SUITESPARSE
+
+// number of near buckets for each task
+#define LG_NBUCKETS 64
+
+// minimum number of nodes or requests for each thread
+#define LG_SSSP_CHUNK 256
+
+//------------------------------------------------------------------------------
+// LG_sssp_list: a growable list of nodes
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    int64_t *v ;        // nodes in the list
+    void *x ;           // requested path lengths (NULL for a bucket)
+    int64_t nv ;        // number of nodes in the list
+    int64_t nmax ;      // size of v and x
+}
+LG_sssp_list ;
+
+// append node j to the list L, with space for a value of size xsize
+static inline bool LG_sssp_append (LG_sssp_list *L, int64_t j, size_t xsize)
+{
+    if (L->nv == L->nmax)
+    {
+        int64_t nmax = LAGRAPH_MAX (2 * L->nmax, LG_SSSP_CHUNK) ;
+        if (LAGraph_Realloc ((void **) &(L->v), nmax, L->nmax,
+            sizeof (int64_t), NULL) != GrB_SUCCESS)
+        {
+            return (false) ;
+        }
+        if (xsize > 0 && LAGraph_Realloc (&(L->x), nmax, L->nmax, xsize,
+            NULL) != GrB_SUCCESS)
+        {
+            return (false) ;
+        }
+        L->nmax = nmax ;
+    }
+    L->v [L->nv++] = j ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_sssp_work: workspace for the kernel
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    int ntasks ;            // number of tasks
+    int64_t bsize ;         // node i is owned by task i/bsize
+    LG_sssp_list *bucket ;  // size ntasks*(LG_NBUCKETS+1); see LG_BUCKET
+    LG_sssp_list *request ; // size ntasks*ntasks; see LG_REQUEST
+    int64_t *F ;            // the current frontier, of size n
+    int64_t *count ;        // size ntasks
+    bool *ok ;              // size ntasks; false if a task runs out of memory
+}
+LG_sssp_work ;
+
+// near bucket base+k of owner o, or its far list if k is LG_NBUCKETS
+#define LG_BUCKET(W,o,k) (&((W)->bucket [(o) * (LG_NBUCKETS+1) + (k)]))
+
+// requests from task p for nodes owned by task o
+#define LG_REQUEST(W,p,o) (&((W)->request [(p) * (W)->ntasks + (o)]))
+
+static void LG_sssp_free_work (LG_sssp_work *W)
+{
+    int nlists = W->ntasks * (LG_NBUCKETS+1) ;
+    for (int k = 0 ; W->bucket != NULL && k < nlists ; k++)
+    {
+        LAGraph_Free ((void **) &(W->bucket [k].v), NULL) ;
+    }
+    nlists = W->ntasks * W->ntasks ;
+    for (int k = 0 ; W->request != NULL && k < nlists ; k++)
+    {
+        LAGraph_Free ((void **) &(W->request [k].v), NULL) ;
+        LAGraph_Free ((void **) &(W->request [k].x), NULL) ;
+    }
+    LAGraph_Free ((void **) &(W->bucket), NULL) ;
+    LAGraph_Free ((void **) &(W->request), NULL) ;
+    LAGraph_Free ((void **) &(W->F), NULL) ;
+    LAGraph_Free ((void **) &(W->count), NULL) ;
+    LAGraph_Free ((void **) &(W->ok), NULL) ;
+}
+
+// true if near bucket base+k of any owner is nonempty
+static bool LG_sssp_nonempty (LG_sssp_work *W, int64_t k)
+{
+    for (int o = 0 ; o < W->ntasks ; o++)
+    {
+        if (LG_BUCKET (W, o, k)->nv > 0) return (true) ;
+    }
+    return (false) ;
+}
+
+// the bucket of a path length d, floor (d/delta), clipped to +/- 2^62
+static inline int64_t LG_sssp_bucket (double d, double delta)
+{
+    double q = floor (d / delta) ;
+    if (q >  4611686018427387904.0) return ( ((int64_t) 1) << 62) ;
+    if (q < -4611686018427387904.0) return (-(((int64_t) 1) << 62)) ;
+    return ((int64_t) q) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_sssp_*: the kernels for each type
+//------------------------------------------------------------------------------
+
+#define LG_T int32_t
+#define LG_SSSP_KERNEL LG_sssp_int32
+#include "LG_sssp_native_template.h"
+
+#define LG_T int64_t
+#define LG_SSSP_KERNEL LG_sssp_int64
+#include "LG_sssp_native_template.h"
+
+#define LG_T uint32_t
+#define LG_SSSP_KERNEL LG_sssp_uint32
+#include "LG_sssp_native_template.h"
+
+#define LG_T uint64_t
+#define LG_SSSP_KERNEL LG_sssp_uint64
+#include "LG_sssp_native_template.h"
+
+#define LG_T float
+#define LG_SSSP_KERNEL LG_sssp_fp32
+#include "LG_sssp_native_template.h"
+
+#define LG_T double
+#define LG_SSSP_KERNEL LG_sssp_fp64
+#include "LG_sssp_native_template.h"
+
+#endif
+
+//------------------------------------------------------------------------------
+// LAGr_SingleSourceShortestPath_Native
+//------------------------------------------------------------------------------
+
+int LAGr_SingleSourceShortestPath_Native
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    // input:
+    const LAGraph_Graph G,      // input graph, modified then restored
+    GrB_Index source,           // source vertex
+    GrB_Scalar Delta,           // delta value for delta stepping
+    char *msg
+)
+{
+
+#if !LAGRAPH_SUITESPARSE
+
+    return (LAGr_SingleSourceShortestPath (path_length, G, source, Delta,
+        msg)) ;
+
+#else
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    LG_sssp_work W ;
+    memset (&W, 0, sizeof (LG_sssp_work)) ;
+    GrB_Index *Ap = NULL, *Aj = NULL, Ap_size, Aj_size, Ax_size ;
+    void *Ax = NULL ;
+    bool A_iso = false, A_jumbled = false ;
+    void *dist = NULL, *relaxed = NULL ;
+    GrB_Matrix A = NULL ;
+
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (path_length != NULL && Delta != NULL, GrB_NULL_POINTER) ;
+    (*path_length) = NULL ;
+
+    GrB_Index nvals ;
+    LG_TRY (GrB_Scalar_nvals (&nvals, Delta)) ;
+    LG_ASSERT_MSG (nvals == 1, GrB_EMPTY_OBJECT, "Delta is missing") ;
+
+    A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    LG_ASSERT_MSG (source < n, GrB_INVALID_INDEX, "invalid source node") ;
+
+    // get the type of the A matrix
+    GrB_Type etype ;
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&etype, typename, msg)) ;
+    LG_ASSERT_MSG (etype == GrB_INT32  || etype == GrB_INT64  ||
+                   etype == GrB_UINT32 || etype == GrB_UINT64 ||
+                   etype == GrB_FP32   || etype == GrB_FP64,
+        GrB_NOT_IMPLEMENTED, "type not supported") ;
+
+    double delta ;
+    GRB_TRY (GrB_Scalar_extractElement_FP64 (&delta, Delta)) ;
+    LG_ASSERT_MSG (delta > 0, GrB_INVALID_VALUE, "Delta must be positive") ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int64_t nthreads = ((int64_t) nthreads_outer) * nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, n / LG_SSSP_CHUNK) ;
+    W.ntasks = (int) LAGRAPH_MAX (nthreads, 1) ;
+    W.bsize = (n + W.ntasks - 1) / W.ntasks ;
+
+    size_t esize ;
+    GRB_TRY (GxB_Type_size (&esize, etype)) ;
+    LG_TRY (LAGraph_Malloc (&dist, n, esize, msg)) ;
+    LG_TRY (LAGraph_Malloc (&relaxed, n, esize, msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &(W.F), n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &(W.count), W.ntasks, sizeof (int64_t),
+        msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &(W.ok), W.ntasks, sizeof (bool), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &(W.bucket), W.ntasks * (LG_NBUCKETS+1),
+        sizeof (LG_sssp_list), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &(W.request), W.ntasks * W.ntasks,
+        sizeof (LG_sssp_list), msg)) ;
+    for (int k = 0 ; k < W.ntasks ; k++)
+    {
+        W.ok [k] = true ;
+    }
+
+    //--------------------------------------------------------------------------
+    // unpack A in CSR format
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GxB_Matrix_unpack_CSR (A, &Ap, &Aj, &Ax, &Ap_size, &Aj_size,
+        &Ax_size, &A_iso, &A_jumbled, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // compute the path lengths
+    //--------------------------------------------------------------------------
+
+    if (etype == GrB_INT32)
+    {
+        int32_t delta_int32 ;
+        GRB_TRY (GrB_Scalar_extractElement (&delta_int32, Delta)) ;
+        LG_TRY (LG_sssp_int32 (dist, Ap, Aj, Ax, A_iso, n, source,
+            delta_int32, INT32_MAX, relaxed, &W)) ;
+    }
+    else if (etype == GrB_INT64)
+    {
+        int64_t delta_int64 ;
+        GRB_TRY (GrB_Scalar_extractElement (&delta_int64, Delta)) ;
+        LG_TRY (LG_sssp_int64 (dist, Ap, Aj, Ax, A_iso, n, source,
+            delta_int64, INT64_MAX, relaxed, &W)) ;
+    }
+    else if (etype == GrB_UINT32)
+    {
+        uint32_t delta_uint32 ;
+        GRB_TRY (GrB_Scalar_extractElement (&delta_uint32, Delta)) ;
+        LG_TRY (LG_sssp_uint32 (dist, Ap, Aj, Ax, A_iso, n, source,
+            delta_uint32, UINT32_MAX, relaxed, &W)) ;
+    }
+    else if (etype == GrB_UINT64)
+    {
+        uint64_t delta_uint64 ;
+        GRB_TRY (GrB_Scalar_extractElement (&delta_uint64, Delta)) ;
+        LG_TRY (LG_sssp_uint64 (dist, Ap, Aj, Ax, A_iso, n, source,
+            delta_uint64, UINT64_MAX, relaxed, &W)) ;
+    }
+    else if (etype == GrB_FP32)
+    {
+        float delta_fp32 ;
+        GRB_TRY (GrB_Scalar_extractElement (&delta_fp32, Delta)) ;
+        LG_TRY (LG_sssp_fp32 (dist, Ap, Aj, Ax, A_iso, n, source,
+            delta_fp32, INFINITY, relaxed, &W)) ;
+    }
+    else // if (etype == GrB_FP64)
+    {
+        double delta_fp64 ;
+        GRB_TRY (GrB_Scalar_extractElement (&delta_fp64, Delta)) ;
+        LG_TRY (LG_sssp_fp64 (dist, Ap, Aj, Ax, A_iso, n, source,
+            delta_fp64, INFINITY, relaxed, &W)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // pack A back into G->A, and pack dist into the full path_length vector
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GxB_Matrix_pack_CSR (A, &Ap, &Aj, &Ax, Ap_size, Aj_size, Ax_size,
+        A_iso, A_jumbled, NULL)) ;
+    GRB_TRY (GrB_Vector_new (path_length, etype, n)) ;
+    GRB_TRY (GxB_Vector_pack_Full (*path_length, &dist, n * esize, false,
+        NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+#endif
+}
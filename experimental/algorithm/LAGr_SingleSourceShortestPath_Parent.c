@@ -0,0 +1,487 @@
+//------------------------------------------------------------------------------
+// LAGr_SingleSourceShortestPath_Parent: SSSP with a shortest-path tree
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->emin is required).
+
+// LAGr_SingleSourceShortestPath_Parent is the same delta-stepping method as
+// LAGr_SingleSourceShortestPath, but it also computes the parent vector of a
+// shortest-path tree, while the path lengths are computed.  No second pass
+// over the edges is needed to find the parents.
+
+// Each tentative path length is held as a (dist, parent) tuple, of a
+// user-defined type.  The semiring is a min-with-argmin: the multiplicative
+// operator computes (dist + A(i,j), i) and the monoid selects the tuple with
+// the smallest dist, with ties broken by the smallest parent.  Since this
+// monoid is a total order, the result of each GrB_vxm does not depend on the
+// number of threads or the order in which the entries are summed.  Before
+// each GrB_vxm, the parent of each tuple in the current bucket is replaced
+// with the node itself, so that the product carries the node the path came
+// from.
+
+// A tentative path length t(j) is replaced only by one that is strictly
+// smaller.  As a result, the parent of a node is always settled before the
+// node itself, and zero-weight edges or cycles cannot create a cycle in the
+// tree.  The parent vector is deterministic: if several shortest paths reach
+// the node j, the parent is the one found first by delta stepping, and among
+// those found in the same relaxation step, the one with the smallest node id.
+
+// The path lengths are computed in double precision internally and then
+// typecast to the type of G->A.  For GrB_INT64 and GrB_UINT64 edge weights,
+// path lengths are exact only if they are at most 2^53 in magnitude.
+
+// If parent is NULL, LAGr_SingleSourceShortestPath is used instead.
+
+// parent (src) = src, and parent (i) for an unreachable node i is not present
+// in the parent vector.  path_length is as in LAGr_SingleSourceShortestPath.
+
+// NOTE: this method gets stuck in an infinite loop when there are negative-
+// weight cycles in the graph.
+
+#define LG_FREE_WORK                    \
+{                                       \
+    GrB_free (&AL) ;                    \
+    GrB_free (&AH) ;                    \
+    GrB_free (&t) ;                     \
+    GrB_free (&tmasked) ;               \
+    GrB_free (&tReq) ;                  \
+    GrB_free (&tless) ;                 \
+    GrB_free (&s) ;                     \
+    GrB_free (&reach) ;                 \
+    GrB_free (&Empty) ;                 \
+    GrB_free (&Tuple) ;                 \
+    GrB_free (&tuple_min) ;             \
+    GrB_free (&tuple_min_monoid) ;      \
+    GrB_free (&tuple_plus) ;            \
+    GrB_free (&tuple_min_plus) ;        \
+    GrB_free (&tuple_lt) ;              \
+    GrB_free (&dist_lt) ;               \
+    GrB_free (&dist_ge) ;               \
+    GrB_free (&set_parent) ;            \
+    GrB_free (&get_dist) ;              \
+    GrB_free (&get_parent) ;            \
+}
+
+#define LG_FREE_ALL                     \
+{                                       \
+    LG_FREE_WORK ;                      \
+    GrB_free (path_length) ;            \
+    GrB_free (parent) ;                 \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// (dist, parent) tuples and their operators
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    double dist ;       // tentative path length
+    int64_t parent ;    // parent node, or the node itself in a bucket
+}
+LG_SSSP_tuple ;
+
+// z = the tuple with the smaller dist, or the smaller parent if tied
+static void LG_tuple_min_f (void *z, const void *x, const void *y)
+{
+    const LG_SSSP_tuple *a = (const LG_SSSP_tuple *) x ;
+    const LG_SSSP_tuple *b = (const LG_SSSP_tuple *) y ;
+    bool b_is_less = (b->dist < a->dist) ||
+        (b->dist == a->dist && b->parent < a->parent) ;
+    LG_SSSP_tuple result = b_is_less ? (*b) : (*a) ;
+    (*(LG_SSSP_tuple *) z) = result ;
+}
+
+// z = (x.dist + y, x.parent), where y is an edge weight
+static void LG_tuple_plus_f (void *z, const void *x, const void *y)
+{
+    const LG_SSSP_tuple *a = (const LG_SSSP_tuple *) x ;
+    LG_SSSP_tuple result ;
+    result.dist = a->dist + (*(const double *) y) ;
+    result.parent = a->parent ;
+    (*(LG_SSSP_tuple *) z) = result ;
+}
+
+// z = (x.dist < y.dist)
+static void LG_tuple_lt_f (void *z, const void *x, const void *y)
+{
+    (*(bool *) z) = ((const LG_SSSP_tuple *) x)->dist <
+                    ((const LG_SSSP_tuple *) y)->dist ;
+}
+
+// z = (x.dist < thunk)
+static void LG_dist_lt_f (void *z, const void *x, GrB_Index i, GrB_Index j,
+    const void *thunk)
+{
+    (*(bool *) z) = ((const LG_SSSP_tuple *) x)->dist <
+                    (*(const double *) thunk) ;
+}
+
+// z = (x.dist >= thunk)
+static void LG_dist_ge_f (void *z, const void *x, GrB_Index i, GrB_Index j,
+    const void *thunk)
+{
+    (*(bool *) z) = ((const LG_SSSP_tuple *) x)->dist >=
+                    (*(const double *) thunk) ;
+}
+
+// z = (x.dist, i), for the entry x = t(i)
+static void LG_set_parent_f (void *z, const void *x, GrB_Index i, GrB_Index j,
+    const void *thunk)
+{
+    LG_SSSP_tuple result ;
+    result.dist = ((const LG_SSSP_tuple *) x)->dist ;
+    result.parent = (int64_t) i ;
+    (*(LG_SSSP_tuple *) z) = result ;
+}
+
+// z = x.dist
+static void LG_get_dist_f (void *z, const void *x)
+{
+    (*(double *) z) = ((const LG_SSSP_tuple *) x)->dist ;
+}
+
+// z = x.parent
+static void LG_get_parent_f (void *z, const void *x)
+{
+    (*(int64_t *) z) = ((const LG_SSSP_tuple *) x)->parent ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_SingleSourceShortestPath_Parent
+//------------------------------------------------------------------------------
+
+int LAGr_SingleSourceShortestPath_Parent
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    GrB_Vector *parent,         // parent (i) is the parent of node i in the
+                                // shortest-path tree.  Not computed if NULL.
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    GrB_Index source,           // source vertex
+    GrB_Scalar Delta,           // delta value for delta stepping
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix AL = NULL, AH = NULL ;
+    GrB_Vector t = NULL, tmasked = NULL, tReq = NULL, tless = NULL ;
+    GrB_Vector s = NULL, reach = NULL, Empty = NULL ;
+    GrB_Type Tuple = NULL ;
+    GrB_BinaryOp tuple_min = NULL, tuple_plus = NULL, tuple_lt = NULL ;
+    GrB_Monoid tuple_min_monoid = NULL ;
+    GrB_Semiring tuple_min_plus = NULL ;
+    GrB_IndexUnaryOp dist_lt = NULL, dist_ge = NULL, set_parent = NULL ;
+    GrB_UnaryOp get_dist = NULL, get_parent = NULL ;
+
+    if (parent == NULL)
+    {
+        // no parent vector is needed
+        return (LAGr_SingleSourceShortestPath (path_length, G, source, Delta,
+            msg)) ;
+    }
+
+    (*parent) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (path_length != NULL && Delta != NULL, GrB_NULL_POINTER) ;
+    (*path_length) = NULL ;
+
+    GrB_Index nvals ;
+    LG_TRY (GrB_Scalar_nvals (&nvals, Delta)) ;
+    LG_ASSERT_MSG (nvals == 1, GrB_EMPTY_OBJECT, "Delta is missing") ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    LG_ASSERT_MSG (source < n, GrB_INVALID_INDEX, "invalid source node") ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    // get the type of the A matrix
+    GrB_Type etype ;
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&etype, typename, msg)) ;
+    LG_ASSERT_MSG (etype == GrB_INT32 || etype == GrB_INT64 ||
+        etype == GrB_UINT32 || etype == GrB_UINT64 ||
+        etype == GrB_FP32 || etype == GrB_FP64,
+        GrB_NOT_IMPLEMENTED, "type not supported") ;
+
+    double delta ;
+    GRB_TRY (GrB_Scalar_extractElement_FP64 (&delta, Delta)) ;
+
+    // check if the graph might have negative edge weights
+    bool negative_edge_weights =
+        !(etype == GrB_UINT32 || etype == GrB_UINT64) ;
+    if (negative_edge_weights)
+    {
+        double emin = -1 ;
+        if (G->emin != NULL &&
+            (G->emin_state == LAGraph_VALUE ||
+             G->emin_state == LAGraph_BOUND))
+        {
+            GRB_TRY (GrB_Scalar_extractElement_FP64 (&emin, G->emin)) ;
+        }
+        negative_edge_weights = (emin < 0) ;
+    }
+
+    // create the tuple type and its operators
+    GRB_TRY (GrB_Type_new (&Tuple, sizeof (LG_SSSP_tuple))) ;
+    GRB_TRY (GrB_BinaryOp_new (&tuple_min, LG_tuple_min_f,
+        Tuple, Tuple, Tuple)) ;
+    LG_SSSP_tuple infinity = { INFINITY, INT64_MAX } ;
+    GRB_TRY (GrB_Monoid_new_UDT (&tuple_min_monoid, tuple_min, &infinity)) ;
+    GRB_TRY (GrB_BinaryOp_new (&tuple_plus, LG_tuple_plus_f,
+        Tuple, Tuple, GrB_FP64)) ;
+    GRB_TRY (GrB_Semiring_new (&tuple_min_plus, tuple_min_monoid,
+        tuple_plus)) ;
+    GRB_TRY (GrB_BinaryOp_new (&tuple_lt, LG_tuple_lt_f,
+        GrB_BOOL, Tuple, Tuple)) ;
+    GRB_TRY (GrB_IndexUnaryOp_new (&dist_lt, LG_dist_lt_f,
+        GrB_BOOL, Tuple, GrB_FP64)) ;
+    GRB_TRY (GrB_IndexUnaryOp_new (&dist_ge, LG_dist_ge_f,
+        GrB_BOOL, Tuple, GrB_FP64)) ;
+    GRB_TRY (GrB_IndexUnaryOp_new (&set_parent, LG_set_parent_f,
+        Tuple, Tuple, GrB_BOOL)) ;
+    GRB_TRY (GrB_UnaryOp_new (&get_dist, LG_get_dist_f, GrB_FP64, Tuple)) ;
+    GRB_TRY (GrB_UnaryOp_new (&get_parent, LG_get_parent_f, GrB_INT64,
+        Tuple)) ;
+
+    GRB_TRY (GrB_Vector_new (&t, Tuple, n)) ;
+    GRB_TRY (GrB_Vector_new (&tmasked, Tuple, n)) ;
+    GRB_TRY (GrB_Vector_new (&tReq, Tuple, n)) ;
+    GRB_TRY (GrB_Vector_new (&Empty, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&tless, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&s, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&reach, GrB_BOOL, n)) ;
+
+#if LAGRAPH_SUITESPARSE
+    // optional hints for SuiteSparse:GraphBLAS
+    GRB_TRY (GxB_set (t, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    GRB_TRY (GxB_set (tmasked, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (tReq, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (tless, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (s, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    GRB_TRY (GxB_set (reach, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+#endif
+
+    // t (:) = (infinity, INT64_MAX)
+    GRB_TRY (GrB_Vector_assign_UDT (t, NULL, NULL, &infinity, GrB_ALL, n,
+        NULL)) ;
+
+    // t (src) = (0, src)
+    LG_SSSP_tuple t_source = { 0, (int64_t) source } ;
+    GRB_TRY (GrB_Vector_setElement_UDT (t, &t_source, source)) ;
+
+    // reach (src) = true
+    GRB_TRY (GrB_Vector_setElement (reach, true, source)) ;
+
+    // s (src) = true
+    GRB_TRY (GrB_Vector_setElement (s, true, source)) ;
+
+    // AL = A .* (A <= Delta)
+    GRB_TRY (GrB_Matrix_new (&AL, etype, n, n)) ;
+    GRB_TRY (GrB_select (AL, NULL, NULL, GrB_VALUELE_FP64, A, delta, NULL)) ;
+    GRB_TRY (GrB_wait (AL, GrB_MATERIALIZE)) ;
+
+    // AH = A .* (A > Delta)
+    GRB_TRY (GrB_Matrix_new (&AH, etype, n, n)) ;
+    GRB_TRY (GrB_select (AH, NULL, NULL, GrB_VALUEGT_FP64, A, delta, NULL)) ;
+    GRB_TRY (GrB_wait (AH, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // while (t >= step*Delta) not empty
+    //--------------------------------------------------------------------------
+
+    for (int64_t step = 0 ; ; step++)
+    {
+
+        //----------------------------------------------------------------------
+        // tmasked = all entries in t<reach> that are less than (step+1)*Delta
+        //----------------------------------------------------------------------
+
+        double uBound = (step+1) * delta ;
+        GRB_TRY (GrB_Vector_clear (tmasked)) ;
+
+        // tmasked<reach> = t
+        GRB_TRY (GrB_assign (tmasked, reach, NULL, t, GrB_ALL, n, NULL)) ;
+        // tmasked = select (tmasked < (step+1)*Delta)
+        GRB_TRY (GrB_select (tmasked, NULL, NULL, dist_lt, tmasked, uBound,
+            NULL)) ;
+
+        GrB_Index tmasked_nvals ;
+        GRB_TRY (GrB_Vector_nvals (&tmasked_nvals, tmasked)) ;
+
+        //----------------------------------------------------------------------
+        // continue while the current bucket (tmasked) is not empty
+        //----------------------------------------------------------------------
+
+        while (tmasked_nvals > 0)
+        {
+            // tmasked (i) = (tmasked (i).dist, i)
+            GRB_TRY (GrB_apply (tmasked, NULL, NULL, set_parent, tmasked,
+                (bool) false, NULL)) ;
+
+            // tReq = AL'*tmasked using the min-with-argmin semiring
+            GRB_TRY (GrB_vxm (tReq, NULL, NULL, tuple_min_plus, tmasked, AL,
+                NULL)) ;
+
+            // s<struct(tmasked)> = true
+            GRB_TRY (GrB_assign (s, tmasked, NULL, (bool) true, GrB_ALL, n,
+                GrB_DESC_S)) ;
+
+            // if nvals (tReq) is 0, no need to continue the rest of this loop
+            GrB_Index tReq_nvals ;
+            GRB_TRY (GrB_Vector_nvals (&tReq_nvals, tReq)) ;
+            if (tReq_nvals == 0) break ;
+
+            // tless = (tReq .< t) using set intersection
+            GRB_TRY (GrB_eWiseMult (tless, NULL, NULL, tuple_lt, tReq, t,
+                NULL)) ;
+
+            // remove explicit zeros from tless so it can be used as a
+            // structural mask
+            GrB_Index tless_nvals ;
+            GRB_TRY (GrB_select (tless, NULL, NULL, GrB_VALUEEQ_BOOL, tless,
+                true, NULL)) ;
+            GRB_TRY (GrB_Vector_nvals (&tless_nvals, tless)) ;
+            if (tless_nvals == 0) break ;
+
+            // update reachable node list/mask
+            // reach<struct(tless)> = true
+            GRB_TRY (GrB_assign (reach, tless, NULL, (bool) true, GrB_ALL, n,
+                GrB_DESC_S)) ;
+
+            // tmasked<struct(tless)> = select (tReq < (step+1)*Delta)
+            GRB_TRY (GrB_Vector_clear (tmasked)) ;
+            GRB_TRY (GrB_select (tmasked, tless, NULL, dist_lt, tReq, uBound,
+                GrB_DESC_S)) ;
+
+            // For general graph with some negative weights:
+            if (negative_edge_weights)
+            {
+                // tmasked = select entries in tmasked that are >= step*Delta
+                double lBound = step * delta ;
+                GRB_TRY (GrB_select (tmasked, NULL, NULL, dist_ge, tmasked,
+                    lBound, NULL)) ;
+            }
+
+            // t<struct(tless)> = tReq
+            GRB_TRY (GrB_assign (t, tless, NULL, tReq, GrB_ALL, n, GrB_DESC_S));
+            GRB_TRY (GrB_Vector_nvals (&tmasked_nvals, tmasked)) ;
+        }
+
+        // tmasked<s> = t, with tmasked (i) = (t (i).dist, i)
+        GRB_TRY (GrB_Vector_clear (tmasked)) ;
+        GRB_TRY (GrB_assign (tmasked, s, NULL, t, GrB_ALL, n, GrB_DESC_S)) ;
+        GRB_TRY (GrB_apply (tmasked, NULL, NULL, set_parent, tmasked,
+            (bool) false, NULL)) ;
+
+        // tReq = AH'*tmasked using the min-with-argmin semiring
+        GRB_TRY (GrB_vxm (tReq, NULL, NULL, tuple_min_plus, tmasked, AH,
+            NULL)) ;
+
+        // tless = (tReq .< t) using set intersection
+        GRB_TRY (GrB_eWiseMult (tless, NULL, NULL, tuple_lt, tReq, t, NULL)) ;
+
+        // t<tless> = tReq, which computes t = min (t, tReq)
+        GRB_TRY (GrB_assign (t, tless, NULL, tReq, GrB_ALL, n, NULL)) ;
+
+        //----------------------------------------------------------------------
+        // find out how many left to be computed
+        //----------------------------------------------------------------------
+
+        // update reachable node list
+        // reach<tless> = true
+        GRB_TRY (GrB_assign (reach, tless, NULL, (bool) true, GrB_ALL, n,
+            NULL)) ;
+
+        // remove previous buckets
+        // reach<struct(s)> = Empty
+        GRB_TRY (GrB_assign (reach, s, NULL, Empty, GrB_ALL, n, GrB_DESC_S)) ;
+        GrB_Index nreach ;
+        GRB_TRY (GrB_Vector_nvals (&nreach, reach)) ;
+        if (nreach == 0) break ;
+
+        GRB_TRY (GrB_Vector_clear (s)) ; // clear s for the next iteration
+    }
+
+    //--------------------------------------------------------------------------
+    // extract the path lengths and the parents of all reachable nodes
+    //--------------------------------------------------------------------------
+
+    // tmasked = the entries of t that are reachable from the source
+    GRB_TRY (GrB_Vector_clear (tmasked)) ;
+    GRB_TRY (GrB_select (tmasked, NULL, NULL, dist_lt, t, (double) INFINITY,
+        NULL)) ;
+
+    // path_length (:) = infinity, as in LAGr_SingleSourceShortestPath
+    GRB_TRY (GrB_Vector_new (path_length, etype, n)) ;
+    if (etype == GrB_INT32)
+    {
+        GRB_TRY (GrB_assign (*path_length, NULL, NULL, (int32_t) INT32_MAX,
+            GrB_ALL, n, NULL)) ;
+    }
+    else if (etype == GrB_INT64)
+    {
+        GRB_TRY (GrB_assign (*path_length, NULL, NULL, (int64_t) INT64_MAX,
+            GrB_ALL, n, NULL)) ;
+    }
+    else if (etype == GrB_UINT32)
+    {
+        GRB_TRY (GrB_assign (*path_length, NULL, NULL, (uint32_t) UINT32_MAX,
+            GrB_ALL, n, NULL)) ;
+    }
+    else if (etype == GrB_UINT64)
+    {
+        GRB_TRY (GrB_assign (*path_length, NULL, NULL, (uint64_t) UINT64_MAX,
+            GrB_ALL, n, NULL)) ;
+    }
+    else if (etype == GrB_FP32)
+    {
+        GRB_TRY (GrB_assign (*path_length, NULL, NULL, (float) INFINITY,
+            GrB_ALL, n, NULL)) ;
+    }
+    else
+    {
+        GRB_TRY (GrB_assign (*path_length, NULL, NULL, (double) INFINITY,
+            GrB_ALL, n, NULL)) ;
+    }
+
+    // path_length<struct(tmasked)> = tmasked.dist
+    GRB_TRY (GrB_apply (*path_length, tmasked, NULL, get_dist, tmasked,
+        GrB_DESC_S)) ;
+
+    // parent = tmasked.parent
+    GRB_TRY (GrB_Vector_new (parent, GrB_INT64, n)) ;
+    GRB_TRY (GrB_apply (*parent, NULL, NULL, get_parent, tmasked, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,450 @@
+//------------------------------------------------------------------------------
+// LAGr_StronglyConnectedComponents: strongly connected components of a graph
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Yongzhe Zhang (zyz915@gmail.com), as LAGraph_scc
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT is used if present).
+
+// On output, component(i) is the smallest node in the strongly connected
+// component (SCC) of node i.  The method has three phases:
+
+// (1) trim: a node with no in-edges or no out-edges (from or to nodes that
+//     are not yet trimmed) is an SCC by itself.  These nodes are removed
+//     repeatedly, until none are left.  This only needs the in-degree and
+//     out-degree of each node, computed with GrB_mxv on the remaining nodes.
+
+// (2) pivot: the remaining node with the largest product of in-degree and
+//     out-degree is likely to be in the largest SCC.  The nodes reachable
+//     from this pivot (Fr) and the nodes that can reach it (Br) are found by
+//     breadth-first search, and Fr and Br intersect in the SCC of the pivot
+//     (Fleischer, Hendrickson, Pinar, "On identifying strongly connected
+//     components in parallel", IPDPS 2000).  Any other SCC lies entirely in
+//     Fr\Br, Br\Fr, or the rest of the nodes, so the edges between these
+//     parts can be removed.
+
+// (3) coloring: the rest are found with the Min-Label algorithm described in
+//     the following paper:
+//     D. Yan, J. Cheng, K. Xin, Y. Lu, W. Ng, Y. Bu, "Pregel Algorithms for
+//     Graph Connectivity Problems with Performance Guarantees"
+//     Proc. VLDB Endow. 7, 14 (October 2014), 1821–1832.
+//     DOI: https://doi.org/10.14778/2733085.2733089
+//     After the forward and backward propagation, each node u has two labels:
+//     F[u], the smallest node that can reach u, and B[u], the smallest node
+//     that is reachable from u.  If two nodes u and v are in the same SCC,
+//     then F[u]==F[v] and B[u]==B[v] must hold.  The converse is not true
+//     unless F[u]==B[u], in which case u is in the SCC of F[u].  The edges
+//     (u,v) where either F[u]!=F[v] or B[u]!=B[v] are removed, which
+//     accelerates the next rounds.
+
+// Edges are removed in phases (2) and (3) with GrB_select and the
+// IndexUnaryOp LG_scc_keep.  The labels it needs are passed in its thunk, a
+// GrB_Scalar of a user-defined type that holds pointers to the labels, so
+// the method has no global state and can be called by multiple user threads
+// at the same time.
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+#if LAGRAPH_SUITESPARSE
+
+//------------------------------------------------------------------------------
+// LG_scc_keep: select the edges that can still be in an SCC
+//------------------------------------------------------------------------------
+
+// The edge (i,j) is kept if neither i nor j are in an SCC already found
+// (M [i] and M [j] are both n), and if F and B are not NULL, if F [i]==F [j]
+// and B [i]==B [j].  The same test is used for A and A', since it is
+// symmetric in i and j.
+
+typedef struct
+{
+    const GrB_Index *F ;    // forward labels, of size n, or NULL
+    const GrB_Index *B ;    // backward labels, of size n, or NULL
+    const GrB_Index *M ;    // M [i] is the SCC of node i, or n if not known
+    GrB_Index n ;
+}
+LG_scc_state ;
+
+static void LG_scc_keep (bool *z, const void *x, GrB_Index i, GrB_Index j,
+    const void *thunk)
+{
+    const LG_scc_state *state = (const LG_scc_state *) thunk ;
+    const GrB_Index n = state->n ;
+    (*z) = (state->M [i] == n && state->M [j] == n &&
+        (state->F == NULL ||
+        (state->F [i] == state->F [j] && state->B [i] == state->B [j]))) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_scc_propagate: label propagation
+//------------------------------------------------------------------------------
+
+// label(i) is reduced to the smallest label of any node that can reach i via
+// the edges of A.  Only the labels of the nodes in the mask are propagated
+// at the start.  s and t are workspace.
+
+static int LG_scc_propagate
+(
+    GrB_Vector label,       // input/output: labels
+    GrB_Vector mask,        // input: mask; modified on output
+    GrB_Matrix A,           // input: graph
+    GrB_Vector s,           // workspace of size n
+    GrB_Vector t,           // workspace of size n
+    char *msg
+)
+{
+    GRB_TRY (GrB_Vector_clear (s)) ;
+    GRB_TRY (GrB_assign (s, mask, NULL, label, GrB_ALL, 0, NULL)) ;
+    GRB_TRY (GrB_assign (t, NULL, NULL, label, GrB_ALL, 0, NULL)) ;
+
+    GrB_Index active ;
+    while (true)
+    {
+        GRB_TRY (GrB_vxm (t, NULL, GrB_MIN_UINT64,
+            GrB_MIN_FIRST_SEMIRING_UINT64, s, A, NULL)) ;
+        GRB_TRY (GrB_eWiseMult (mask, NULL, NULL, GxB_ISNE_UINT64, t, label,
+            NULL)) ;
+        GRB_TRY (GrB_assign (label, mask, NULL, t, GrB_ALL, 0, NULL)) ;
+        GRB_TRY (GrB_reduce (&active, NULL, GrB_PLUS_MONOID_UINT64, mask,
+            NULL)) ;
+        if (active == 0) break ;
+        GRB_TRY (GrB_Vector_clear (s)) ;
+        GRB_TRY (GrB_assign (s, mask, NULL, label, GrB_ALL, 0, NULL)) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_scc_reach: find all nodes reachable from the pivot
+//------------------------------------------------------------------------------
+
+// reach(i) is true if node i can be reached from the pivot via the edges of
+// A (including the pivot itself), and not present otherwise.  q is workspace.
+
+static int LG_scc_reach
+(
+    GrB_Vector reach,       // output: nodes reachable from the pivot
+    GrB_Matrix A,           // input: graph
+    GrB_Index pivot,        // input: starting node
+    GrB_Index n,
+    GrB_Vector q,           // workspace of size n
+    char *msg
+)
+{
+    GRB_TRY (GrB_Vector_clear (reach)) ;
+    GRB_TRY (GrB_Vector_clear (q)) ;
+    GRB_TRY (GrB_Vector_setElement (reach, true, pivot)) ;
+    GRB_TRY (GrB_Vector_setElement (q, true, pivot)) ;
+
+    GrB_Index nq = 1 ;
+    while (nq > 0)
+    {
+        // q<!reach,replace> = q'*A
+        GRB_TRY (GrB_vxm (q, reach, NULL, GrB_LOR_LAND_SEMIRING_BOOL, q, A,
+            GrB_DESC_RSC)) ;
+        GRB_TRY (GrB_assign (reach, q, NULL, true, GrB_ALL, n, GrB_DESC_S)) ;
+        GRB_TRY (GrB_Vector_nvals (&nq, q)) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// LAGr_StronglyConnectedComponents
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                                        \
+{                                                                           \
+    GrB_free (&FW) ;                                                        \
+    GrB_free (&BW) ;                                                        \
+    GrB_free (&ind) ;                                                       \
+    GrB_free (&inf) ;                                                       \
+    GrB_free (&f) ;                                                         \
+    GrB_free (&b) ;                                                         \
+    GrB_free (&s) ;                                                         \
+    GrB_free (&t) ;                                                         \
+    GrB_free (&mask) ;                                                      \
+    GrB_free (&active) ;                                                    \
+    GrB_free (&keep) ;                                                      \
+    GrB_free (&dout) ;                                                      \
+    GrB_free (&din) ;                                                       \
+    GrB_free (&fr) ;                                                        \
+    GrB_free (&br) ;                                                        \
+    GrB_free (&q) ;                                                         \
+    GrB_free (&Keep) ;                                                      \
+    GrB_free (&StateType) ;                                                 \
+    GrB_free (&Thunk) ;                                                     \
+    LAGraph_Free ((void **) &I, NULL) ;                                     \
+    LAGraph_Free ((void **) &F, NULL) ;                                     \
+    LAGraph_Free ((void **) &B, NULL) ;                                     \
+    LAGraph_Free ((void **) &M, NULL) ;                                     \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                                         \
+{                                                                           \
+    LG_FREE_WORK ;                                                          \
+    GrB_free (&scc) ;                                                       \
+}
+
+int LAGr_StronglyConnectedComponents
+(
+    // output:
+    GrB_Vector *component,  // component(i)=s if node i is in the strongly
+                            // connected component whose representative is s
+    // input:
+    const LAGraph_Graph G,  // input graph
+    char *msg
+)
+{
+
+#if !LAGRAPH_SUITESPARSE
+    return (GrB_NOT_IMPLEMENTED) ;
+#else
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix FW = NULL, BW = NULL ;
+    GrB_Vector scc = NULL, ind = NULL, inf = NULL, f = NULL, b = NULL,
+        s = NULL, t = NULL, mask = NULL, active = NULL, keep = NULL,
+        dout = NULL, din = NULL, fr = NULL, br = NULL, q = NULL ;
+    GrB_IndexUnaryOp Keep = NULL ;
+    GrB_Type StateType = NULL ;
+    GrB_Scalar Thunk = NULL ;
+    GrB_Index *I = NULL, *F = NULL, *B = NULL, *M = NULL ;
+
+    LG_CLEAR_MSG ;
+    LG_ASSERT (component != NULL, GrB_NULL_POINTER) ;
+    (*component) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GrB_Index n, nn, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+
+    // FW = pattern of A, and BW = pattern of A'
+    GrB_Matrix AT = (G->kind == LAGraph_ADJACENCY_UNDIRECTED) ? G->A : G->AT ;
+    GRB_TRY (GrB_Matrix_new (&FW, GrB_BOOL, n, n)) ;
+    GRB_TRY (GrB_Matrix_new (&BW, GrB_BOOL, n, n)) ;
+    GRB_TRY (GrB_assign (FW, G->A, NULL, (bool) true, GrB_ALL, n, GrB_ALL, n,
+        GrB_DESC_S)) ;
+    if (AT != NULL)
+    {
+        GRB_TRY (GrB_assign (BW, AT, NULL, (bool) true, GrB_ALL, n, GrB_ALL,
+            n, GrB_DESC_S)) ;
+    }
+    else
+    {
+        GRB_TRY (GrB_transpose (BW, NULL, NULL, FW, NULL)) ;
+    }
+
+    LG_TRY (LAGraph_Malloc ((void **) &I, LAGRAPH_MAX (n, 1),
+        sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &F, LAGRAPH_MAX (n, 1),
+        sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &B, LAGRAPH_MAX (n, 1),
+        sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &M, LAGRAPH_MAX (n, 1),
+        sizeof (GrB_Index), msg)) ;
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        I [i] = i ;
+    }
+
+    // ind(i) = i, inf(i) = n, and scc(i) = n: no node is in an SCC yet
+    GRB_TRY (GrB_Vector_new (&ind, GrB_UINT64, n)) ;
+    GRB_TRY (GrB_Vector_build (ind, I, I, n, GrB_PLUS_UINT64)) ;
+    GRB_TRY (GrB_Vector_new (&inf, GrB_UINT64, n)) ;
+    GRB_TRY (GrB_assign (inf, NULL, NULL, n, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_Vector_new (&scc, GrB_UINT64, n)) ;
+    GRB_TRY (GrB_assign (scc, NULL, NULL, n, GrB_ALL, n, NULL)) ;
+
+    // other vectors
+    GRB_TRY (GrB_Vector_new (&f, GrB_UINT64, n)) ;
+    GRB_TRY (GrB_Vector_new (&b, GrB_UINT64, n)) ;
+    GRB_TRY (GrB_Vector_new (&s, GrB_UINT64, n)) ;
+    GRB_TRY (GrB_Vector_new (&t, GrB_UINT64, n)) ;
+    GRB_TRY (GrB_Vector_new (&mask, GrB_UINT64, n)) ;
+    GRB_TRY (GrB_Vector_new (&dout, GrB_UINT64, n)) ;
+    GRB_TRY (GrB_Vector_new (&din, GrB_UINT64, n)) ;
+    GRB_TRY (GrB_Vector_new (&active, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&keep, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&fr, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&br, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&q, GrB_BOOL, n)) ;
+
+    // the IndexUnaryOp for removing edges, and its thunk
+    LG_scc_state state ;
+    state.F = NULL ;
+    state.B = NULL ;
+    state.M = M ;
+    state.n = n ;
+    GRB_TRY (GrB_Type_new (&StateType, sizeof (LG_scc_state))) ;
+    GRB_TRY (GrB_Scalar_new (&Thunk, StateType)) ;
+    GRB_TRY (GrB_IndexUnaryOp_new (&Keep, (GxB_index_unary_function)
+        LG_scc_keep, GrB_BOOL, GrB_BOOL, StateType)) ;
+
+    //--------------------------------------------------------------------------
+    // phase 1: trim the nodes with no in-edges or no out-edges
+    //--------------------------------------------------------------------------
+
+    GrB_Index nactive = n ;
+    GRB_TRY (GrB_assign (active, NULL, NULL, (bool) true, GrB_ALL, n, NULL)) ;
+    while (nactive > 0)
+    {
+        // dout(i) = # of out-edges of i to active nodes, if i is active,
+        // and likewise for din(i)
+        GRB_TRY (GrB_mxv (dout, active, NULL, GxB_PLUS_PAIR_UINT64, FW,
+            active, GrB_DESC_RS)) ;
+        GRB_TRY (GrB_mxv (din, active, NULL, GxB_PLUS_PAIR_UINT64, BW,
+            active, GrB_DESC_RS)) ;
+        // keep = the active nodes with both in-edges and out-edges
+        GRB_TRY (GrB_eWiseMult (keep, NULL, NULL, GrB_ONEB_BOOL, dout, din,
+            GrB_DESC_R)) ;
+        GrB_Index nkeep ;
+        GRB_TRY (GrB_Vector_nvals (&nkeep, keep)) ;
+        if (nkeep == nactive) break ;
+        // each trimmed node is an SCC by itself: scc<!keep> = ind
+        GRB_TRY (GrB_assign (scc, keep, NULL, ind, GrB_ALL, n, GrB_DESC_SC)) ;
+        // active = keep
+        GrB_Vector temp = active ;
+        active = keep ;
+        keep = temp ;
+        nactive = nkeep ;
+    }
+
+    if (nactive < n)
+    {
+        // remove the edges of the trimmed nodes
+        nn = n ;
+        GRB_TRY (GrB_Vector_extractTuples (I, M, &nn, scc)) ;
+        GRB_TRY (GrB_Scalar_setElement_UDT (Thunk, &state)) ;
+        GRB_TRY (GrB_select (FW, NULL, NULL, Keep, FW, Thunk, NULL)) ;
+        GRB_TRY (GrB_select (BW, NULL, NULL, Keep, BW, Thunk, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // phase 2: find the SCC of a pivot node by forward-backward search
+    //--------------------------------------------------------------------------
+
+    if (nactive > 0)
+    {
+        // pivot = the active node with the largest din(i)*dout(i)
+        GRB_TRY (GrB_eWiseMult (s, NULL, NULL, GrB_TIMES_UINT64, dout, din,
+            GrB_DESC_R)) ;
+        uint64_t dmax = 0 ;
+        GRB_TRY (GrB_reduce (&dmax, NULL, GrB_MAX_MONOID_UINT64, s, NULL)) ;
+        GRB_TRY (GrB_select (t, NULL, NULL, GrB_VALUEEQ_UINT64, s, dmax,
+            GrB_DESC_R)) ;
+        GrB_Index npivots = n ;
+        GRB_TRY (GrB_Vector_extractTuples (F, B, &npivots, t)) ;
+        GrB_Index pivot = F [0] ;
+
+        // fr = nodes reachable from the pivot, br = nodes that reach it
+        LG_TRY (LG_scc_reach (fr, FW, pivot, n, q, msg)) ;
+        LG_TRY (LG_scc_reach (br, BW, pivot, n, q, msg)) ;
+
+        // q = the SCC of the pivot, and cmin = its smallest node
+        GRB_TRY (GrB_eWiseMult (q, NULL, NULL, GrB_LAND, fr, br, GrB_DESC_R)) ;
+        GRB_TRY (GrB_Vector_clear (t)) ;
+        GRB_TRY (GrB_assign (t, q, NULL, ind, GrB_ALL, n, GrB_DESC_S)) ;
+        uint64_t cmin = n ;
+        GRB_TRY (GrB_reduce (&cmin, NULL, GrB_MIN_MONOID_UINT64, t, NULL)) ;
+        GRB_TRY (GrB_assign (scc, q, NULL, cmin, GrB_ALL, n, GrB_DESC_S)) ;
+
+        // F [i] = 1 if i is in fr, B [i] = 1 if i is in br, and 0 otherwise
+        GRB_TRY (GrB_assign (f, NULL, NULL, 0, GrB_ALL, n, NULL)) ;
+        GRB_TRY (GrB_assign (f, fr, NULL, 1, GrB_ALL, n, GrB_DESC_S)) ;
+        GRB_TRY (GrB_assign (b, NULL, NULL, 0, GrB_ALL, n, NULL)) ;
+        GRB_TRY (GrB_assign (b, br, NULL, 1, GrB_ALL, n, GrB_DESC_S)) ;
+        nn = n ;
+        GRB_TRY (GrB_Vector_extractTuples (I, F, &nn, f)) ;
+        nn = n ;
+        GRB_TRY (GrB_Vector_extractTuples (I, B, &nn, b)) ;
+        nn = n ;
+        GRB_TRY (GrB_Vector_extractTuples (I, M, &nn, scc)) ;
+
+        // remove the edges of the SCC of the pivot, and the edges between
+        // fr\br, br\fr, and the rest of the nodes
+        state.F = F ;
+        state.B = B ;
+        GRB_TRY (GrB_Scalar_setElement_UDT (Thunk, &state)) ;
+        GRB_TRY (GrB_select (FW, NULL, NULL, Keep, FW, Thunk, NULL)) ;
+        GRB_TRY (GrB_select (BW, NULL, NULL, Keep, BW, Thunk, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // phase 3: find the remaining SCCs by coloring
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_nvals (&nvals, FW)) ;
+    while (nvals > 0)
+    {
+        // forward: f(i) = smallest node that can reach i
+        GRB_TRY (GrB_eWiseMult (mask, NULL, NULL, GxB_ISEQ_UINT64, scc, inf,
+            NULL)) ;
+        GRB_TRY (GrB_assign (f, NULL, NULL, ind, GrB_ALL, 0, NULL)) ;
+        LG_TRY (LG_scc_propagate (f, mask, FW, s, t, msg)) ;
+
+        // backward: b(i) = smallest node reachable from i, for f(i) == i
+        GRB_TRY (GrB_eWiseMult (mask, NULL, NULL, GxB_ISEQ_UINT64, f, ind,
+            NULL)) ;
+        GRB_TRY (GrB_assign (b, NULL, NULL, inf, GrB_ALL, 0, NULL)) ;
+        GRB_TRY (GrB_assign (b, mask, NULL, ind, GrB_ALL, 0, NULL)) ;
+        LG_TRY (LG_scc_propagate (b, mask, BW, s, t, msg)) ;
+
+        // node i is in the SCC of f(i) if f(i) == b(i)
+        GRB_TRY (GrB_eWiseMult (mask, NULL, NULL, GxB_ISEQ_UINT64, f, b,
+            NULL)) ;
+        GRB_TRY (GrB_assign (scc, mask, GrB_MIN_UINT64, f, GrB_ALL, 0, NULL)) ;
+
+        // remove the edges that cannot be in an SCC
+        nn = n ;
+        GRB_TRY (GrB_Vector_extractTuples (I, F, &nn, f)) ;
+        nn = n ;
+        GRB_TRY (GrB_Vector_extractTuples (I, B, &nn, b)) ;
+        nn = n ;
+        GRB_TRY (GrB_Vector_extractTuples (I, M, &nn, scc)) ;
+        state.F = F ;
+        state.B = B ;
+        GRB_TRY (GrB_Scalar_setElement_UDT (Thunk, &state)) ;
+        GRB_TRY (GrB_select (FW, NULL, NULL, Keep, FW, Thunk, NULL)) ;
+        GRB_TRY (GrB_select (BW, NULL, NULL, Keep, BW, Thunk, NULL)) ;
+
+        GRB_TRY (GrB_Matrix_nvals (&nvals, FW)) ;
+    }
+
+    // any node not yet in an SCC is an SCC by itself
+    GRB_TRY (GrB_eWiseMult (mask, NULL, NULL, GxB_ISEQ_UINT64, scc, inf,
+        NULL)) ;
+    GRB_TRY (GrB_assign (scc, mask, NULL, ind, GrB_ALL, 0, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*component) = scc ;
+    scc = NULL ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+#endif
+}
@@ -0,0 +1,414 @@
+//------------------------------------------------------------------------------
+// LAGr_TriangleCountApprox: estimate the number of triangles in a graph
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->nself_edges and G->is_symmetric_structure
+// are required, and G->out_degree is required for the Wedge method).
+
+// LAGr_TriangleCountApprox estimates the number of triangles in a symmetric
+// graph with no self-edges, and a confidence interval [lower,upper] that holds
+// the exact count with (about) the given probability.  Two methods are
+// available:
+
+// LAGr_TriangleCountApprox_Doulion: each edge is kept with probability p, and
+// the triangles in the sparsified graph are counted with LAGr_TriangleCount.
+// Each triangle survives with probability p^3, so the count divided by p^3 is
+// an unbiased estimate (Tsourakakis, Kang, Miller, Faloutsos, "DOULION:
+// counting triangles in massive graphs with a coin", KDD 2009).  This is done
+// for nsamples independent sparsified graphs, and the interval is based on the
+// sample variance of their estimates.  If nsamples is 1, the variance is taken
+// as T*(1-p^3)/p^3, which is exact only if no two triangles share an edge.
+
+// LAGr_TriangleCountApprox_Wedge: nsamples wedges (paths u-v-w of length 2)
+// are drawn uniformly at random, and the fraction f of them that are closed by
+// an edge (u,w) is found.  With W wedges in the graph, the estimate is f*W/3,
+// and the interval is the normal approximation for the binomial f (Schank and
+// Wagner, "Approximating clustering coefficient and transitivity", JGAA 2005).
+// The random numbers are obtained from LAGraph_Random_Seed and
+// LAGraph_Random_Next, so LAGraph_Random_Init must be called first.  G->A is
+// unpacked in CSR form and then packed back, so it is modified (but restored)
+// while this method runs.  This method requires SuiteSparse:GraphBLAS.
+
+#define LG_FREE_WORK                                                        \
+{                                                                           \
+    GrB_free (&L) ;                                                         \
+    GrB_free (&S) ;                                                         \
+    GrB_free (&Seed) ;                                                      \
+    GrB_free (&Keep) ;                                                      \
+    LAGraph_Delete (&H, NULL) ;                                             \
+    LAGraph_Free ((void **) &X1, NULL) ;                                    \
+    LAGraph_Free ((void **) &X2, NULL) ;                                    \
+    LAGraph_Free ((void **) &X3, NULL) ;                                    \
+    LAGraph_Free ((void **) &Wcum, NULL) ;                                  \
+    LAGraph_Free ((void **) &Deg, NULL) ;                                   \
+    LG_PACK_A ;                                                             \
+}
+
+#define LG_FREE_ALL LG_FREE_WORK
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+#if LAGRAPH_SUITESPARSE
+#define LG_PACK_A                                                           \
+{                                                                           \
+    if (Ap != NULL)                                                         \
+    {                                                                       \
+        /* pack A back into G */                                            \
+        GxB_Matrix_pack_CSR (G->A, &Ap, &Aj, &Ax, Ap_size, Aj_size,         \
+            Ax_size, A_iso, false, NULL) ;                                  \
+    }                                                                       \
+}
+#else
+#define LG_PACK_A ;
+#endif
+
+// number of wedges sampled at a time
+#define LG_TCA_BATCH (1024*1024)
+
+//------------------------------------------------------------------------------
+// LG_tca_mix: the splitmix64 finalizer
+//------------------------------------------------------------------------------
+
+static inline uint64_t LG_tca_mix (uint64_t h)
+{
+    h += 0x9E3779B97F4A7C15ULL ;
+    h ^= h >> 30 ;
+    h *= 0xBF58476D1CE4E5B9ULL ;
+    h ^= h >> 27 ;
+    h *= 0x94D049BB133111EBULL ;
+    h ^= h >> 31 ;
+    return (h) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_doulion_keep: decide if an edge (i,j) is kept in the sparsified graph
+//------------------------------------------------------------------------------
+
+// The upper 32 bits of the thunk y are a seed, and the lower 32 bits are the
+// probability p of keeping an edge, scaled by 2^32.  The edge (i,j) is hashed
+// with the seed (using the splitmix64 finalizer) and kept if the low 32 bits
+// of the hash are less than the scaled p.  The 32-bit seed for each trial is
+// itself a hash of the 64-bit user seed and the trial number (see
+// LG_tca_mix), so that all bits of the user seed are used.
+
+void LG_doulion_keep (bool *z, const void *x, GrB_Index i, GrB_Index j,
+    const uint64_t *y) ;
+
+void LG_doulion_keep (bool *z, const void *x, GrB_Index i, GrB_Index j,
+    const uint64_t *y)
+{
+    uint64_t h = (*y) >> 32 ;
+    h ^= i * 0x9E3779B97F4A7C15ULL ;
+    h ^= (j + 0x632BE59BD9B4E019ULL) * 0xBF58476D1CE4E5B9ULL ;
+    h ^= h >> 30 ;
+    h *= 0xBF58476D1CE4E5B9ULL ;
+    h ^= h >> 27 ;
+    h *= 0x94D049BB133111EBULL ;
+    h ^= h >> 31 ;
+    (*z) = ((h & 0xFFFFFFFFULL) < ((*y) & 0xFFFFFFFFULL)) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_TriangleCountApprox
+//------------------------------------------------------------------------------
+
+int LAGr_TriangleCountApprox
+(
+    // output:
+    double *estimate,       // estimated number of triangles
+    double *lower,          // lower end of the confidence interval (may be
+                            // NULL)
+    double *upper,          // upper end of the confidence interval (may be
+                            // NULL)
+    // input:
+    const LAGraph_Graph G,  // input graph, modified then restored (Wedge)
+    LAGr_TriangleCountApprox_Method method,
+    double p,               // Doulion: probability of keeping each edge
+    int64_t nsamples,       // Doulion: # of sparsified graphs;
+                            // Wedge: # of wedges sampled
+    double confidence,      // probability that the interval holds the exact
+                            // count, in the range (0,1), typically 0.95
+    uint64_t seed,          // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix L = NULL, S = NULL ;
+    GrB_Vector Seed = NULL ;
+    GrB_IndexUnaryOp Keep = NULL ;
+    LAGraph_Graph H = NULL ;
+    uint64_t *X1 = NULL, *X2 = NULL, *X3 = NULL ;
+    double *Wcum = NULL ;
+    int64_t *Deg = NULL ;
+    #if LAGRAPH_SUITESPARSE
+    GrB_Index *Ap = NULL, *Aj = NULL, Ap_size, Aj_size, Ax_size ;
+    void *Ax = NULL ;
+    bool A_iso = false ;
+    #endif
+
+    LG_ASSERT (estimate != NULL, GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (G->nself_edges == 0, LAGRAPH_NO_SELF_EDGES_ALLOWED) ;
+    LG_ASSERT_MSG ((G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE)),
+        LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED,
+        "G->A must be known to be symmetric") ;
+    LG_ASSERT_MSG (method == LAGr_TriangleCountApprox_Doulion ||
+        method == LAGr_TriangleCountApprox_Wedge, GrB_INVALID_VALUE,
+        "method is invalid") ;
+    LG_ASSERT_MSG (nsamples >= 1, GrB_INVALID_VALUE, "nsamples must be > 0") ;
+    LG_ASSERT_MSG (confidence > 0 && confidence < 1, GrB_INVALID_VALUE,
+        "confidence must be in the range (0,1)") ;
+
+    // find z so that a standard normal variable is in [-z,z] with the given
+    // probability, by bisection: erf (z/sqrt(2)) = confidence
+    double zlo = 0, zhi = 40 ;
+    for (int k = 0 ; k < 100 ; k++)
+    {
+        double z = (zlo + zhi) / 2 ;
+        if (erf (z / sqrt (2.0)) < confidence)
+        {
+            zlo = z ;
+        }
+        else
+        {
+            zhi = z ;
+        }
+    }
+    double z = (zlo + zhi) / 2 ;
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    double est = 0, stddev = 0 ;
+
+    if (method == LAGr_TriangleCountApprox_Doulion)
+    {
+
+        //----------------------------------------------------------------------
+        // DOULION: count the triangles in sparsified graphs
+        //----------------------------------------------------------------------
+
+        LG_ASSERT_MSG (p > 0 && p <= 1, GrB_INVALID_VALUE,
+            "p must be in the range (0,1]") ;
+        double p3 = p * p * p ;
+        uint64_t thresh = (uint64_t) ceil (p * 4294967296.0) ;
+        GRB_TRY (GrB_IndexUnaryOp_new (&Keep,
+            (GxB_index_unary_function) LG_doulion_keep,
+            GrB_BOOL, GrB_BOOL, GrB_UINT64)) ;
+
+        // L = tril (A,-1), typecast to boolean
+        GRB_TRY (GrB_Matrix_new (&L, GrB_BOOL, n, n)) ;
+        GRB_TRY (GrB_select (L, NULL, NULL, GrB_TRIL, G->A, (int64_t) (-1),
+            NULL)) ;
+
+        double sum = 0, sum2 = 0 ;
+        for (int64_t trial = 0 ; trial < nsamples ; trial++)
+        {
+            // S = edges of L kept with probability p
+            if (p < 1)
+            {
+                uint64_t tseed = LG_tca_mix (seed + (uint64_t) trial) ;
+                uint64_t thunk = (tseed << 32) | thresh ;
+                GRB_TRY (GrB_Matrix_new (&S, GrB_BOOL, n, n)) ;
+                GRB_TRY (GrB_select (S, NULL, NULL, Keep, L, thunk, NULL)) ;
+            }
+            else
+            {
+                GRB_TRY (GrB_Matrix_dup (&S, L)) ;
+            }
+            // S = S + S'
+            GRB_TRY (GrB_eWiseAdd (S, NULL, NULL, GrB_LOR, S, S,
+                GrB_DESC_T1)) ;
+
+            // count the triangles in the sparsified graph
+            LG_TRY (LAGraph_New (&H, &S, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+            H->nself_edges = 0 ;
+            LG_TRY (LAGraph_Cached_OutDegree (H, msg)) ;
+            uint64_t ntri = 0 ;
+            LG_TRY (LAGr_TriangleCount (&ntri, H, NULL, NULL, msg)) ;
+            LG_TRY (LAGraph_Delete (&H, msg)) ;
+
+            double x = ((double) ntri) / p3 ;
+            sum += x ;
+            sum2 += x * x ;
+        }
+
+        est = sum / nsamples ;
+        if (nsamples > 1)
+        {
+            // standard error of the mean, from the sample variance
+            double var = (sum2 - nsamples * est * est) / (nsamples - 1) ;
+            stddev = sqrt (LAGRAPH_MAX (var, 0) / nsamples) ;
+        }
+        else
+        {
+            // variance if the triangles are edge-disjoint
+            stddev = sqrt (est * (1 - p3) / p3) ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // wedge sampling
+        //----------------------------------------------------------------------
+
+        #if !LAGRAPH_SUITESPARSE
+        LG_ASSERT (false, GrB_NOT_IMPLEMENTED) ;
+        #else
+        LG_ASSERT_MSG (G->out_degree != NULL, LAGRAPH_NOT_CACHED,
+            "G->out_degree is required") ;
+
+        // Deg = G->out_degree, as a dense array
+        LG_TRY (LAGraph_Calloc ((void **) &Deg, n, sizeof (int64_t), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &X1, n, sizeof (uint64_t), msg)) ;
+        GrB_Index nd = n ;
+        GRB_TRY (GrB_Vector_extractTuples_INT64 (X1, (int64_t *) Deg, &nd,
+            G->out_degree)) ;
+        for (int64_t k = nd-1 ; k >= 0 ; k--)
+        {
+            // move the degree of node X1 [k] into place
+            int64_t d = Deg [k] ;
+            Deg [k] = 0 ;
+            Deg [X1 [k]] = d ;
+        }
+        LG_TRY (LAGraph_Free ((void **) &X1, NULL)) ;
+
+        // Wcum [v+1] = number of wedges centered at nodes 0 to v
+        LG_TRY (LAGraph_Malloc ((void **) &Wcum, n+1, sizeof (double), msg)) ;
+        Wcum [0] = 0 ;
+        for (int64_t v = 0 ; v < n ; v++)
+        {
+            double d = (double) Deg [v] ;
+            Wcum [v+1] = Wcum [v] + d * (d-1) / 2 ;
+        }
+        double W = Wcum [n] ;
+
+        if (W > 0)
+        {
+
+            // unpack A in CSR form, with sorted rows
+            GRB_TRY (GxB_Matrix_unpack_CSR (G->A, &Ap, &Aj, &Ax, &Ap_size,
+                &Aj_size, &Ax_size, &A_iso, NULL, NULL)) ;
+
+            int64_t bsize = LAGRAPH_MIN (nsamples, LG_TCA_BATCH) ;
+            LG_TRY (LAGraph_Malloc ((void **) &X1, bsize, sizeof (uint64_t),
+                msg)) ;
+            LG_TRY (LAGraph_Malloc ((void **) &X2, bsize, sizeof (uint64_t),
+                msg)) ;
+            LG_TRY (LAGraph_Malloc ((void **) &X3, bsize, sizeof (uint64_t),
+                msg)) ;
+            GRB_TRY (GrB_Vector_new (&Seed, GrB_UINT64, bsize)) ;
+            GRB_TRY (GrB_assign (Seed, NULL, NULL, (uint64_t) 0, GrB_ALL,
+                bsize, NULL)) ;
+            LG_TRY (LAGraph_Random_Seed (Seed, seed, msg)) ;
+
+            int nthreads_outer, nthreads_inner ;
+            LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner,
+                msg)) ;
+            int nthreads = LAGRAPH_MAX (nthreads_outer * nthreads_inner, 1) ;
+
+            int64_t nclosed = 0 ;
+            for (int64_t first = 0 ; first < nsamples ; first += bsize)
+            {
+                int64_t m = LAGRAPH_MIN (bsize, nsamples - first) ;
+
+                // get 3 random numbers for each wedge
+                GrB_Index nx = bsize ;
+                GRB_TRY (GrB_Vector_extractTuples (NULL, X1, &nx, Seed)) ;
+                LG_TRY (LAGraph_Random_Next (Seed, msg)) ;
+                GRB_TRY (GrB_Vector_extractTuples (NULL, X2, &nx, Seed)) ;
+                LG_TRY (LAGraph_Random_Next (Seed, msg)) ;
+                GRB_TRY (GrB_Vector_extractTuples (NULL, X3, &nx, Seed)) ;
+                LG_TRY (LAGraph_Random_Next (Seed, msg)) ;
+
+                int64_t k ;
+                #pragma omp parallel for num_threads(nthreads) \
+                    reduction(+:nclosed) schedule(static)
+                for (k = 0 ; k < m ; k++)
+                {
+                    // find the center v, with Wcum [v] <= x < Wcum [v+1]
+                    double x = ((double) (X1 [k] >> 11)) / 9007199254740992.0
+                        * W ;
+                    int64_t lo = 0, hi = n ;
+                    while (hi - lo > 1)
+                    {
+                        int64_t mid = (lo + hi) / 2 ;
+                        if (Wcum [mid] <= x)
+                        {
+                            lo = mid ;
+                        }
+                        else
+                        {
+                            hi = mid ;
+                        }
+                    }
+                    int64_t v = lo ;
+                    int64_t d = Deg [v] ;
+                    if (d < 2) continue ;   // only if x rounds up to W
+
+                    // pick two distinct neighbors u and w of v
+                    int64_t r1 = (int64_t) ((X2 [k] >> 16) % d) ;
+                    int64_t r2 = (int64_t) ((X3 [k] >> 16) % (d-1)) ;
+                    if (r2 >= r1) r2++ ;
+                    int64_t u = Aj [Ap [v] + r1] ;
+                    int64_t w = Aj [Ap [v] + r2] ;
+
+                    // the wedge is closed if A(u,w) is present
+                    int64_t pleft = Ap [u], pright = Ap [u+1] ;
+                    while (pleft < pright)
+                    {
+                        int64_t pmid = (pleft + pright) / 2 ;
+                        if ((int64_t) Aj [pmid] < w)
+                        {
+                            pleft = pmid + 1 ;
+                        }
+                        else
+                        {
+                            pright = pmid ;
+                        }
+                    }
+                    if (pleft < (int64_t) Ap [u+1] && (int64_t) Aj [pleft] == w)
+                    {
+                        nclosed++ ;
+                    }
+                }
+            }
+
+            // estimate = f*W/3, with f the fraction of closed wedges
+            double f = ((double) nclosed) / nsamples ;
+            est = f * W / 3 ;
+            stddev = sqrt (f * (1 - f) / nsamples) * W / 3 ;
+        }
+        #endif
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    (*estimate) = est ;
+    if (lower != NULL) (*lower) = LAGRAPH_MAX (est - z * stddev, 0) ;
+    if (upper != NULL) (*upper) = est + z * stddev ;
+    return (GrB_SUCCESS) ;
+}
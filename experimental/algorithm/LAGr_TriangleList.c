@@ -0,0 +1,171 @@
+//------------------------------------------------------------------------------
+// LAGr_TriangleList: list the triangles of a graph, in batches
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->nself_edges, G->out_degree,
+// G->is_symmetric_structure are required).
+
+// LAGr_TriangleList finds each triangle (i,j,k) of an undirected graph and
+// passes it to a user callback.  The triangles are not returned all at once;
+// each thread collects them in its own buffer of batch_size triangles, and
+// calls the callback each time the buffer is full (and once more at the end,
+// if the buffer is not empty).  The memory used is thus bounded by the size of
+// G plus nthreads*batch_size triangles, no matter how many triangles the graph
+// has.
+
+// The edges are oriented by ascending degree (see LG_OrientByDegree), so that
+// each triangle appears once, as a node u and two out-neighbors v and w of u,
+// where w is also an out-neighbor of v.  For each u, and each out-neighbor v
+// of u, the out-neighbors of u after v are merged with the out-neighbors of v.
+// The nodes u are shared cyclically among the threads.
+
+// The callback is called with an array of 3*ntri node indices, where
+// triangles [3*t ... 3*t+2] are the three nodes of the t-th triangle, in the
+// original node numbering of G.  The array is only valid during the call.  The
+// callback may be called concurrently from several threads, so it must be
+// thread-safe.  A callback can copy each batch into a ring buffer shared with
+// a consumer, for example.
+
+#define LG_FREE_WORK                                                        \
+{                                                                           \
+    LAGraph_Free ((void **) &P, NULL) ;                                     \
+    LAGraph_Free ((void **) &Dp, NULL) ;                                    \
+    LAGraph_Free ((void **) &Dj, NULL) ;                                    \
+    LAGraph_Free ((void **) &Work, NULL) ;                                  \
+}
+
+#define LG_FREE_ALL LG_FREE_WORK
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// default number of triangles in each batch
+#define LG_TRIANGLE_BATCH 4096
+
+int LAGr_TriangleList
+(
+    // output:
+    uint64_t *ntriangles,   // total number of triangles (may be NULL)
+    // input:
+    const LAGraph_Graph G,
+    LAGr_TriangleBatchCallback callback,    // called for each batch
+    void *callback_arg,     // passed to the callback
+    int64_t batch_size,     // max # of triangles in each batch; if <= 0,
+                            // a default is used
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    int64_t *P = NULL, *Dp = NULL, *Dj = NULL, *Work = NULL ;
+
+    LG_ASSERT (callback != NULL, GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (G->nself_edges == 0, LAGRAPH_NO_SELF_EDGES_ALLOWED) ;
+    LG_ASSERT_MSG ((G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE)),
+        LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED,
+        "G->A must be known to be symmetric") ;
+    LG_ASSERT_MSG (G->out_degree != NULL, LAGRAPH_NOT_CACHED,
+        "G->out_degree is required") ;
+    if (batch_size <= 0) batch_size = LG_TRIANGLE_BATCH ;
+
+    //--------------------------------------------------------------------------
+    // orient the edges of G by ascending degree
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    int64_t dmax ;
+    LG_TRY (LG_OrientByDegree (&Dp, &Dj, &P, &dmax, G, msg)) ;
+    int64_t nvals = Dp [n] ;
+
+    //--------------------------------------------------------------------------
+    // allocate the batch buffers, one per thread
+    //--------------------------------------------------------------------------
+
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = LAGRAPH_MAX (nthreads_outer * nthreads_inner, 1) ;
+    nthreads = (int) LAGRAPH_MIN (nthreads, 1 + nvals / 4096) ;
+    size_t wsize = 3 * ((size_t) batch_size) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Work, nthreads * wsize,
+        sizeof (int64_t), msg)) ;
+
+    //--------------------------------------------------------------------------
+    // list the triangles
+    //--------------------------------------------------------------------------
+
+    uint64_t total = 0 ;
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(+:total)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t *restrict batch = Work + tid * wsize ;
+        int64_t nbatch = 0 ;
+        for (int64_t u = tid ; u < (int64_t) n ; u += nthreads)
+        {
+            const int64_t pu_end = Dp [u+1] ;
+            for (int64_t pu = Dp [u] ; pu < pu_end ; pu++)
+            {
+                // each w in both Dj [pu+1:pu_end-1] and out(v) is a triangle
+                const int64_t v = Dj [pu] ;
+                const int64_t pv_end = Dp [v+1] ;
+                int64_t pa = pu + 1, pb = Dp [v] ;
+                while (pa < pu_end && pb < pv_end)
+                {
+                    const int64_t ia = Dj [pa] ;
+                    const int64_t ib = Dj [pb] ;
+                    if (ia == ib)
+                    {
+                        // add the triangle (u,v,w) to the batch
+                        batch [3*nbatch  ] = P [u] ;
+                        batch [3*nbatch+1] = P [v] ;
+                        batch [3*nbatch+2] = P [ia] ;
+                        nbatch++ ;
+                        if (nbatch == batch_size)
+                        {
+                            // the batch is full
+                            callback (batch, nbatch, callback_arg) ;
+                            total += nbatch ;
+                            nbatch = 0 ;
+                        }
+                    }
+                    pa += (ia <= ib) ;
+                    pb += (ib <= ia) ;
+                }
+            }
+        }
+        if (nbatch > 0)
+        {
+            // last partial batch of this thread
+            callback (batch, nbatch, callback_arg) ;
+            total += nbatch ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    if (ntriangles != NULL) (*ntriangles) = total ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,213 @@
+//------------------------------------------------------------------------------
+// LAGraph_FW: all-pairs shortest paths with the Floyd-Warshall method
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LAGraph_FW computes the length of the shortest path between all pairs of
+// nodes of a directed graph G, where G(i,j) is the weight of the edge (i,j).
+// On output, D(i,j) is the length of the shortest path from i to j, and D(i,j)
+// is not present if there is no such path.  All diagonal entries D(i,i) are
+// present, and zero.  Negative edge weights are allowed, but if G has a
+// negative-weight cycle, some D(i,i) are negative and the rest of D is not
+// meaningful.
+
+// D_type: if G is GrB_FP32, D is GrB_FP32 and *D_type is GrB_FP32.  For all
+// other types of G, D and *D_type are GrB_FP64.  A bool G (such as a pattern
+// matrix read by LAGraph_MMRead) has edge weights of 1.
+
+// If G has at least n^2/LG_FW_SPARSE entries (and SuiteSparse:GraphBLAS is in
+// use), the method works on a dense copy of G, with a blocked Floyd-Warshall
+// method; see LG_fw_template.h.  This takes O(n^3) time and O(n^2) memory.
+
+// Otherwise, D starts as G with zeros on the diagonal, and it is squared with
+// the min-plus semiring (D = D min.+ D) until it no longer changes.  After t
+// steps, D holds all shortest paths with at most 2^t edges, so this takes at
+// most ceil(log2(n))+1 steps, and far fewer if the shortest paths have few
+// edges.  Each step is a single GrB_mxm that exploits the sparsity of D.
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&T) ;                 \
+    GrB_free (&Z) ;                 \
+    GrB_free (&I) ;                 \
+    LAGraph_Free (&X, NULL) ;       \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (D) ;                  \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// if G has fewer than n^2/LG_FW_SPARSE entries, repeated squaring is used
+#define LG_FW_SPARSE 64
+
+#if LAGRAPH_SUITESPARSE
+
+// each tile is LG_FW_TILE-by-LG_FW_TILE: 32KB for double, 16KB for float
+#define LG_FW_TILE 64
+
+#define LG_T float
+#define LG_FW_KERNEL LG_fw_fp32
+#include "LG_fw_template.h"
+
+#define LG_T double
+#define LG_FW_KERNEL LG_fw_fp64
+#include "LG_fw_template.h"
+
+#endif
+
+//****************************************************************************
+GrB_Info LAGraph_FW
+(
+    const GrB_Matrix G,     // input graph, with edge weights
+    GrB_Matrix *D,          // output graph, created on output
+    GrB_Type   *D_type      // type of D: GrB_FP32 or GrB_FP64
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    char *msg = NULL ;
+    GrB_Matrix T = NULL, Z = NULL ;
+    GrB_Vector I = NULL ;
+    void *X = NULL ;
+
+    LG_ASSERT (G != NULL && D != NULL && D_type != NULL, GrB_NULL_POINTER) ;
+    (*D) = NULL ;
+
+    GrB_Index n, ncols, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, G)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, G)) ;
+    LG_ASSERT (n == ncols, GrB_INVALID_VALUE) ;
+
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, G, msg)) ;
+    bool fp32 = MATCHNAME (typename, "float") ;
+    GrB_Type type = fp32 ? GrB_FP32 : GrB_FP64 ;
+    GrB_BinaryOp min_op = fp32 ? GrB_MIN_FP32 : GrB_MIN_FP64 ;
+    (*D_type) = type ;
+
+    //--------------------------------------------------------------------------
+    // D = G, with zeros on the diagonal
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_new (D, type, n, n)) ;
+    GRB_TRY (GrB_Vector_new (&I, type, n)) ;
+    GRB_TRY (GrB_assign (I, NULL, NULL, 0, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_Matrix_diag (&Z, I, 0)) ;
+    GRB_TRY (GrB_eWiseAdd (*D, NULL, NULL, min_op, G, Z, NULL)) ;
+    GRB_TRY (GrB_free (&Z)) ;
+    GRB_TRY (GrB_free (&I)) ;
+
+    #if LAGRAPH_SUITESPARSE
+    if (n > 0 && nvals >= (n * n) / LG_FW_SPARSE)
+    {
+
+        //----------------------------------------------------------------------
+        // blocked Floyd-Warshall on a dense copy of D
+        //----------------------------------------------------------------------
+
+        // D = D, with INFINITY for all entries not present
+        GRB_TRY (GrB_Matrix_new (&T, type, n, n)) ;
+        GRB_TRY (GrB_assign (T, NULL, NULL, (double) INFINITY, GrB_ALL, n,
+            GrB_ALL, n, NULL)) ;
+        GRB_TRY (GrB_assign (T, *D, NULL, *D, GrB_ALL, n, GrB_ALL, n,
+            GrB_DESC_S)) ;
+        GRB_TRY (GrB_free (D)) ;
+        (*D) = T ;
+        T = NULL ;
+
+        // unpack D into X, held by row
+        size_t xsize = fp32 ? sizeof (float) : sizeof (double) ;
+        GrB_Index X_size ;
+        bool X_iso ;
+        GRB_TRY (GxB_Matrix_unpack_FullR (*D, &X, &X_size, &X_iso, NULL)) ;
+        if (X_iso)
+        {
+            // All entries of D are the same.  This happens if n = 1, or if
+            // every pair of nodes has an edge and all edge weights are zero.
+            // Expand X to hold all n^2 entries, all equal to X [0].
+            LG_TRY (LAGraph_Realloc (&X, n * n, 1, xsize, msg)) ;
+            if (fp32)
+            {
+                float *Xf = (float *) X ;
+                for (int64_t p = 1 ; p < n * n ; p++) Xf [p] = Xf [0] ;
+            }
+            else
+            {
+                double *Xd = (double *) X ;
+                for (int64_t p = 1 ; p < n * n ; p++) Xd [p] = Xd [0] ;
+            }
+            X_size = n * n * xsize ;
+            X_iso = false ;
+        }
+
+        // compute all shortest paths
+        int nthreads_outer, nthreads_inner ;
+        LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+        int nthreads = nthreads_outer * nthreads_inner ;
+        if (fp32)
+        {
+            LG_fw_fp32 ((float *) X, n, nthreads) ;
+        }
+        else
+        {
+            LG_fw_fp64 ((double *) X, n, nthreads) ;
+        }
+
+        // pack X back into D, and remove the entries with no path
+        GRB_TRY (GxB_Matrix_pack_FullR (*D, &X, X_size, X_iso, NULL)) ;
+        GRB_TRY (GrB_select (*D, NULL, NULL,
+            fp32 ? GrB_VALUENE_FP32 : GrB_VALUENE_FP64, *D,
+            (double) INFINITY, NULL)) ;
+    }
+    else
+    #endif
+    {
+
+        //----------------------------------------------------------------------
+        // repeated squaring with the min-plus semiring
+        //----------------------------------------------------------------------
+
+        GrB_Semiring semiring = fp32 ?
+            GrB_MIN_PLUS_SEMIRING_FP32 : GrB_MIN_PLUS_SEMIRING_FP64 ;
+        GRB_TRY (GrB_Matrix_new (&T, type, n, n)) ;
+        for (GrB_Index paths = 1 ; paths < 2*n ; paths *= 2)
+        {
+            // T = D min.+ D; D has a zero diagonal, so T <= D and T holds all
+            // entries of D
+            GRB_TRY (GrB_mxm (T, NULL, NULL, semiring, *D, *D, NULL)) ;
+            bool same = false ;
+            LG_TRY (LAGraph_Matrix_IsEqual (&same, T, *D, msg)) ;
+            // swap T and D
+            GrB_Matrix S = T ;
+            T = (*D) ;
+            (*D) = S ;
+            if (same) break ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
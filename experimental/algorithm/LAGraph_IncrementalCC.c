@@ -0,0 +1,336 @@
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC: connected components maintained across insertions
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// An LAGraph_IncrementalCC object holds the connected components of an
+// undirected graph as a union-find forest, so that they can be kept up to
+// date as edges are inserted into the graph, without recomputing them from
+// scratch:
+
+//  LAGr_IncrementalCC_New: creates the object from the connected components
+//      of a graph G, as computed by LAGr_ConnectedComponents.  G itself is not
+//      kept.
+
+//  LAGraph_IncrementalCC_Insert: inserts a batch of edges, given as the
+//      pattern of a matrix E.  The two trees of the nodes of each edge are
+//      linked in parallel with LG_union_link, and then only the nodes of the
+//      batch are compressed, so the work is O(nvals(E)*alpha(n)), not O(n) or
+//      O(nvals(G->A)).
+
+//  LAGraph_IncrementalCC_Component: exports the component vector, which is
+//      the same as LAGr_ConnectedComponents would compute on G with all of
+//      the inserted edges added: component(i) is the smallest node index in
+//      the component of i.  This takes O(n) time.
+
+//  LAGraph_IncrementalCC_Delete: frees the object.
+
+// Edge deletions are not supported, since they can split a component.  A
+// single object must not be used by multiple user threads at the same time.
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// LAGr_IncrementalCC_New
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                                        \
+{                                                                           \
+    GrB_free (&C) ;                                                         \
+    LAGraph_Free ((void **) &I, NULL) ;                                     \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                                         \
+{                                                                           \
+    LG_FREE_WORK ;                                                          \
+    LAGraph_IncrementalCC_Delete (state, NULL) ;                            \
+}
+
+int LAGr_IncrementalCC_New
+(
+    // output:
+    LAGraph_IncrementalCC *state,   // the new object
+    // input:
+    const LAGraph_Graph G,          // input graph
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector C = NULL ;
+    GrB_Index *I = NULL ;
+    LG_ASSERT (state != NULL, GrB_NULL_POINTER) ;
+    (*state) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // find the connected components of G
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGr_ConnectedComponents (&C, G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // create the object, with one tree per component
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Vector_size (&n, C)) ;
+    LG_TRY (LAGraph_Calloc ((void **) state, 1,
+        sizeof (struct LAGraph_IncrementalCC_struct), msg)) ;
+    (*state)->n = n ;
+    LG_TRY (LAGraph_Malloc ((void **) &((*state)->Parent), LAGRAPH_MAX (n, 1),
+        sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &I, LAGRAPH_MAX (n, 1),
+        sizeof (GrB_Index), msg)) ;
+
+    // Parent [i] = C (i), which is the smallest node in its component, and is
+    // thus the root of a tree of depth one
+    GrB_Index nvals = n ;
+    GRB_TRY (GrB_Vector_extractTuples_INT64 (I, (*state)->Parent, &nvals, C)) ;
+    LG_ASSERT (nvals == n, GrB_INVALID_VALUE) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC_Insert
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                                        \
+{                                                                           \
+    LAGraph_Free ((void **) &I, NULL) ;                                     \
+    LAGraph_Free ((void **) &J, NULL) ;                                     \
+    LAGraph_Free ((void **) &X, NULL) ;                                     \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL LG_FREE_WORK
+
+int LAGraph_IncrementalCC_Insert
+(
+    // input/output:
+    LAGraph_IncrementalCC state,    // object to update
+    // input:
+    const GrB_Matrix E,             // E(i,j) present: edge (i,j) is inserted
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *I = NULL, *J = NULL ;
+    bool *X = NULL ;
+    LG_ASSERT (state != NULL && E != NULL, GrB_NULL_POINTER) ;
+
+    int64_t n = state->n ;
+    GrB_Index nrows, ncols, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&nrows, E)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, E)) ;
+    LG_ASSERT_MSG (nrows == n && ncols == n, GrB_DIMENSION_MISMATCH,
+        "E must be n-by-n") ;
+
+    //--------------------------------------------------------------------------
+    // get the inserted edges
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_nvals (&nvals, E)) ;
+    if (nvals == 0) return (GrB_SUCCESS) ;
+    LG_TRY (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &X, nvals, sizeof (bool), msg)) ;
+    GRB_TRY (GrB_Matrix_extractTuples_BOOL (I, J, X, &nvals, E)) ;
+
+    int nthreads, nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    nthreads = nthreads_outer * nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, nvals / 1024) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    //--------------------------------------------------------------------------
+    // link the trees of the two nodes of each edge
+    //--------------------------------------------------------------------------
+
+    int64_t *Parent = state->Parent ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < (int64_t) nvals ; k++)
+    {
+        LG_union_link (Parent, I [k], J [k]) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compress the paths from the nodes of the batch to their roots
+    //--------------------------------------------------------------------------
+
+    // Only the nodes of the batch are compressed, which keeps the trees
+    // shallow where they are likely to be used again, at a cost of
+    // O(nvals(E)) rather than O(n).  This is done only after all edges have
+    // been linked, since compression must not overlap with linking.
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < (int64_t) nvals ; k++)
+    {
+        int64_t i = I [k] ;
+        while (Parent [i] != Parent [Parent [i]])
+        {
+            Parent [i] = Parent [Parent [i]] ;
+        }
+        int64_t j = J [k] ;
+        while (Parent [j] != Parent [Parent [j]])
+        {
+            Parent [j] = Parent [Parent [j]] ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC_Component
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                                        \
+{                                                                           \
+    LAGraph_Free ((void **) &I, NULL) ;                                     \
+    LAGraph_Free ((void **) &X32, NULL) ;                                   \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                                         \
+{                                                                           \
+    LG_FREE_WORK ;                                                          \
+    GrB_free (component) ;                                                  \
+}
+
+int LAGraph_IncrementalCC_Component
+(
+    // output:
+    GrB_Vector *component,          // component(i)=s if node i is in the
+                                    // component whose representative node is s
+    // input/output:
+    LAGraph_IncrementalCC state,    // trees are compressed on output
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *I = NULL ;
+    uint32_t *X32 = NULL ;
+    LG_ASSERT (component != NULL && state != NULL, GrB_NULL_POINTER) ;
+    (*component) = NULL ;
+
+    int64_t n = state->n ;
+    int nthreads, nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    nthreads = nthreads_outer * nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, n / 16) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    //--------------------------------------------------------------------------
+    // compress all trees, so that each node points to its root
+    //--------------------------------------------------------------------------
+
+    int64_t *Parent = state->Parent ;
+    LG_union_compress (Parent, n, nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // construct the component vector
+    //--------------------------------------------------------------------------
+
+    // the vector has the same type as the output of LAGr_ConnectedComponents
+    LG_TRY (LAGraph_Malloc ((void **) &I, LAGRAPH_MAX (n, 1),
+        sizeof (GrB_Index), msg)) ;
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (i = 0 ; i < n ; i++)
+    {
+        I [i] = i ;
+    }
+
+    #if LAGRAPH_SUITESPARSE
+    if (n <= INT32_MAX)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &X32, LAGRAPH_MAX (n, 1),
+            sizeof (uint32_t), msg)) ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (i = 0 ; i < n ; i++)
+        {
+            X32 [i] = (uint32_t) Parent [i] ;
+        }
+        GRB_TRY (GrB_Vector_new (component, GrB_UINT32, n)) ;
+        GRB_TRY (GrB_Vector_build_UINT32 (*component, I, X32, n,
+            GrB_FIRST_UINT32)) ;
+    }
+    else
+    #endif
+    {
+        GRB_TRY (GrB_Vector_new (component, GrB_UINT64, n)) ;
+        GRB_TRY (GrB_Vector_build_UINT64 (*component, I,
+            (uint64_t *) Parent, n, GrB_FIRST_UINT64)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC_Delete
+//------------------------------------------------------------------------------
+
+int LAGraph_IncrementalCC_Delete
+(
+    // input/output:
+    LAGraph_IncrementalCC *state,   // object to free; set to NULL on output
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    if (state == NULL || (*state) == NULL)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+    LAGraph_Free ((void **) &((*state)->Parent), NULL) ;
+    LAGraph_Free ((void **) state, NULL) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,154 @@
+//------------------------------------------------------------------------------
+// LG_OrientByDegree: orient the edges of a graph by ascending degree
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LG_OrientByDegree constructs the directed acyclic graph D used by the
+// clique and triangle listing methods (LAGr_KCliqueCount and
+// LAGr_TriangleList).  The nodes of G are renumbered in ascending order of
+// degree (with LAGr_SortByDegree), so that node P [r] of G is node r of D.
+// Each edge of G is then oriented from the lower-numbered node to the other
+// one: D = triu (A (P,P), 1).  The out-neighbors of node r of D are in
+// Dj [Dp [r] ... Dp [r+1]-1], in ascending order.  Ordering by degree bounds
+// the out-degree of the hub nodes of G, which dmax returns.
+
+// G must be symmetric with no self-edges, and G->out_degree is required.  The
+// three arrays Dp (size n+1), Dj (size Dp [n]), and P (size n) must be freed
+// by LAGraph_Free.
+
+#define LG_FREE_WORK                                                        \
+{                                                                           \
+    GrB_free (&A2) ;                                                        \
+    GrB_free (&D) ;                                                         \
+    LAGraph_Free ((void **) &Di, NULL) ;                                    \
+    LAGraph_Free ((void **) &Dj2, NULL) ;                                   \
+    LAGraph_Free ((void **) &Head, NULL) ;                                  \
+}
+
+#define LG_FREE_ALL                                                         \
+{                                                                           \
+    LG_FREE_WORK ;                                                          \
+    LAGraph_Free ((void **) &Dp, NULL) ;                                    \
+    LAGraph_Free ((void **) &Dj, NULL) ;                                    \
+    LAGraph_Free ((void **) &P, NULL) ;                                     \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LG_OrientByDegree
+(
+    // output:
+    int64_t **Dp_handle,    // row pointers of D, of size n+1
+    int64_t **Dj_handle,    // out-neighbors of each node of D, sorted
+    int64_t **P_handle,     // node P [r] of G is node r of D, of size n
+    int64_t *dmax_handle,   // max out-degree of D
+    // input:
+    const LAGraph_Graph G,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix A2 = NULL, D = NULL ;
+    int64_t *P = NULL, *Dp = NULL, *Dj = NULL, *Dj2 = NULL, *Head = NULL ;
+    GrB_Index *Di = NULL ;
+    LG_ASSERT (Dp_handle != NULL && Dj_handle != NULL && P_handle != NULL
+        && dmax_handle != NULL, GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // D = triu (A (P,P), 1), with the nodes in ascending order of degree
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    LG_TRY (LAGr_SortByDegree (&P, G, true, true, msg)) ;
+    GRB_TRY (GrB_Matrix_new (&A2, GrB_BOOL, n, n)) ;
+    GRB_TRY (GrB_extract (A2, NULL, NULL, G->A, (GrB_Index *) P, n,
+        (GrB_Index *) P, n, NULL)) ;
+    GRB_TRY (GrB_Matrix_new (&D, GrB_BOOL, n, n)) ;
+    GRB_TRY (GrB_select (D, NULL, NULL, GrB_TRIU, A2, (int64_t) 1, NULL)) ;
+    GRB_TRY (GrB_free (&A2)) ;
+
+    //--------------------------------------------------------------------------
+    // construct the sorted adjacency lists of D
+    //--------------------------------------------------------------------------
+
+    GrB_Index nvals ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, D)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Di, nvals + 1, sizeof (GrB_Index),
+        msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Dj, nvals + 1, sizeof (int64_t),
+        msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &Dp, n + 1, sizeof (int64_t), msg)) ;
+    GrB_Index nv = nvals ;
+    GRB_TRY (GrB_Matrix_extractTuples (Di, (GrB_Index *) Dj, NULL, &nv, D)) ;
+    GRB_TRY (GrB_free (&D)) ;
+
+    // Dp = cumulative sum of the row counts
+    for (int64_t p = 0 ; p < (int64_t) nvals ; p++)
+    {
+        Dp [Di [p] + 1]++ ;
+    }
+    int64_t dmax = 0 ;
+    for (int64_t r = 0 ; r < (int64_t) n ; r++)
+    {
+        dmax = LAGRAPH_MAX (dmax, Dp [r+1]) ;
+        Dp [r+1] += Dp [r] ;
+    }
+
+    // place the entries in their rows, if not already in row-major order
+    bool sorted = true ;
+    for (int64_t p = 1 ; p < (int64_t) nvals && sorted ; p++)
+    {
+        sorted = (Di [p-1] < Di [p] ||
+            (Di [p-1] == Di [p] && Dj [p-1] < Dj [p])) ;
+    }
+    if (!sorted)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &Dj2, nvals + 1, sizeof (int64_t),
+            msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Head, n + 1, sizeof (int64_t),
+            msg)) ;
+        memcpy (Head, Dp, (n + 1) * sizeof (int64_t)) ;
+        for (int64_t p = 0 ; p < (int64_t) nvals ; p++)
+        {
+            Dj2 [Head [Di [p]]++] = Dj [p] ;
+        }
+        LAGraph_Free ((void **) &Dj, NULL) ;
+        Dj = Dj2 ;
+        Dj2 = NULL ;
+        int64_t r ;
+        #pragma omp parallel for schedule(dynamic,1024)
+        for (r = 0 ; r < (int64_t) n ; r++)
+        {
+            LG_qsort_1a (Dj + Dp [r], Dp [r+1] - Dp [r]) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    (*Dp_handle) = Dp ;
+    (*Dj_handle) = Dj ;
+    (*P_handle) = P ;
+    (*dmax_handle) = dmax ;
+    return (GrB_SUCCESS) ;
+}
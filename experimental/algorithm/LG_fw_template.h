@@ -0,0 +1,139 @@
+//------------------------------------------------------------------------------
+// LG_fw_template: blocked Floyd-Warshall kernel for one type
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This file is #include'd in LAGraph_FW.c to create a kernel for each type of
+// the path lengths.  LG_T is the type (float or double), and LG_FW_KERNEL is
+// the name of the kernel.  Both are #undef'd at the end of this file.
+
+// X is the dense n-by-n matrix of path lengths, held by row, with INFINITY
+// for no path.  It is split into tiles of size LG_FW_TILE-by-LG_FW_TILE, and
+// each round kb of the outer loop does the work of LG_FW_TILE iterations k of
+// the classic method, in three phases:
+
+// (1) the diagonal tile (kb,kb) is updated with the classic method.
+// (2) the tiles in row kb and column kb (the panels) are updated in parallel,
+//      using the diagonal tile.
+// (3) all other tiles (ib,jb) are updated in parallel, using the tiles
+//      (ib,kb) and (kb,jb) from phase (2), which are no longer modified in
+//      this round.  This is a min-plus matrix multiply of two tiles, with a
+//      unit-stride inner loop over j that the compiler can vectorize.
+
+// Three tiles fit in the L2 cache, so each tile is read from memory just once
+// for each round.
+
+static void LG_FW_KERNEL
+(
+    LG_T *LG_RESTRICT X,        // n-by-n, held by row
+    const int64_t n,
+    const int nthreads
+)
+{
+
+    const int64_t ntiles = (n + LG_FW_TILE - 1) / LG_FW_TILE ;
+    int64_t t ;
+
+    for (int64_t kb = 0 ; kb < ntiles ; kb++)
+    {
+        const int64_t k1 = kb * LG_FW_TILE ;
+        const int64_t k2 = LAGRAPH_MIN (k1 + LG_FW_TILE, n) ;
+
+        //----------------------------------------------------------------------
+        // phase 1: the diagonal tile
+        //----------------------------------------------------------------------
+
+        for (int64_t k = k1 ; k < k2 ; k++)
+        {
+            const LG_T *LG_RESTRICT Xk = X + k * n ;
+            for (int64_t i = k1 ; i < k2 ; i++)
+            {
+                LG_T *LG_RESTRICT Xi = X + i * n ;
+                const LG_T xik = Xi [k] ;
+                if (i == k || xik == INFINITY) continue ;
+                for (int64_t j = k1 ; j < k2 ; j++)
+                {
+                    LG_T x = xik + Xk [j] ;
+                    Xi [j] = (x < Xi [j]) ? x : Xi [j] ;
+                }
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // phase 2: the tiles in row kb and column kb
+        //----------------------------------------------------------------------
+
+        // task t updates the tile (kb,t/2) if t is even, or (t/2,kb) if odd
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (t = 0 ; t < 2 * ntiles ; t++)
+        {
+            const int64_t b = t / 2 ;
+            if (b == kb) continue ;
+            const int64_t b1 = b * LG_FW_TILE ;
+            const int64_t b2 = LAGRAPH_MIN (b1 + LG_FW_TILE, n) ;
+            const int64_t i1 = (t % 2 == 0) ? k1 : b1 ;
+            const int64_t i2 = (t % 2 == 0) ? k2 : b2 ;
+            const int64_t j1 = (t % 2 == 0) ? b1 : k1 ;
+            const int64_t j2 = (t % 2 == 0) ? b2 : k2 ;
+            for (int64_t k = k1 ; k < k2 ; k++)
+            {
+                const LG_T *LG_RESTRICT Xk = X + k * n ;
+                for (int64_t i = i1 ; i < i2 ; i++)
+                {
+                    LG_T *LG_RESTRICT Xi = X + i * n ;
+                    const LG_T xik = Xi [k] ;
+                    if (i == k || xik == INFINITY) continue ;
+                    for (int64_t j = j1 ; j < j2 ; j++)
+                    {
+                        LG_T x = xik + Xk [j] ;
+                        Xi [j] = (x < Xi [j]) ? x : Xi [j] ;
+                    }
+                }
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // phase 3: all other tiles
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (t = 0 ; t < ntiles * ntiles ; t++)
+        {
+            const int64_t ib = t / ntiles ;
+            const int64_t jb = t % ntiles ;
+            if (ib == kb || jb == kb) continue ;
+            const int64_t i1 = ib * LG_FW_TILE ;
+            const int64_t i2 = LAGRAPH_MIN (i1 + LG_FW_TILE, n) ;
+            const int64_t j1 = jb * LG_FW_TILE ;
+            const int64_t j2 = LAGRAPH_MIN (j1 + LG_FW_TILE, n) ;
+            for (int64_t i = i1 ; i < i2 ; i++)
+            {
+                LG_T *LG_RESTRICT Xi = X + i * n ;
+                for (int64_t k = k1 ; k < k2 ; k++)
+                {
+                    const LG_T xik = Xi [k] ;
+                    if (xik == INFINITY) continue ;
+                    const LG_T *LG_RESTRICT Xk = X + k * n ;
+                    for (int64_t j = j1 ; j < j2 ; j++)
+                    {
+                        LG_T x = xik + Xk [j] ;
+                        Xi [j] = (x < Xi [j]) ? x : Xi [j] ;
+                    }
+                }
+            }
+        }
+    }
+}
+
+#undef LG_T
+#undef LG_FW_KERNEL
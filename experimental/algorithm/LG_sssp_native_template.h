@@ -0,0 +1,308 @@
+//------------------------------------------------------------------------------
+// LG_sssp_native_template: delta-stepping kernel for one edge weight type
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This file is #include'd in LAGr_SingleSourceShortestPath_Native.c to create
+// a kernel for each type of edge weights.  LG_T is the type of the edge
+// weights and path lengths, and LG_SSSP_KERNEL is the name of the kernel.
+// Both are #undef'd at the end of this file.
+
+// Node i is owned by task i/bsize.  Only its owner writes dist [i] and
+// relaxed [i], and only its owner places it in a bucket, so no atomics are
+// needed.  Each step has three parallel phases:
+
+// (1) gather: each owner removes stale entries from its part of the current
+//      bucket b, and the live nodes are concatenated into the frontier F.
+//      A node is live if its path length has decreased since its edges were
+//      last relaxed (dist [i] < relaxed [i]); this also removes duplicates.
+// (2) relax: the frontier is split into tasks, and each task relaxes all
+//      edges (light and heavy) of its part of F.  Each improvement t <
+//      dist [j] is appended to the request list of task p for the owner of j.
+// (3) apply: each owner takes the minimum of the requests for its nodes, and
+//      places each improved node j in bucket max (b, floor (dist [j]/delta)).
+
+// The current bucket is revisited until it stays empty.  Relaxing heavy edges
+// together with light edges can relax a heavy edge more than once, if its
+// node reenters the current bucket, but it avoids a second pass over the
+// settled nodes of each bucket.  Heavy edges always reach a later bucket, so
+// this does not change the result.
+
+static int LG_SSSP_KERNEL
+(
+    // output:
+    LG_T *LG_RESTRICT dist,             // size n; dist [i] is the length of
+                                        // the shortest path to node i
+    // input:
+    const GrB_Index *LG_RESTRICT Ap,    // pattern of A in CSR format
+    const GrB_Index *LG_RESTRICT Aj,
+    const LG_T *LG_RESTRICT Ax,         // edge weights, of size 1 if iso
+    const bool A_iso,
+    const int64_t n,
+    const int64_t source,
+    const LG_T delta,
+    const LG_T infinity,
+    // workspace:
+    LG_T *LG_RESTRICT relaxed,          // size n
+    LG_sssp_work *W
+)
+{
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    const int ntasks = W->ntasks ;
+    const int64_t bsize = W->bsize ;
+    const double delta_fp64 = (double) delta ;
+    int64_t *LG_RESTRICT F = W->F ;
+    int64_t *LG_RESTRICT count = W->count ;
+    bool *LG_RESTRICT ok = W->ok ;
+
+    int64_t i ;
+    #pragma omp parallel for num_threads(ntasks) schedule(static)
+    for (i = 0 ; i < n ; i++)
+    {
+        dist [i] = infinity ;
+        relaxed [i] = infinity ;
+    }
+
+    // the near buckets of each owner are base:base+LG_NBUCKETS-1, and all
+    // later buckets are held in its far list
+    int64_t base = 0, b = 0 ;
+    dist [source] = 0 ;
+    if (!LG_sssp_append (LG_BUCKET (W, source / bsize, 0), source, 0))
+    {
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    while (true)
+    {
+
+        //----------------------------------------------------------------------
+        // gather: F = live nodes in bucket b
+        //----------------------------------------------------------------------
+
+        const int64_t k = b - base ;
+        int64_t nb = 0 ;
+        for (int o = 0 ; o < ntasks ; o++)
+        {
+            nb += LG_BUCKET (W, o, k)->nv ;
+        }
+        int nthreads = (int) LAGRAPH_MIN (ntasks, 1 + nb / LG_SSSP_CHUNK) ;
+
+        int o ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (o = 0 ; o < ntasks ; o++)
+        {
+            LG_sssp_list *L = LG_BUCKET (W, o, k) ;
+            int64_t nlive = 0 ;
+            for (int64_t p = 0 ; p < L->nv ; p++)
+            {
+                int64_t j = L->v [p] ;
+                if (dist [j] < relaxed [j])
+                {
+                    relaxed [j] = dist [j] ;
+                    L->v [nlive++] = j ;
+                }
+            }
+            L->nv = nlive ;
+            count [o] = nlive ;
+        }
+
+        int64_t nF = 0 ;
+        for (o = 0 ; o < ntasks ; o++)
+        {
+            int64_t c = count [o] ;
+            count [o] = nF ;
+            nF += c ;
+        }
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (o = 0 ; o < ntasks ; o++)
+        {
+            LG_sssp_list *L = LG_BUCKET (W, o, k) ;
+            memcpy (F + count [o], L->v, L->nv * sizeof (int64_t)) ;
+            L->nv = 0 ;
+        }
+
+        if (nF == 0)
+        {
+
+            //------------------------------------------------------------------
+            // bucket b is done: advance to the next nonempty near bucket
+            //------------------------------------------------------------------
+
+            for (b++ ; b < base + LG_NBUCKETS ; b++)
+            {
+                if (LG_sssp_nonempty (W, b - base)) break ;
+            }
+            if (b < base + LG_NBUCKETS) continue ;
+
+            //------------------------------------------------------------------
+            // all near buckets are empty: find the first live far bucket
+            //------------------------------------------------------------------
+
+            #pragma omp parallel for num_threads(ntasks) schedule(static)
+            for (o = 0 ; o < ntasks ; o++)
+            {
+                LG_sssp_list *L = LG_BUCKET (W, o, LG_NBUCKETS) ;
+                int64_t nlive = 0, bmin = INT64_MAX ;
+                for (int64_t p = 0 ; p < L->nv ; p++)
+                {
+                    int64_t j = L->v [p] ;
+                    if (dist [j] < relaxed [j])
+                    {
+                        int64_t q = LG_sssp_bucket ((double) dist [j],
+                            delta_fp64) ;
+                        bmin = LAGRAPH_MIN (bmin, q) ;
+                        L->v [nlive++] = j ;
+                    }
+                }
+                L->nv = nlive ;
+                count [o] = bmin ;
+            }
+
+            int64_t bmin = INT64_MAX ;
+            for (o = 0 ; o < ntasks ; o++)
+            {
+                bmin = LAGRAPH_MIN (bmin, count [o]) ;
+            }
+            if (bmin == INT64_MAX)
+            {
+                // all buckets are empty
+                break ;
+            }
+
+            //------------------------------------------------------------------
+            // move the near part of each far list into the near buckets
+            //------------------------------------------------------------------
+
+            base = bmin ;
+            b = bmin ;
+            #pragma omp parallel for num_threads(ntasks) schedule(static)
+            for (o = 0 ; o < ntasks ; o++)
+            {
+                LG_sssp_list *L = LG_BUCKET (W, o, LG_NBUCKETS) ;
+                int64_t nfar = 0 ;
+                for (int64_t p = 0 ; p < L->nv ; p++)
+                {
+                    int64_t j = L->v [p] ;
+                    int64_t q = LAGRAPH_MAX (base, LG_sssp_bucket (
+                        (double) dist [j], delta_fp64)) ;
+                    if (q < base + LG_NBUCKETS)
+                    {
+                        if (!LG_sssp_append (LG_BUCKET (W, o, q - base), j, 0))
+                        {
+                            ok [o] = false ;
+                            break ;
+                        }
+                    }
+                    else
+                    {
+                        L->v [nfar++] = j ;
+                    }
+                }
+                L->nv = nfar ;
+            }
+
+            for (o = 0 ; o < ntasks ; o++)
+            {
+                if (!ok [o]) return (GrB_OUT_OF_MEMORY) ;
+            }
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // relax: relax all edges of the nodes in F
+        //----------------------------------------------------------------------
+
+        nthreads = (int) LAGRAPH_MIN (ntasks, 1 + nF / LG_SSSP_CHUNK) ;
+        int p ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+        for (p = 0 ; p < nthreads ; p++)
+        {
+            int64_t f1, f2 ;
+            LG_PARTITION (f1, f2, nF, p, nthreads) ;
+            for (int64_t f = f1 ; f < f2 && ok [p] ; f++)
+            {
+                int64_t u = F [f] ;
+                LG_T du = dist [u] ;
+                for (int64_t e = Ap [u] ; e < Ap [u+1] ; e++)
+                {
+                    int64_t j = Aj [e] ;
+                    LG_T t = du + Ax [A_iso ? 0 : e] ;
+                    if (t < dist [j])
+                    {
+                        LG_sssp_list *R = LG_REQUEST (W, p, j / bsize) ;
+                        if (!LG_sssp_append (R, j, sizeof (LG_T)))
+                        {
+                            ok [p] = false ;
+                            break ;
+                        }
+                        ((LG_T *) R->x) [R->nv - 1] = t ;
+                    }
+                }
+            }
+        }
+
+        for (p = 0 ; p < nthreads ; p++)
+        {
+            if (!ok [p]) return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        //----------------------------------------------------------------------
+        // apply: each owner applies the requests for its nodes
+        //----------------------------------------------------------------------
+
+        const int nrequests = nthreads ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (o = 0 ; o < ntasks ; o++)
+        {
+            for (int r = 0 ; r < nrequests && ok [o] ; r++)
+            {
+                LG_sssp_list *R = LG_REQUEST (W, r, o) ;
+                const LG_T *LG_RESTRICT Rx = (LG_T *) R->x ;
+                for (int64_t s = 0 ; s < R->nv ; s++)
+                {
+                    int64_t j = R->v [s] ;
+                    LG_T t = Rx [s] ;
+                    if (t < dist [j])
+                    {
+                        dist [j] = t ;
+                        int64_t q = LAGRAPH_MAX (b, LG_sssp_bucket ((double) t,
+                            delta_fp64)) ;
+                        LG_sssp_list *L = LG_BUCKET (W, o,
+                            LAGRAPH_MIN (q - base, LG_NBUCKETS)) ;
+                        if (!LG_sssp_append (L, j, 0))
+                        {
+                            ok [o] = false ;
+                            break ;
+                        }
+                    }
+                }
+                R->nv = 0 ;
+            }
+        }
+
+        for (o = 0 ; o < ntasks ; o++)
+        {
+            if (!ok [o]) return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
+
+#undef LG_T
+#undef LG_SSSP_KERNEL
@@ -0,0 +1,204 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_BetweennessApprox.c: test approximate BC
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "bcsstk13.mtx",
+    LAGRAPH_UNKNOWN, ""
+} ;
+
+//------------------------------------------------------------------------------
+// setup: start a test
+//------------------------------------------------------------------------------
+
+void setup (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    OK (LAGraph_Random_Init (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// teardown: finalize a test
+//------------------------------------------------------------------------------
+
+void teardown (void)
+{
+    OK (LAGraph_Random_Finalize (msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// difference: max (abs (a - b))
+//------------------------------------------------------------------------------
+
+double difference (GrB_Vector a, GrB_Vector b)
+{
+    GrB_Vector diff = NULL ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, a)) ;
+    OK (GrB_Vector_new (&diff, GrB_FP64, n)) ;
+    OK (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP64, a, b, NULL)) ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP64, diff, NULL)) ;
+    double err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP64, diff, NULL)) ;
+    OK (GrB_free (&diff)) ;
+    return (err) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BetweennessApprox: compare with the exact betweenness centrality
+//------------------------------------------------------------------------------
+
+void test_BetweennessApprox (void)
+{
+    setup ( ) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector c = NULL, capprox = NULL, c2 = NULL ;
+    GrB_Index *sources = NULL ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\n================== Matrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        // exact betweenness centrality, with all nodes as sources
+        OK (LAGraph_Malloc ((void **) &sources, n, sizeof (GrB_Index), msg)) ;
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            sources [i] = i ;
+        }
+        OK (LAGr_Betweenness (&c, G, sources, (int32_t) n, msg)) ;
+        OK (LAGraph_Free ((void **) &sources, NULL)) ;
+
+        double epsilon = 0.1, delta = 0.1 ;
+        int64_t kmax = (int64_t) ceil (log (4 * ((double) n) / delta)
+            / (2 * epsilon * epsilon)) ;
+
+        int64_t nsamples = 0 ;
+        OK (LAGr_BetweennessApprox (&capprox, &nsamples, G, epsilon, delta,
+            42, msg)) ;
+        double err = difference (c, capprox) / (((double) n) * (n-1)) ;
+        printf ("n: %g, samples: %g (at most %g), normalized err: %g\n",
+            (double) n, (double) nsamples, (double) kmax, err) ;
+        if (kmax >= n)
+        {
+            // the exact result is computed
+            TEST_CHECK (nsamples == n) ;
+            TEST_CHECK (err < 1e-12) ;
+        }
+        else
+        {
+            TEST_CHECK (nsamples >= 1 && nsamples <= kmax) ;
+            TEST_CHECK (err <= epsilon) ;
+        }
+
+        // the same seed gives the same result
+        OK (LAGr_BetweennessApprox (&c2, NULL, G, epsilon, delta, 42, msg)) ;
+        bool same = false ;
+        OK (LAGraph_Vector_IsEqual (&same, capprox, c2, msg)) ;
+        TEST_CHECK (same) ;
+
+        OK (GrB_free (&c)) ;
+        OK (GrB_free (&c2)) ;
+        OK (GrB_free (&capprox)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    teardown ( ) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BetweennessApprox_errors
+//------------------------------------------------------------------------------
+
+void test_BetweennessApprox_errors (void)
+{
+    setup ( ) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector c = NULL ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    int result = LAGr_BetweennessApprox (NULL, NULL, G, 0.1, 0.1, 42, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G->AT is required
+    result = LAGr_BetweennessApprox (&c, NULL, G, 0.1, 0.1, 42, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (c == NULL) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+
+    // epsilon and delta must be in the range (0,1)
+    result = LAGr_BetweennessApprox (&c, NULL, G, 0, 0.1, 42, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGr_BetweennessApprox (&c, NULL, G, 0.1, 1, 42, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (c == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    teardown ( ) ;
+}
+
+//------------------------------------------------------------------------------
+// list of tests
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"BetweennessApprox", test_BetweennessApprox},
+    {"BetweennessApprox_errors", test_BetweennessApprox_errors},
+    {NULL, NULL}
+};
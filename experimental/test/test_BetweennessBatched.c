@@ -0,0 +1,212 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_BetweennessBatched.c: test batched BC
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "A.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx",
+    LAGRAPH_UNKNOWN, ""
+} ;
+
+//------------------------------------------------------------------------------
+// difference: max (abs (a - b)) / max (1, max (abs (a)))
+//------------------------------------------------------------------------------
+
+double difference (GrB_Vector a, GrB_Vector b)
+{
+    GrB_Vector diff = NULL ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, a)) ;
+    OK (GrB_Vector_new (&diff, GrB_FP64, n)) ;
+    double anorm = 0, err = 0 ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP64, a, NULL)) ;
+    OK (GrB_reduce (&anorm, NULL, GrB_MAX_MONOID_FP64, diff, NULL)) ;
+    OK (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP64, a, b, NULL)) ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP64, diff, NULL)) ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP64, diff, NULL)) ;
+    OK (GrB_free (&diff)) ;
+    return (err / fmax (1, anorm)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BetweennessBatched: compare with LAGr_Betweenness
+//------------------------------------------------------------------------------
+
+void test_BetweennessBatched (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector c = NULL, cb = NULL ;
+    GrB_Index *sources = NULL ;
+
+    int save_outer, save_inner ;
+    OK (LAGraph_GetNumThreads (&save_outer, &save_inner, msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\n================== Matrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        //----------------------------------------------------------------------
+        // exact centrality, with all nodes as sources
+        //----------------------------------------------------------------------
+
+        OK (LAGraph_Malloc ((void **) &sources, n, sizeof (GrB_Index), msg)) ;
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            sources [i] = i ;
+        }
+        OK (LAGr_Betweenness (&c, G, sources, (int32_t) n, msg)) ;
+
+        // budgets for batches of all nodes, about n/4 nodes, and one node
+        size_t budgets [3] ;
+        budgets [0] = ((size_t) 1) << 40 ;
+        budgets [1] = 2 * sizeof (double) * n + (n/4 + 1) * (64 * n + 8) ;
+        budgets [2] = 12 * sizeof (double) * n ;
+
+        for (int nouter = 1 ; nouter <= 2 ; nouter++)
+        {
+            OK (LAGraph_SetNumThreads (nouter, save_inner, msg)) ;
+            for (int kb = 0 ; kb < 3 ; kb++)
+            {
+                int64_t batch_size = 0 ;
+                OK (LAGr_BetweennessBatched (&cb, &batch_size, G, NULL, 0,
+                    budgets [kb], msg)) ;
+                double err = difference (c, cb) ;
+                printf ("nouter %d budget %g: batch size %g, err %g\n",
+                    nouter, (double) budgets [kb], (double) batch_size, err) ;
+                TEST_CHECK (err < 1e-10) ;
+                TEST_CHECK (batch_size >= 1 && batch_size <= n) ;
+                if (kb == 0) TEST_CHECK (batch_size == n) ;
+                if (kb == 2) TEST_CHECK (batch_size == 1) ;
+                OK (GrB_free (&cb)) ;
+            }
+        }
+        OK (LAGraph_SetNumThreads (save_outer, save_inner, msg)) ;
+        OK (GrB_free (&c)) ;
+
+        //----------------------------------------------------------------------
+        // a given subset of the nodes as sources
+        //----------------------------------------------------------------------
+
+        int64_t ns = LAGRAPH_MIN (n, 7) ;
+        for (int64_t i = 0 ; i < ns ; i++)
+        {
+            sources [i] = (i * 5) % n ;
+        }
+        OK (LAGr_Betweenness (&c, G, sources, (int32_t) ns, msg)) ;
+        int64_t batch_size = 0 ;
+        OK (LAGr_BetweennessBatched (&cb, &batch_size, G, sources, ns,
+            2 * sizeof (double) * n + 2 * 64 * n, msg)) ;
+        double err = difference (c, cb) ;
+        printf ("%g sources, batch size %g, err %g\n", (double) ns,
+            (double) batch_size, err) ;
+        TEST_CHECK (err < 1e-10) ;
+        OK (GrB_free (&c)) ;
+        OK (GrB_free (&cb)) ;
+
+        OK (LAGraph_Free ((void **) &sources, NULL)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BetweennessBatched_errors
+//------------------------------------------------------------------------------
+
+void test_BetweennessBatched_errors (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector c = NULL ;
+    GrB_Index sources [2] = { 0, 1000 } ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    int result = LAGr_BetweennessBatched (NULL, NULL, G, NULL, 0, 1 << 30,
+        msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G->AT is required
+    result = LAGr_BetweennessBatched (&c, NULL, G, NULL, 0, 1 << 30, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+
+    // budget too small
+    result = LAGr_BetweennessBatched (&c, NULL, G, NULL, 0, 100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (c == NULL) ;
+
+    // invalid source
+    result = LAGr_BetweennessBatched (&c, NULL, G, sources, 2, 1 << 30, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (c == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// list of tests
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"BetweennessBatched", test_BetweennessBatched},
+    {"BetweennessBatched_errors", test_BetweennessBatched_errors},
+    {NULL, NULL}
+};
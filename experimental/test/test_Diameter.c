@@ -0,0 +1,206 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_Diameter.c: test cases for LAGr_Diameter
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector level = NULL, ecc_lower = NULL, ecc_upper = NULL ;
+int64_t *ecc = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "A.mtx",
+    "karate.mtx",
+    "LFAT5.mtx",
+    "tree-example.mtx",
+    "ldbc-undirected-example.mtx",
+    "west0067.mtx",
+    "msf1.mtx",
+    "jagmesh7.mtx",
+    "bcsstk13.mtx",
+    ""
+} ;
+
+//------------------------------------------------------------------------------
+// check_ecc: eccentricity of every node, by a BFS from each node
+//------------------------------------------------------------------------------
+
+void check_ecc (int64_t *diam, int64_t *rad, GrB_Index n)
+{
+    (*diam) = 0 ;
+    (*rad) = n ;
+    for (GrB_Index src = 0 ; src < n ; src++)
+    {
+        OK (LAGr_BreadthFirstSearch (&level, NULL, G, src, msg)) ;
+        int64_t e = 0 ;
+        OK (GrB_reduce (&e, NULL, GrB_MAX_MONOID_INT64, level, NULL)) ;
+        OK (GrB_free (&level)) ;
+        ecc [src] = e ;
+        (*diam) = LAGRAPH_MAX (*diam, e) ;
+        (*rad)  = LAGRAPH_MIN (*rad , e) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// test_Diameter
+//------------------------------------------------------------------------------
+
+void test_Diameter (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        // load the matrix as A
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break;
+        printf ("\n%s:\n", aname) ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        TEST_MSG ("Loading of adjacency matrix failed") ;
+
+        // construct a directed graph G with adjacency matrix A
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        TEST_CHECK (A == NULL) ;
+
+        // make the pattern symmetric, if it isn't already
+        OK (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+        if (G->is_symmetric_structure == LAGraph_FALSE)
+        {
+            OK (LAGraph_Cached_AT (G, msg)) ;
+            OK (GrB_eWiseAdd (G->A, NULL, NULL, GrB_LOR, G->A, G->AT, NULL)) ;
+            OK (LAGraph_DeleteCached (G, msg)) ;
+        }
+        G->kind = LAGraph_ADJACENCY_UNDIRECTED ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        OK (LAGraph_Malloc ((void **) &ecc, n, sizeof (int64_t), msg)) ;
+
+        // compute the exact eccentricities the slow way
+        int64_t diam1, rad1 ;
+        check_ecc (&diam1, &rad1, n) ;
+        printf ("n: %g diameter: %g radius: %g\n", (double) n,
+            (double) diam1, (double) rad1) ;
+
+        for (int64_t batch_size = 0 ; batch_size <= 8 ; batch_size += 4)
+        {
+            // compute the diameter and radius
+            int64_t diam2 = -1, rad2 = -1, nbfs = -1 ;
+            OK (LAGr_Diameter (&diam2, &rad2, &ecc_lower, &ecc_upper, &nbfs,
+                G, batch_size, msg)) ;
+            printf ("batch_size: %g, # of BFS: %g\n", (double) batch_size,
+                (double) nbfs) ;
+            TEST_CHECK (diam1 == diam2) ;
+            TEST_CHECK (rad1 == rad2) ;
+            TEST_CHECK (nbfs > 0 && nbfs <= (int64_t) n) ;
+
+            // check the bounds
+            for (GrB_Index i = 0 ; i < n ; i++)
+            {
+                int64_t lo = -1, hi = -1 ;
+                OK (GrB_Vector_extractElement (&lo, ecc_lower, i)) ;
+                OK (GrB_Vector_extractElement (&hi, ecc_upper, i)) ;
+                TEST_CHECK (lo <= ecc [i] && ecc [i] <= hi) ;
+            }
+            OK (GrB_free (&ecc_lower)) ;
+            OK (GrB_free (&ecc_upper)) ;
+
+            // without G->out_degree, the degrees are computed instead, so
+            // the same sources are chosen
+            GrB_Vector deg = G->out_degree ;
+            G->out_degree = NULL ;
+            int64_t nbfs2 = -1 ;
+            diam2 = -1 ;
+            rad2 = -1 ;
+            OK (LAGr_Diameter (&diam2, &rad2, NULL, NULL, &nbfs2, G,
+                batch_size, msg)) ;
+            TEST_CHECK (diam1 == diam2) ;
+            TEST_CHECK (rad1 == rad2) ;
+            TEST_CHECK (nbfs == nbfs2) ;
+
+            // compute just the diameter, without G->out_degree
+            diam2 = -1 ;
+            OK (LAGr_Diameter (&diam2, NULL, NULL, NULL, NULL, G, batch_size,
+                msg)) ;
+            TEST_CHECK (diam1 == diam2) ;
+            G->out_degree = deg ;
+        }
+
+        OK (LAGraph_Free ((void **) &ecc, msg)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_errors
+//------------------------------------------------------------------------------
+
+void test_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    int64_t diameter = 0 ;
+
+    // diameter is NULL
+    int result = LAGr_Diameter (NULL, NULL, NULL, NULL, NULL, G, 0, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G is invalid
+    result = LAGr_Diameter (&diameter, NULL, &ecc_lower, NULL, NULL, NULL, 0,
+        msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    TEST_CHECK (ecc_lower == NULL) ;
+
+    // G->A must be known to be symmetric
+    result = LAGr_Diameter (&diameter, NULL, NULL, NULL, NULL, G, 0, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"Diameter", test_Diameter},
+    {"Diameter_errors", test_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,237 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_FW.c: test LAGraph_FW
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+GrB_Matrix A = NULL, W = NULL, D = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "A.mtx",
+    "cover.mtx",
+    "karate.mtx",
+    "LFAT5.mtx",
+    "west0067.mtx",
+    "ldbc-directed-example.mtx",
+    "msf1.mtx",
+    "jagmesh7.mtx",
+    "test_FW_1000.mtx",
+    ""
+} ;
+
+//------------------------------------------------------------------------------
+// check_fw: compare LAGraph_FW with the classic Floyd-Warshall method
+//------------------------------------------------------------------------------
+
+void check_fw (GrB_Matrix G, GrB_Type expected_type)
+{
+    GrB_Index n, nvals ;
+    OK (GrB_Matrix_nrows (&n, G)) ;
+    OK (GrB_Matrix_nvals (&nvals, G)) ;
+
+    // compute D with LAGraph_FW
+    GrB_Type D_type = NULL ;
+    OK (LAGraph_FW (G, &D, &D_type)) ;
+    TEST_CHECK (D_type == expected_type) ;
+
+    // X = dense copy of G, with zeros on the diagonal
+    GrB_Index *I = NULL, *J = NULL ;
+    double *Gx = NULL, *X = NULL ;
+    OK (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+    OK (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+    OK (LAGraph_Malloc ((void **) &Gx, nvals, sizeof (double), msg)) ;
+    OK (LAGraph_Malloc ((void **) &X, n*n, sizeof (double), msg)) ;
+    OK (GrB_Matrix_extractTuples_FP64 (I, J, Gx, &nvals, G)) ;
+    for (int64_t p = 0 ; p < n*n ; p++)
+    {
+        X [p] = INFINITY ;
+    }
+    for (int64_t p = 0 ; p < nvals ; p++)
+    {
+        X [I [p] * n + J [p]] = Gx [p] ;
+    }
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        X [i * n + i] = LAGRAPH_MIN (X [i * n + i], 0) ;
+    }
+
+    // classic Floyd-Warshall
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            double xik = X [i * n + k] ;
+            if (xik == INFINITY) continue ;
+            for (int64_t j = 0 ; j < n ; j++)
+            {
+                X [i * n + j] = LAGRAPH_MIN (X [i * n + j],
+                    xik + X [k * n + j]) ;
+            }
+        }
+    }
+
+    // compare the results
+    GrB_Index nvals_expected = 0, nvals_D ;
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        for (int64_t j = 0 ; j < n ; j++)
+        {
+            double expected = X [i * n + j], d = INFINITY ;
+            int info = GrB_Matrix_extractElement_FP64 (&d, D, i, j) ;
+            TEST_CHECK (info == GrB_SUCCESS || info == GrB_NO_VALUE) ;
+            TEST_CHECK (d == expected) ;
+            if (expected < INFINITY) nvals_expected++ ;
+        }
+    }
+    OK (GrB_Matrix_nvals (&nvals_D, D)) ;
+    TEST_CHECK (nvals_D == nvals_expected) ;
+
+    OK (LAGraph_Free ((void **) &I, msg)) ;
+    OK (LAGraph_Free ((void **) &J, msg)) ;
+    OK (LAGraph_Free ((void **) &Gx, msg)) ;
+    OK (LAGraph_Free ((void **) &X, msg)) ;
+    OK (GrB_free (&D)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_FW
+//------------------------------------------------------------------------------
+
+void test_FW (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        // load the matrix as A
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break;
+        printf ("\n%s:\n", aname) ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        TEST_MSG ("Loading of adjacency matrix failed") ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, A)) ;
+
+        // W = A with integer edge weights 1 to 255, as GrB_FP64
+        OK (GrB_Matrix_new (&W, GrB_INT32, n, n)) ;
+        OK (GrB_assign (W, NULL, NULL, A, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+        OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (W, NULL, NULL,
+            GrB_BAND_INT32, W, 255, NULL)) ;
+        OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (W, NULL, NULL,
+            GrB_MAX_INT32, W, 1, NULL)) ;
+        OK (GrB_free (&A)) ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+        OK (GrB_assign (A, NULL, NULL, W, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+        check_fw (A, GrB_FP64) ;
+
+        // the same weights as GrB_INT32 and GrB_FP32
+        check_fw (W, GrB_FP64) ;
+        OK (GrB_free (&W)) ;
+        OK (GrB_Matrix_new (&W, GrB_FP32, n, n)) ;
+        OK (GrB_assign (W, NULL, NULL, A, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+        check_fw (W, GrB_FP32) ;
+        OK (GrB_free (&W)) ;
+
+        // negative weights in a graph with no cycles: W = -tril (A,-1)
+        OK (GrB_Matrix_new (&W, GrB_FP64, n, n)) ;
+        OK (GrB_select (W, NULL, NULL, GrB_TRIL, A, -1, NULL)) ;
+        OK (GrB_apply (W, NULL, NULL, GrB_AINV_FP64, W, NULL)) ;
+        check_fw (W, GrB_FP64) ;
+        OK (GrB_free (&W)) ;
+        OK (GrB_free (&A)) ;
+    }
+
+    // a dense random graph, with 1 and 4 threads
+    int nthreads_outer, nthreads_inner ;
+    OK (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    OK (LAGraph_Random_Init (msg)) ;
+    OK (LAGraph_Random_Matrix (&W, GrB_UINT8, 300, 300, 0.2, 42, msg)) ;
+    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+    {
+        OK (LAGraph_SetNumThreads (1, nthreads, msg)) ;
+        check_fw (W, GrB_FP64) ;
+    }
+    OK (LAGraph_SetNumThreads (nthreads_outer, nthreads_inner, msg)) ;
+    OK (GrB_free (&W)) ;
+    OK (LAGraph_Random_Finalize (msg)) ;
+
+    // an empty graph
+    OK (GrB_Matrix_new (&W, GrB_BOOL, 5, 5)) ;
+    check_fw (W, GrB_FP64) ;
+    OK (GrB_free (&W)) ;
+
+    // a complete graph with all edge weights zero, so that D is iso
+    for (GrB_Index n = 1 ; n <= 100 ; n *= 10)
+    {
+        OK (GrB_Matrix_new (&W, GrB_FP64, n, n)) ;
+        OK (GrB_assign (W, NULL, NULL, (double) 0, GrB_ALL, n, GrB_ALL, n,
+            NULL)) ;
+        check_fw (W, GrB_FP64) ;
+        OK (GrB_free (&W)) ;
+        OK (GrB_Matrix_new (&W, GrB_FP32, n, n)) ;
+        OK (GrB_assign (W, NULL, NULL, (float) 0, GrB_ALL, n, GrB_ALL, n,
+            NULL)) ;
+        check_fw (W, GrB_FP32) ;
+        OK (GrB_free (&W)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_errors
+//------------------------------------------------------------------------------
+
+void test_errors (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Type D_type = NULL ;
+
+    OK (GrB_Matrix_new (&W, GrB_FP64, 3, 4)) ;
+
+    // G is not square
+    int result = LAGraph_FW (W, &D, &D_type) ;
+    printf ("\nresult: %d\n", result) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (D == NULL) ;
+
+    // D is NULL
+    result = LAGraph_FW (W, NULL, &D_type) ;
+    printf ("result: %d\n", result) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (GrB_free (&W)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"FW", test_FW},
+    {"FW_errors", test_errors},
+    {NULL, NULL}
+};
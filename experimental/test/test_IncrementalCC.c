@@ -0,0 +1,211 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_IncrementalCC.c: test incremental CC
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL, G0 = NULL ;
+LAGraph_IncrementalCC state = NULL ;
+GrB_Matrix A = NULL, A0 = NULL, L = NULL, L1 = NULL, L2 = NULL, E1 = NULL,
+    E2 = NULL ;
+GrB_Vector C = NULL, C0 = NULL, C1 = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "karate.mtx",
+    "A.mtx",
+    "jagmesh7.mtx",
+    "ldbc-cdlp-undirected-example.mtx",
+    "ldbc-undirected-example.mtx",
+    "ldbc-wcc-example.mtx",
+    "LFAT5.mtx",
+    "LFAT5_hypersparse.mtx",
+    "LFAT5_two.mtx",
+    "bcsstk13.mtx",
+    "tree-example.mtx",
+    "zenios.mtx",
+    "",
+} ;
+
+//------------------------------------------------------------------------------
+// test_IncrementalCC
+//------------------------------------------------------------------------------
+
+void test_IncrementalCC (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        //----------------------------------------------------------------------
+        // load the adjacency matrix as A
+        //----------------------------------------------------------------------
+
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\n================== Matrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, A)) ;
+
+        //----------------------------------------------------------------------
+        // split the edges of A into A0 and two batches E1 and E2
+        //----------------------------------------------------------------------
+
+        // L = tril (A,-1), L1 = L (0:n/2,:), and L2 is the rest of L
+        OK (GrB_Matrix_new (&L, GrB_BOOL, n, n)) ;
+        OK (GrB_Matrix_new (&L1, GrB_BOOL, n, n)) ;
+        OK (GrB_Matrix_new (&L2, GrB_BOOL, n, n)) ;
+        OK (GrB_select (L, NULL, NULL, GrB_TRIL, A, (int64_t) -1, NULL)) ;
+        OK (GrB_select (L1, NULL, NULL, GrB_ROWLE, L, (int64_t) (n/2), NULL)) ;
+        OK (GrB_select (L2, NULL, NULL, GrB_ROWGT, L, (int64_t) (n/2), NULL)) ;
+
+        // A0 = L1 + L1'
+        OK (GrB_Matrix_new (&A0, GrB_BOOL, n, n)) ;
+        OK (GrB_eWiseAdd (A0, NULL, NULL, GrB_LOR, L1, L1, GrB_DESC_T1)) ;
+
+        // E1 = L2 (:,0:n/3), and E2 is the rest of L2
+        OK (GrB_Matrix_new (&E1, GrB_BOOL, n, n)) ;
+        OK (GrB_Matrix_new (&E2, GrB_BOOL, n, n)) ;
+        OK (GrB_select (E1, NULL, NULL, GrB_COLLE, L2, (int64_t) (n/3), NULL)) ;
+        OK (GrB_select (E2, NULL, NULL, GrB_COLGT, L2, (int64_t) (n/3), NULL)) ;
+
+        //----------------------------------------------------------------------
+        // C: the connected components of A, and C0 of A0
+        //----------------------------------------------------------------------
+
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        OK (LAGr_ConnectedComponents (&C, G, msg)) ;
+        OK (LAGraph_New (&G0, &A0, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        OK (LAGr_ConnectedComponents (&C0, G0, msg)) ;
+
+        //----------------------------------------------------------------------
+        // create the incremental CC from G0 and insert E1 and E2
+        //----------------------------------------------------------------------
+
+        bool ok = false ;
+        OK (LAGr_IncrementalCC_New (&state, G0, msg)) ;
+        OK (LAGraph_IncrementalCC_Component (&C1, state, msg)) ;
+        OK (LAGraph_Vector_IsEqual (&ok, C1, C0, msg)) ;
+        TEST_CHECK (ok) ;
+        OK (GrB_free (&C1)) ;
+
+        OK (LAGraph_IncrementalCC_Insert (state, E1, msg)) ;
+        OK (LAGraph_IncrementalCC_Insert (state, E2, msg)) ;
+        OK (LAGraph_IncrementalCC_Component (&C1, state, msg)) ;
+        OK (LAGraph_Vector_IsEqual (&ok, C1, C, msg)) ;
+        TEST_CHECK (ok) ;
+        OK (LG_check_cc (C1, G, msg)) ;
+        OK (GrB_free (&C1)) ;
+
+        // inserting edges already in the graph does not change the result
+        OK (LAGraph_IncrementalCC_Insert (state, L, msg)) ;
+        OK (GrB_Matrix_clear (E1)) ;
+        OK (LAGraph_IncrementalCC_Insert (state, E1, msg)) ;
+        OK (LAGraph_IncrementalCC_Component (&C1, state, msg)) ;
+        OK (LAGraph_Vector_IsEqual (&ok, C1, C, msg)) ;
+        TEST_CHECK (ok) ;
+
+        //----------------------------------------------------------------------
+        // free everything
+        //----------------------------------------------------------------------
+
+        OK (LAGraph_IncrementalCC_Delete (&state, msg)) ;
+        TEST_CHECK (state == NULL) ;
+        OK (GrB_free (&C)) ;
+        OK (GrB_free (&C0)) ;
+        OK (GrB_free (&C1)) ;
+        OK (GrB_free (&L)) ;
+        OK (GrB_free (&L1)) ;
+        OK (GrB_free (&L2)) ;
+        OK (GrB_free (&E1)) ;
+        OK (GrB_free (&E2)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+        OK (LAGraph_Delete (&G0, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_IncrementalCC_errors
+//------------------------------------------------------------------------------
+
+void test_IncrementalCC_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    int result = LAGr_IncrementalCC_New (NULL, G, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (LAGr_IncrementalCC_New (&state, G, msg)) ;
+    result = LAGraph_IncrementalCC_Insert (state, NULL, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_IncrementalCC_Component (NULL, state, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // E must be n-by-n
+    OK (GrB_Matrix_new (&E1, GrB_BOOL, 3, 3)) ;
+    result = LAGraph_IncrementalCC_Insert (state, E1, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+    OK (GrB_free (&E1)) ;
+    OK (LAGraph_IncrementalCC_Delete (&state, msg)) ;
+    OK (LAGraph_IncrementalCC_Delete (&state, msg)) ;
+    OK (LAGraph_IncrementalCC_Delete (NULL, msg)) ;
+
+    // the graph must have a symmetric structure
+    G->kind = LAGraph_ADJACENCY_DIRECTED ;
+    G->is_symmetric_structure = LAGRAPH_UNKNOWN ;
+    result = LAGr_IncrementalCC_New (&state, G, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED) ;
+    TEST_CHECK (state == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// list of tests
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"IncrementalCC", test_IncrementalCC},
+    {"IncrementalCC_errors", test_IncrementalCC_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,255 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_KCliqueCount.c: test k-clique counting
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    uint64_t ntriangles ;           // # triangles in original matrix
+    const char *name ;              // matrix filename
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    {     45, "karate.mtx" },
+    {     11, "A.mtx" },
+    {   2016, "jagmesh7.mtx" },
+    {      6, "ldbc-cdlp-undirected-example.mtx" },
+    {      4, "ldbc-undirected-example.mtx" },
+    {      0, "LFAT5.mtx" },
+    { 342300, "bcsstk13.mtx" },
+    {      0, "tree-example.mtx" },
+    {      0, "" },
+} ;
+
+//------------------------------------------------------------------------------
+// dense adjacency matrix of a small graph, for the brute-force count
+//------------------------------------------------------------------------------
+
+#define NMAX 100
+bool Adj [NMAX][NMAX] ;
+int64_t nclique_calls = 0, nclique_bad = 0 ;
+
+// check_clique: callback that checks that each clique is complete
+void check_clique (const int64_t *clique, int k, void *arg)
+{
+    bool ok = true ;
+    for (int a = 0 ; a < k ; a++)
+    {
+        for (int b = a+1 ; b < k ; b++)
+        {
+            ok = ok && Adj [clique [a]][clique [b]] ;
+        }
+    }
+    #pragma omp atomic
+    nclique_calls++ ;
+    if (!ok)
+    {
+        #pragma omp atomic
+        nclique_bad++ ;
+    }
+}
+
+// brute_force: count the k-cliques that extend clique [0:level-1]
+uint64_t brute_force (int64_t n, int k, int64_t *clique, int level)
+{
+    if (level == k) return (1) ;
+    uint64_t c = 0 ;
+    int64_t first = (level == 0) ? 0 : clique [level-1] + 1 ;
+    for (int64_t v = first ; v < n ; v++)
+    {
+        bool ok = true ;
+        for (int a = 0 ; a < level && ok ; a++)
+        {
+            ok = Adj [clique [a]][v] ;
+        }
+        if (ok)
+        {
+            clique [level] = v ;
+            c += brute_force (n, k, clique, level+1) ;
+        }
+    }
+    return (c) ;
+}
+
+//------------------------------------------------------------------------------
+// test_KCliqueCount
+//------------------------------------------------------------------------------
+
+void test_KCliqueCount (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector count = NULL, t = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the adjacency matrix as A
+        const char *aname = files [k].name ;
+        uint64_t ntriangles = files [k].ntriangles ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\n================== Matrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+
+        // create the graph
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        OK (LAGraph_DeleteSelfEdges (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        GrB_Index n, nvals ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        OK (GrB_Matrix_nvals (&nvals, G->A)) ;
+
+        // 2-cliques are the edges, and 3-cliques are the triangles
+        uint64_t ncliques = 0 ;
+        OK (LAGr_KCliqueCount (&ncliques, NULL, G, 2, NULL, NULL, msg)) ;
+        TEST_CHECK (ncliques == nvals / 2) ;
+        OK (LAGr_KCliqueCount (&ncliques, &count, G, 3, NULL, NULL, msg)) ;
+        printf ("# triangles: %g\n", (double) ncliques) ;
+        TEST_CHECK (ncliques == ntriangles) ;
+
+        // the count of each node is the same as from the triangle counts
+        bool ok = false ;
+        OK (LAGr_TriangleCount_PerVertex (&t, G, NULL, NULL, msg)) ;
+        OK (LAGraph_Vector_IsEqual (&ok, count, t, msg)) ;
+        TEST_CHECK (ok) ;
+        OK (GrB_free (&count)) ;
+        OK (GrB_free (&t)) ;
+
+        for (int kc = 4 ; kc <= 5 ; kc++)
+        {
+            // sum (count) is kc times the number of kc-cliques
+            OK (LAGr_KCliqueCount (&ncliques, &count, G, kc, NULL, NULL,
+                msg)) ;
+            int64_t csum = 0 ;
+            OK (GrB_reduce (&csum, NULL, GrB_PLUS_MONOID_INT64, count, NULL)) ;
+            printf ("# %d-cliques: %g\n", kc, (double) ncliques) ;
+            TEST_CHECK (csum == kc * ncliques) ;
+            OK (GrB_free (&count)) ;
+
+            if (n <= NMAX)
+            {
+                // compare with a brute-force count
+                memset (Adj, 0, sizeof (Adj)) ;
+                OK (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index),
+                    msg)) ;
+                OK (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index),
+                    msg)) ;
+                GrB_Index nv = nvals ;
+                OK (GrB_Matrix_extractTuples (I, J, (void *) NULL, &nv,
+                    G->A)) ;
+                for (int64_t p = 0 ; p < nvals ; p++)
+                {
+                    Adj [I [p]][J [p]] = true ;
+                }
+                OK (LAGraph_Free ((void **) &I, NULL)) ;
+                OK (LAGraph_Free ((void **) &J, NULL)) ;
+                int64_t clique [NMAX] ;
+                uint64_t nbrute = brute_force (n, kc, clique, 0) ;
+                TEST_CHECK (ncliques == nbrute) ;
+
+                // list the cliques with the callback
+                nclique_calls = 0 ;
+                nclique_bad = 0 ;
+                uint64_t nc2 = 0 ;
+                OK (LAGr_KCliqueCount (&nc2, NULL, G, kc, check_clique, NULL,
+                    msg)) ;
+                TEST_CHECK (nc2 == ncliques) ;
+                TEST_CHECK (nclique_calls == ncliques) ;
+                TEST_CHECK (nclique_bad == 0) ;
+            }
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_KCliqueCount_errors
+//------------------------------------------------------------------------------
+
+void test_KCliqueCount_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix A = NULL ;
+    uint64_t ncliques = 0 ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    int result = LAGr_KCliqueCount (&ncliques, NULL, NULL, 3, NULL, NULL,
+        msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G->nself_edges is required
+    result = LAGr_KCliqueCount (&ncliques, NULL, G, 3, NULL, NULL, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NO_SELF_EDGES_ALLOWED) ;
+    OK (LAGraph_Cached_NSelfEdges (G, msg)) ;
+
+    // G->out_degree is required
+    result = LAGr_KCliqueCount (&ncliques, NULL, G, 3, NULL, NULL, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    // k must be 2 or more
+    result = LAGr_KCliqueCount (&ncliques, NULL, G, 1, NULL, NULL, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    // the graph must have a symmetric structure
+    G->kind = LAGraph_ADJACENCY_DIRECTED ;
+    G->is_symmetric_structure = LAGRAPH_UNKNOWN ;
+    result = LAGr_KCliqueCount (&ncliques, NULL, G, 3, NULL, NULL, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// list of tests
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"KCliqueCount", test_KCliqueCount},
+    {"KCliqueCount_errors", test_KCliqueCount_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,227 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_MultiSourceShortestPath.c
+//----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL, D = NULL ;
+GrB_Scalar Delta = NULL ;
+GrB_Vector path_length = NULL, Drow = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+#define NSOURCES 8
+GrB_Index sources [NSOURCES] ;
+
+const char *files [ ] =
+{
+    "A.mtx",
+    "cover.mtx",
+    "jagmesh7.mtx",
+    "ldbc-directed-example.mtx",
+    "ldbc-undirected-example.mtx",
+    "LFAT5.mtx",
+    "msf1.mtx",
+    "msf2.mtx",
+    "sample.mtx",
+    "tree-example.mtx",
+    "west0067.mtx",
+    "test_BF.mtx",
+    "cryg2500.mtx",
+    ""
+} ;
+
+//------------------------------------------------------------------------------
+// check_rows: compare each row of D with LAGr_SingleSourceShortestPath
+//------------------------------------------------------------------------------
+
+void check_rows (int64_t ns, GrB_Index n)
+{
+    GrB_Index nrows, ncols, nvals ;
+    OK (GrB_Matrix_nrows (&nrows, D)) ;
+    OK (GrB_Matrix_ncols (&ncols, D)) ;
+    OK (GrB_Matrix_nvals (&nvals, D)) ;
+    TEST_CHECK (nrows == ns && ncols == n && nvals == ns * n) ;
+    for (int64_t k = 0 ; k < ns ; k++)
+    {
+        // Drow = D (k,:)'
+        OK (GrB_Vector_new (&Drow, GrB_INT32, n)) ;
+        OK (GrB_Col_extract (Drow, NULL, NULL, D, GrB_ALL, n, k,
+            GrB_DESC_T0)) ;
+        OK (LAGr_SingleSourceShortestPath (&path_length, G, sources [k],
+            Delta, msg)) ;
+        bool ok = false ;
+        OK (LAGraph_Vector_IsEqual (&ok, Drow, path_length, msg)) ;
+        TEST_CHECK (ok) ;
+        OK (GrB_free (&Drow)) ;
+        OK (GrB_free (&path_length)) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// test_MultiSourceShortestPath
+//------------------------------------------------------------------------------
+
+void test_MultiSourceShortestPath (void)
+{
+    LAGraph_Init (msg) ;
+    OK (GrB_Scalar_new (&Delta, GrB_INT32)) ;
+    int nthreads_outer, nthreads_inner ;
+    OK (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        // load the matrix as A
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break;
+        printf ("\n%s:\n", aname) ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        GrB_Matrix T = NULL ;
+        OK (LAGraph_MMRead (&T, f, msg)) ;
+        OK (fclose (f)) ;
+        TEST_MSG ("Loading of adjacency matrix failed") ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, T)) ;
+
+        // A = T with edge weights 1 to 15
+        OK (GrB_Matrix_new (&A, GrB_INT32, n, n)) ;
+        OK (GrB_assign (A, NULL, NULL, T, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+        OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (A, NULL, NULL,
+            GrB_BAND_INT32, A, 15, NULL)) ;
+        OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (A, NULL, NULL,
+            GrB_MAX_INT32, A, 1, NULL)) ;
+        OK (GrB_free (&T)) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        OK (LAGraph_Cached_EMin (G, msg)) ;
+
+        // pick the sources, with a duplicate
+        int64_t ns = LAGRAPH_MIN (NSOURCES, n) ;
+        for (int64_t i = 0 ; i < ns ; i++)
+        {
+            sources [i] = (i * 7919) % n ;
+        }
+        if (ns > 2) sources [ns-1] = sources [0] ;
+
+        for (int32_t delta = 1 ; delta <= 64 ; delta *= 8)
+        {
+            OK (GrB_Scalar_setElement (Delta, delta)) ;
+
+            // all sources searched together
+            OK (LAGraph_SetNumThreads (1, nthreads_inner, msg)) ;
+            OK (LAGr_MultiSourceShortestPath (&D, G, sources, ns, Delta,
+                msg)) ;
+            check_rows (ns, n) ;
+            OK (GrB_free (&D)) ;
+
+            // sources split into groups of 1 to 3
+            for (int nouter = 2 ; nouter <= 4 ; nouter++)
+            {
+                OK (LAGraph_SetNumThreads (nouter, 1, msg)) ;
+                OK (LAGr_MultiSourceShortestPath (&D, G, sources, ns, Delta,
+                    msg)) ;
+                OK (LAGraph_SetNumThreads (nthreads_outer, nthreads_inner,
+                    msg)) ;
+                check_rows (ns, n) ;
+                OK (GrB_free (&D)) ;
+            }
+            OK (LAGraph_SetNumThreads (nthreads_outer, nthreads_inner, msg)) ;
+        }
+
+        // no sources
+        OK (LAGr_MultiSourceShortestPath (&D, G, sources, 0, Delta, msg)) ;
+        GrB_Index nrows ;
+        OK (GrB_Matrix_nrows (&nrows, D)) ;
+        TEST_CHECK (nrows == 0) ;
+        OK (GrB_free (&D)) ;
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (GrB_free (&Delta)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_errors
+//------------------------------------------------------------------------------
+
+void test_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (GrB_Scalar_new (&Delta, GrB_INT32)) ;
+    OK (GrB_Scalar_setElement (Delta, 1)) ;
+    sources [0] = 0 ;
+    sources [1] = 1 ;
+
+    // karate is bool, which is not supported
+    int result = LAGr_MultiSourceShortestPath (&D, G, sources, 2, Delta, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NOT_IMPLEMENTED) ;
+    TEST_CHECK (D == NULL) ;
+
+    // D is NULL
+    result = LAGr_MultiSourceShortestPath (NULL, G, sources, 2, Delta, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // sources is NULL
+    result = LAGr_MultiSourceShortestPath (&D, G, NULL, 2, Delta, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // ns is negative
+    result = LAGr_MultiSourceShortestPath (&D, G, sources, -1, Delta, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    // Delta is empty
+    OK (GrB_Scalar_clear (Delta)) ;
+    result = LAGr_MultiSourceShortestPath (&D, G, sources, 2, Delta, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_EMPTY_OBJECT) ;
+
+    // a source is invalid
+    OK (GrB_Scalar_setElement (Delta, 1)) ;
+    sources [1] = 1000 ;
+    result = LAGr_MultiSourceShortestPath (&D, G, sources, 2, Delta, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+
+    OK (GrB_free (&Delta)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"MultiSourceShortestPath", test_MultiSourceShortestPath},
+    {"MultiSourceShortestPath_errors", test_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,263 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_PageRankActiveSet.c: test active-set PR
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",  // has sinks
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",                  // has sinks
+    LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "bcsstk13.mtx",
+    LAGRAPH_UNKNOWN, ""
+} ;
+
+//------------------------------------------------------------------------------
+// difference: max (abs (a - b))
+//------------------------------------------------------------------------------
+
+float difference (GrB_Vector a, GrB_Vector b)
+{
+    GrB_Vector diff = NULL ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, a)) ;
+    OK (GrB_Vector_new (&diff, GrB_FP32, n)) ;
+    OK (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP32, a, b, NULL)) ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP32, diff, NULL)) ;
+    float err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP32, diff, NULL)) ;
+    OK (GrB_free (&diff)) ;
+    return (err) ;
+}
+
+//------------------------------------------------------------------------------
+// residual: sum (abs (t - r)), where t is one full pagerank step from r
+//------------------------------------------------------------------------------
+
+// LAGr_PageRankActiveSet stops only when a full iteration changes the ranks by
+// at most tol, and it returns the result of that iteration.  One more full
+// step from the result must then also change it by at most about tol.  The
+// step is done here in double precision, with sinks handled as in
+// LAGr_PageRank, and without scaling r to sum to 1.
+
+double residual (LAGraph_Graph G, GrB_Vector r, double damping)
+{
+    GrB_Vector d = NULL, w = NULL, t = NULL, rsink = NULL ;
+    GrB_Matrix AT = (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE) ? G->A : G->AT ;
+    GrB_Vector d_out = G->out_degree ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, r)) ;
+
+    // d = max (d_out / damping, 1 / damping)
+    OK (GrB_Vector_new (&d, GrB_FP64, n)) ;
+    OK (GrB_assign (d, NULL, NULL, 1 / damping, GrB_ALL, n, NULL)) ;
+    OK (GrB_apply (d, NULL, GrB_MAX_FP64, GrB_DIV_FP64, d_out, damping,
+        NULL)) ;
+
+    // teleport = (1 - damping) / n + (damping / n) * sum (r (sinks))
+    OK (GrB_Vector_new (&rsink, GrB_FP64, n)) ;
+    OK (GrB_assign (rsink, d_out, NULL, r, GrB_ALL, n, GrB_DESC_SC)) ;
+    double sum_rsink = 0 ;
+    OK (GrB_reduce (&sum_rsink, NULL, GrB_PLUS_MONOID_FP64, rsink, NULL)) ;
+    double teleport = (1 - damping) / n + (damping / n) * sum_rsink ;
+
+    // t = teleport + AT * (r ./ d)
+    OK (GrB_Vector_new (&w, GrB_FP64, n)) ;
+    OK (GrB_eWiseMult (w, NULL, NULL, GrB_DIV_FP64, r, d, NULL)) ;
+    OK (GrB_Vector_new (&t, GrB_FP64, n)) ;
+    OK (GrB_assign (t, NULL, NULL, teleport, GrB_ALL, n, NULL)) ;
+    OK (GrB_mxv (t, NULL, GrB_PLUS_FP64, LAGraph_plus_second_fp64, AT, w,
+        NULL)) ;
+
+    // resid = sum (abs (t - r))
+    OK (GrB_eWiseAdd (t, NULL, NULL, GrB_MINUS_FP64, t, r, NULL)) ;
+    OK (GrB_apply (t, NULL, NULL, GrB_ABS_FP64, t, NULL)) ;
+    double resid = 0 ;
+    OK (GrB_reduce (&resid, NULL, GrB_PLUS_MONOID_FP64, t, NULL)) ;
+
+    OK (GrB_free (&d)) ;
+    OK (GrB_free (&w)) ;
+    OK (GrB_free (&t)) ;
+    OK (GrB_free (&rsink)) ;
+    return (resid) ;
+}
+
+//------------------------------------------------------------------------------
+// check_active_set: check the result of LAGr_PageRankActiveSet
+//------------------------------------------------------------------------------
+
+// The result is compared with LAGr_PageRank, and must pass the check of the
+// final full iteration (see residual above).  iters counts both the full
+// iterations and those on the active set only, and itermax limits them both,
+// so the method succeeds with itermax = iters and fails with itermax =
+// iters-1.
+
+void check_active_set (LAGraph_Graph G, float tol, float errmax)
+{
+    GrB_Vector r = NULL, ras = NULL ;
+    int iters = 0, iters_as = 0 ;
+    OK (LAGr_PageRank (&r, &iters, G, 0.85, tol, 200, msg)) ;
+    OK (LAGr_PageRankActiveSet (&ras, &iters_as, G, 0.85, tol, 200, msg)) ;
+    float err = difference (r, ras) ;
+    double resid = residual (G, ras, 0.85) ;
+    float rsum = 0 ;
+    OK (GrB_reduce (&rsum, NULL, GrB_PLUS_MONOID_FP32, ras, NULL)) ;
+    printf ("tol %g: standard: %d iters, active set: %d iters, err: %g, "
+        "residual: %g, sum (r): %g\n", tol, iters, iters_as, err, resid,
+        rsum) ;
+    TEST_CHECK (err < errmax) ;
+    TEST_CHECK (resid <= tol) ;
+    TEST_CHECK (fabs (rsum - 1) < 1e-3) ;
+    OK (GrB_free (&r)) ;
+    OK (GrB_free (&ras)) ;
+
+    // itermax limits all iterations, full or not
+    int iters2 = 0 ;
+    OK (LAGr_PageRankActiveSet (&ras, &iters2, G, 0.85, tol, iters_as,
+        msg)) ;
+    TEST_CHECK (iters2 == iters_as) ;
+    OK (GrB_free (&ras)) ;
+    int result = LAGr_PageRankActiveSet (&ras, &iters2, G, 0.85, tol,
+        iters_as - 1, msg) ;
+    TEST_CHECK (result == LAGRAPH_CONVERGENCE_FAILURE) ;
+    TEST_CHECK (ras == NULL) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankActiveSet: compare with LAGr_PageRank
+//------------------------------------------------------------------------------
+
+void test_PageRankActiveSet (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\n================== Matrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        check_active_set (G, 1e-6, 1e-4) ;
+        check_active_set (G, 1e-4, 1e-3) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankActiveSet_halving: the active set empties before convergence
+//------------------------------------------------------------------------------
+
+// This graph has two 2-cycles (0 <-> 6 and 1 <-> 5), whose ranks oscillate and
+// settle slowly, and two sinks (3 and 4).  The active set shrinks to a single
+// node and then becomes empty, but the changes ignored for the frozen nodes
+// add up, so the full iteration that follows has not converged.  The method
+// must then halve the threshold and continue with a new active set.  Stopping
+// when the active set first becomes empty would fail the residual check.
+
+void test_PageRankActiveSet_halving (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL ;
+    GrB_Index I [7] = { 0, 0, 1, 2, 2, 5, 6 } ;
+    GrB_Index J [7] = { 4, 6, 5, 5, 6, 1, 0 } ;
+    bool X [7] = { true, true, true, true, true, true, true } ;
+    OK (GrB_Matrix_new (&A, GrB_BOOL, 7, 7)) ;
+    OK (GrB_Matrix_build (A, I, J, X, 7, GrB_LOR)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+    check_active_set (G, 1e-4, 1e-3) ;
+    check_active_set (G, 1e-6, 1e-4) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankActiveSet_errors
+//------------------------------------------------------------------------------
+
+void test_PageRankActiveSet_errors (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector r = NULL ;
+    int iters = 0 ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    int result = LAGr_PageRankActiveSet (NULL, &iters, G, 0.85, 1e-4, 100,
+        msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G->AT and G->out_degree are required
+    result = LAGr_PageRankActiveSet (&r, &iters, G, 0.85, 1e-4, 100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (r == NULL) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    result = LAGr_PageRankActiveSet (&r, &iters, G, 0.85, 1e-4, 100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// list of tests
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"PageRankActiveSet", test_PageRankActiveSet},
+    {"PageRankActiveSet_halving", test_PageRankActiveSet_halving},
+    {"PageRankActiveSet_errors", test_PageRankActiveSet_errors},
+    {NULL, NULL}
+};
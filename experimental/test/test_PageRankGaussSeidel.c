@@ -0,0 +1,170 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_PageRankGaussSeidel.c: test Gauss-Seidel PR
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",  // has sinks
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",                  // has sinks
+    LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "bcsstk13.mtx",
+    LAGRAPH_UNKNOWN, ""
+} ;
+
+//------------------------------------------------------------------------------
+// difference: max (abs (a - b))
+//------------------------------------------------------------------------------
+
+float difference (GrB_Vector a, GrB_Vector b)
+{
+    GrB_Vector diff = NULL ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, a)) ;
+    OK (GrB_Vector_new (&diff, GrB_FP32, n)) ;
+    OK (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP32, a, b, NULL)) ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP32, diff, NULL)) ;
+    float err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP32, diff, NULL)) ;
+    OK (GrB_free (&diff)) ;
+    return (err) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankGaussSeidel: compare with LAGr_PageRank
+//------------------------------------------------------------------------------
+
+void test_PageRankGaussSeidel (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector r = NULL, rgs = NULL ;
+    float tol = 1e-6 ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\n================== Matrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+        int iters = 0, iters_gs = 0 ;
+        OK (LAGr_PageRank (&r, &iters, G, 0.85, tol, 200, msg)) ;
+        OK (LAGr_PageRankGaussSeidel (&rgs, &iters_gs, G, 0.85, tol, 200,
+            msg)) ;
+        float err = difference (r, rgs) ;
+        float rsum = 0 ;
+        OK (GrB_reduce (&rsum, NULL, GrB_PLUS_MONOID_FP32, rgs, NULL)) ;
+        printf ("Jacobi: %d iters, Gauss-Seidel: %d iters, err: %g, "
+            "sum (r): %g\n", iters, iters_gs, err, rsum) ;
+        TEST_CHECK (err < 1e-4) ;
+        TEST_CHECK (fabs (rsum - 1) < 1e-3) ;
+        TEST_CHECK (iters_gs <= iters) ;
+        OK (GrB_free (&rgs)) ;
+
+        // G is restored
+        OK (LAGraph_CheckGraph (G, msg)) ;
+        OK (LAGr_PageRankGaussSeidel (&rgs, &iters_gs, G, 0.85, tol, 200,
+            msg)) ;
+        err = difference (r, rgs) ;
+        TEST_CHECK (err < 1e-4) ;
+        OK (GrB_free (&rgs)) ;
+
+        // failure to converge
+        int result = LAGr_PageRankGaussSeidel (&rgs, &iters_gs, G, 0.85, tol,
+            1, msg) ;
+        TEST_CHECK (result == LAGRAPH_CONVERGENCE_FAILURE) ;
+        TEST_CHECK (rgs == NULL) ;
+        OK (LAGraph_CheckGraph (G, msg)) ;
+
+        OK (GrB_free (&r)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankGaussSeidel_errors
+//------------------------------------------------------------------------------
+
+void test_PageRankGaussSeidel_errors (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector r = NULL ;
+    int iters = 0 ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    int result = LAGr_PageRankGaussSeidel (NULL, &iters, G, 0.85, 1e-4, 100,
+        msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G->AT and G->out_degree are required
+    result = LAGr_PageRankGaussSeidel (&r, &iters, G, 0.85, 1e-4, 100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (r == NULL) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    result = LAGr_PageRankGaussSeidel (&r, &iters, G, 0.85, 1e-4, 100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// list of tests
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"PageRankGaussSeidel", test_PageRankGaussSeidel},
+    {"PageRankGaussSeidel_errors", test_PageRankGaussSeidel_errors},
+    {NULL, NULL}
+};
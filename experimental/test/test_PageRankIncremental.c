@@ -0,0 +1,354 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_PageRankIncremental.c: test pagerank updates
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// Tests LAGr_PageRankWarmStart and LAGr_PageRankIncremental.
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G0 = NULL, G1 = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",  // has sinks
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",                  // has sinks
+    LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx",
+    LAGRAPH_UNKNOWN, ""
+} ;
+
+//------------------------------------------------------------------------------
+// difference: max (abs (a - b))
+//------------------------------------------------------------------------------
+
+float difference (GrB_Vector a, GrB_Vector b)
+{
+    GrB_Vector diff = NULL ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, a)) ;
+    OK (GrB_Vector_new (&diff, GrB_FP32, n)) ;
+    OK (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP32, a, b, NULL)) ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP32, diff, NULL)) ;
+    float err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP32, diff, NULL)) ;
+    OK (GrB_free (&diff)) ;
+    return (err) ;
+}
+
+//------------------------------------------------------------------------------
+// change_edge: insert or delete the edge (i,j), and record it in E
+//------------------------------------------------------------------------------
+
+void change_edge (GrB_Matrix A, GrB_Matrix E, GrB_Index i, GrB_Index j,
+    bool undirected)
+{
+    if (i == j) return ;
+    bool x ;
+    int info = GrB_Matrix_extractElement_BOOL (&x, A, i, j) ;
+    for (int k = 0 ; k < (undirected ? 2 : 1) ; k++)
+    {
+        if (info == GrB_SUCCESS)
+        {
+            OK (GrB_Matrix_removeElement (A, i, j)) ;
+        }
+        else
+        {
+            OK (GrB_Matrix_setElement_BOOL (A, true, i, j)) ;
+        }
+        OK (GrB_Matrix_setElement_BOOL (E, true, i, j)) ;
+        GrB_Index t = i ; i = j ; j = t ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankIncremental
+//------------------------------------------------------------------------------
+
+void test_PageRankIncremental (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL, E = NULL ;
+    GrB_Vector r0 = NULL, r1 = NULL, r = NULL ;
+    float tol = 1e-6 ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        //----------------------------------------------------------------------
+        // load the graph G0 and compute its pagerank
+        //----------------------------------------------------------------------
+
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        LAGraph_Kind kind = files [k].kind ;
+        bool undirected = (kind == LAGraph_ADJACENCY_UNDIRECTED) ;
+        TEST_CASE (aname) ;
+        printf ("\n================== Matrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, A)) ;
+
+        GrB_Matrix A0 = NULL ;
+        OK (GrB_Matrix_dup (&A0, A)) ;
+        OK (LAGraph_New (&G0, &A0, kind, msg)) ;
+        OK (LAGraph_Cached_AT (G0, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G0, msg)) ;
+        int iters0 = 0 ;
+        OK (LAGr_PageRank (&r0, &iters0, G0, 0.85, tol, 200, msg)) ;
+
+        //----------------------------------------------------------------------
+        // G1 = G0 with a batch of edge changes
+        //----------------------------------------------------------------------
+
+        OK (GrB_Matrix_new (&E, GrB_BOOL, n, n)) ;
+        for (GrB_Index i = 0 ; i < n ; i += 5)
+        {
+            change_edge (A, E, i, (i * 7 + 3) % n, undirected) ;
+        }
+        if (!undirected)
+        {
+            // node 1 becomes a sink: delete all its out-edges
+            for (GrB_Index j = 0 ; j < n ; j++)
+            {
+                bool x ;
+                if (GrB_Matrix_extractElement_BOOL (&x, A, 1, j)
+                    == GrB_SUCCESS)
+                {
+                    change_edge (A, E, 1, j, false) ;
+                }
+            }
+        }
+        OK (LAGraph_New (&G1, &A, kind, msg)) ;
+        OK (LAGraph_Cached_AT (G1, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G1, msg)) ;
+        int iters1 = 0 ;
+        OK (LAGr_PageRank (&r1, &iters1, G1, 0.85, tol, 200, msg)) ;
+
+        //----------------------------------------------------------------------
+        // warm start from the pagerank of G0
+        //----------------------------------------------------------------------
+
+        int iters = 0 ;
+        OK (LAGr_PageRankWarmStart (&r, &iters, G1, r0, 0.85, tol, 200,
+            msg)) ;
+        float err = difference (r, r1) ;
+        printf ("cold start: %d iters, warm start: %d iters, err %g\n",
+            iters1, iters, err) ;
+        TEST_CHECK (err < 1e-4) ;
+        TEST_CHECK (iters <= iters1) ;
+        OK (GrB_free (&r)) ;
+
+        // with no r0, the result is the same as LAGr_PageRank
+        OK (LAGr_PageRankWarmStart (&r, &iters, G1, NULL, 0.85, tol, 200,
+            msg)) ;
+        TEST_CHECK (iters == iters1) ;
+        err = difference (r, r1) ;
+        TEST_CHECK (err < 1e-6) ;
+        OK (GrB_free (&r)) ;
+
+        //----------------------------------------------------------------------
+        // incremental update of the pagerank of G0
+        //----------------------------------------------------------------------
+
+        OK (GrB_Vector_dup (&r, r0)) ;
+        OK (LAGr_PageRankIncremental (r, &iters, G1, E, 0.85, tol, 1000,
+            msg)) ;
+        err = difference (r, r1) ;
+        float rsum = 0 ;
+        OK (GrB_reduce (&rsum, NULL, GrB_PLUS_MONOID_FP32, r, NULL)) ;
+        printf ("incremental: %d push steps, err %g, sum (r) %g\n",
+            iters, err, rsum) ;
+        TEST_CHECK (err < 1e-4) ;
+        TEST_CHECK (fabs (rsum - 1) < 1e-3) ;
+        OK (GrB_free (&r)) ;
+
+        // no change
+        OK (GrB_Vector_dup (&r, r1)) ;
+        OK (GrB_Matrix_clear (E)) ;
+        OK (LAGr_PageRankIncremental (r, &iters, G1, E, 0.85, tol, 1000,
+            msg)) ;
+        TEST_CHECK (iters == 0) ;
+        err = difference (r, r1) ;
+        TEST_CHECK (err == 0) ;
+        OK (GrB_free (&r)) ;
+
+        OK (GrB_free (&r0)) ;
+        OK (GrB_free (&r1)) ;
+        OK (GrB_free (&E)) ;
+        OK (LAGraph_Delete (&G0, msg)) ;
+        OK (LAGraph_Delete (&G1, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankIncremental_delete: delete an edge to an unchanged node
+//------------------------------------------------------------------------------
+
+// The graph has the edges 0->1, 1->2, 2->0, and 0->2, and the edge 0->2 is
+// deleted.  Node 2 then has no other entry in the initial residual, so its
+// residual comes only from the deleted edge.
+
+void test_PageRankIncremental_delete (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL, A0 = NULL, E = NULL ;
+    GrB_Vector r0 = NULL, r1 = NULL, r = NULL ;
+    float tol = 1e-6 ;
+
+    OK (GrB_Matrix_new (&A, GrB_BOOL, 3, 3)) ;
+    OK (GrB_Matrix_setElement_BOOL (A, true, 0, 1)) ;
+    OK (GrB_Matrix_setElement_BOOL (A, true, 1, 2)) ;
+    OK (GrB_Matrix_setElement_BOOL (A, true, 2, 0)) ;
+    OK (GrB_Matrix_setElement_BOOL (A, true, 0, 2)) ;
+    OK (GrB_Matrix_dup (&A0, A)) ;
+    OK (LAGraph_New (&G0, &A0, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (LAGraph_Cached_AT (G0, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G0, msg)) ;
+    int iters = 0 ;
+    OK (LAGr_PageRank (&r0, &iters, G0, 0.85, tol, 200, msg)) ;
+
+    OK (GrB_Matrix_new (&E, GrB_BOOL, 3, 3)) ;
+    change_edge (A, E, 0, 2, false) ;
+    OK (LAGraph_New (&G1, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (LAGraph_Cached_AT (G1, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G1, msg)) ;
+    OK (LAGr_PageRank (&r1, &iters, G1, 0.85, tol, 200, msg)) ;
+
+    OK (GrB_Vector_dup (&r, r0)) ;
+    OK (LAGr_PageRankIncremental (r, &iters, G1, E, 0.85, tol, 1000, msg)) ;
+    float err = difference (r, r1) ;
+    printf ("\nincremental: %d push steps, err %g\n", iters, err) ;
+    TEST_CHECK (err < 1e-4) ;
+
+    OK (GrB_free (&r)) ;
+    OK (GrB_free (&r0)) ;
+    OK (GrB_free (&r1)) ;
+    OK (GrB_free (&E)) ;
+    OK (LAGraph_Delete (&G0, msg)) ;
+    OK (LAGraph_Delete (&G1, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankIncremental_errors
+//------------------------------------------------------------------------------
+
+void test_PageRankIncremental_errors (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL, E = NULL ;
+    GrB_Vector r = NULL, r0 = NULL ;
+    int iters = 0 ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G1, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, G1->A)) ;
+    OK (GrB_Matrix_new (&E, GrB_BOOL, n, n)) ;
+    OK (GrB_Vector_new (&r0, GrB_FP32, n)) ;
+
+    // NULL inputs
+    int result = LAGr_PageRankWarmStart (NULL, &iters, G1, r0, 0.85, 1e-4,
+        100, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGr_PageRankIncremental (r0, &iters, G1, NULL, 0.85, 1e-4,
+        100, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G->AT and G->out_degree are required
+    result = LAGr_PageRankWarmStart (&r, &iters, G1, r0, 0.85, 1e-4,
+        100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    result = LAGr_PageRankIncremental (r0, &iters, G1, E, 0.85, 1e-4,
+        100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    OK (LAGraph_Cached_AT (G1, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G1, msg)) ;
+
+    // r0 must have a positive sum
+    result = LAGr_PageRankWarmStart (&r, &iters, G1, r0, 0.85, 1e-4,
+        100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (r == NULL) ;
+
+    // failure to converge
+    OK (GrB_assign (r0, NULL, NULL, (float) 1, GrB_ALL, n, NULL)) ;
+    result = LAGr_PageRankWarmStart (&r, &iters, G1, r0, 0.85, 1e-4,
+        2, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_CONVERGENCE_FAILURE) ;
+    OK (GrB_Matrix_setElement_BOOL (E, true, 0, 1)) ;
+    OK (GrB_Matrix_setElement_BOOL (E, true, 1, 2)) ;
+    OK (GrB_Matrix_setElement_BOOL (E, true, 2, 0)) ;
+    result = LAGr_PageRankIncremental (r0, &iters, G1, E, 0.85, 1e-6,
+        1, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_CONVERGENCE_FAILURE) ;
+
+    // wrong sizes
+    OK (GrB_Vector_resize (r0, n+1)) ;
+    result = LAGr_PageRankWarmStart (&r, &iters, G1, r0, 0.85, 1e-4,
+        100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+    result = LAGr_PageRankIncremental (r0, &iters, G1, E, 0.85, 1e-4,
+        100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+
+    OK (GrB_free (&r0)) ;
+    OK (GrB_free (&E)) ;
+    OK (LAGraph_Delete (&G1, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// list of tests
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"PageRankIncremental", test_PageRankIncremental},
+    {"PageRankIncremental_delete", test_PageRankIncremental_delete},
+    {"PageRankIncremental_errors", test_PageRankIncremental_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,189 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_PageRankPrecision.c: test PR precisions
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+#include "LG_internal.h"
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",  // has sinks
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",                  // has sinks
+    LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx",
+    LAGRAPH_UNKNOWN, ""
+} ;
+
+//------------------------------------------------------------------------------
+// difference: max (abs (a - b))
+//------------------------------------------------------------------------------
+
+double difference (GrB_Vector a, GrB_Vector b)
+{
+    GrB_Vector diff = NULL ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, a)) ;
+    OK (GrB_Vector_new (&diff, GrB_FP64, n)) ;
+    OK (GrB_eWiseAdd (diff, NULL, NULL, GrB_MINUS_FP64, a, b, NULL)) ;
+    OK (GrB_apply (diff, NULL, NULL, GrB_ABS_FP64, diff, NULL)) ;
+    double err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP64, diff, NULL)) ;
+    OK (GrB_free (&diff)) ;
+    return (err) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankPrecision: compare with LAGr_PageRank
+//------------------------------------------------------------------------------
+
+void test_PageRankPrecision (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector r = NULL, r32 = NULL, r64 = NULL, rmixed = NULL ;
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\n================== Matrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, files [k].kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+        int iters = 0, iters32 = 0, iters64 = 0, iters_mixed = 0 ;
+        OK (LAGr_PageRank (&r, &iters, G, 0.85, 1e-6, 200, msg)) ;
+
+        // single precision: same as LAGr_PageRank
+        OK (LAGr_PageRankPrecision (&r32, &iters32, G, LAGr_PageRank_FP32,
+            0.85, 1e-6, 200, msg)) ;
+        OK (LAGraph_Vector_TypeName (typename, r32, msg)) ;
+        TEST_CHECK (MATCHNAME (typename, "float")) ;
+        double err32 = difference (r, r32) ;
+        TEST_CHECK (err32 < 1e-5) ;
+
+        // double precision, with a tolerance beyond single precision
+        OK (LAGr_PageRankPrecision (&r64, &iters64, G, LAGr_PageRank_FP64,
+            0.85, 1e-10, 400, msg)) ;
+        OK (LAGraph_Vector_TypeName (typename, r64, msg)) ;
+        TEST_CHECK (MATCHNAME (typename, "double")) ;
+        double rsum = 0 ;
+        OK (GrB_reduce (&rsum, NULL, GrB_PLUS_MONOID_FP64, r64, NULL)) ;
+        TEST_CHECK (fabs (rsum - 1) < 1e-8) ;
+        double err64 = difference (r, r64) ;
+        TEST_CHECK (err64 < 1e-4) ;
+
+        // mixed precision
+        OK (LAGr_PageRankPrecision (&rmixed, &iters_mixed, G,
+            LAGr_PageRank_Mixed, 0.85, 1e-6, 200, msg)) ;
+        OK (LAGraph_Vector_TypeName (typename, rmixed, msg)) ;
+        TEST_CHECK (MATCHNAME (typename, "float")) ;
+        double err_mixed = difference (r64, rmixed) ;
+        TEST_CHECK (err_mixed < 1e-5) ;
+
+        printf ("iters: %d (fp32), %d (fp64), %d (mixed)\n",
+            iters32, iters64, iters_mixed) ;
+        printf ("err: %g (fp32), %g (fp64), %g (mixed vs fp64)\n",
+            err32, err64, err_mixed) ;
+
+        OK (GrB_free (&r)) ;
+        OK (GrB_free (&r32)) ;
+        OK (GrB_free (&r64)) ;
+        OK (GrB_free (&rmixed)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PageRankPrecision_errors
+//------------------------------------------------------------------------------
+
+void test_PageRankPrecision_errors (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector r = NULL ;
+    int iters = 0 ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    int result = LAGr_PageRankPrecision (NULL, &iters, G, LAGr_PageRank_FP64,
+        0.85, 1e-4, 100, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    result = LAGr_PageRankPrecision (&r, &iters, G, 99, 0.85, 1e-4, 100,
+        msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    // G->AT and G->out_degree are required
+    result = LAGr_PageRankPrecision (&r, &iters, G, LAGr_PageRank_Mixed,
+        0.85, 1e-4, 100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    // failure to converge
+    result = LAGr_PageRankPrecision (&r, &iters, G, LAGr_PageRank_FP64,
+        0.85, 1e-10, 2, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_CONVERGENCE_FAILURE) ;
+    TEST_CHECK (r == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// list of tests
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"PageRankPrecision", test_PageRankPrecision},
+    {"PageRankPrecision_errors", test_PageRankPrecision_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,305 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_PointToPointShortestPath.c
+//----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL, Dfrom = NULL, Dto = NULL ;
+GrB_Scalar Delta = NULL ;
+GrB_Vector path_length = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_DIRECTED,   "A.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "jagmesh7.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "ldbc-undirected-example.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "LFAT5.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "msf1.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "sample.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "tree-example.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "test_BF.mtx",
+    LAGraph_ADJACENCY_UNDIRECTED, "bcsstk13.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "cryg2500.mtx",
+    LAGRAPH_UNKNOWN,              ""
+} ;
+
+//------------------------------------------------------------------------------
+// check_queries: compare with LAGr_SingleSourceShortestPath
+//------------------------------------------------------------------------------
+
+void check_queries (GrB_Index src, GrB_Index n)
+{
+    OK (LAGr_SingleSourceShortestPath (&path_length, G, src, Delta, msg)) ;
+    int64_t step = (n > 100) ? (n/37 + 1) : 1 ;
+    for (int64_t dest = 0 ; dest < n ; dest += step)
+    {
+        int32_t d = 0 ;
+        OK (GrB_Vector_extractElement (&d, path_length, dest)) ;
+        double expected = (d == INT32_MAX) ? INFINITY : ((double) d) ;
+        double len1 = -1, len2 = -1 ;
+        OK (LAGr_PointToPointShortestPath (&len1, G, src, dest, Dfrom, Dto,
+            msg)) ;
+        OK (LAGr_PointToPointShortestPath (&len2, G, src, dest, NULL, NULL,
+            msg)) ;
+        TEST_CHECK (len1 == expected) ;
+        TEST_CHECK (len2 == expected) ;
+    }
+    OK (GrB_free (&path_length)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PointToPointShortestPath
+//------------------------------------------------------------------------------
+
+void test_PointToPointShortestPath (void)
+{
+    LAGraph_Init (msg) ;
+    OK (GrB_Scalar_new (&Delta, GrB_INT32)) ;
+    OK (GrB_Scalar_setElement (Delta, 30)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        // load the matrix as A
+        const char *aname = files [k].name ;
+        LAGraph_Kind kind = files [k].kind ;
+        if (strlen (aname) == 0) break;
+        printf ("\n%s:\n", aname) ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        GrB_Matrix T = NULL ;
+        OK (LAGraph_MMRead (&T, f, msg)) ;
+        OK (fclose (f)) ;
+        TEST_MSG ("Loading of adjacency matrix failed") ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, T)) ;
+
+        // A = T with integer edge weights 1 to 255
+        OK (GrB_Matrix_new (&A, GrB_INT32, n, n)) ;
+        OK (GrB_assign (A, NULL, NULL, T, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+        OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (A, NULL, NULL,
+            GrB_BAND_INT32, A, 255, NULL)) ;
+        OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (A, NULL, NULL,
+            GrB_MAX_INT32, A, 1, NULL)) ;
+        OK (GrB_free (&T)) ;
+        OK (LAGraph_New (&G, &A, kind, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_EMin (G, msg)) ;
+
+        // try with 1, 4, and many landmarks (more than n if n is small)
+        int64_t nlm_list [3] = { 1, 4, (n <= 100) ? (n+2) : 16 } ;
+        for (int t = 0 ; t < 3 ; t++)
+        {
+            int64_t landmarks [8], nlm = 0 ;
+            OK (LAGr_Landmarks (&Dfrom, &Dto,
+                (nlm_list [t] <= 8) ? landmarks : NULL, &nlm, G,
+                nlm_list [t], 0, Delta, msg)) ;
+            printf ("landmarks: %g\n", (double) nlm) ;
+            TEST_CHECK (nlm > 0 && nlm <= LAGRAPH_MIN (nlm_list [t], n)) ;
+            TEST_CHECK ((Dto == NULL) ==
+                (kind == LAGraph_ADJACENCY_UNDIRECTED)) ;
+
+            // check the landmark distances
+            for (int64_t j = 0 ; j < nlm && j < 8 && nlm_list [t] <= 8 ; j++)
+            {
+                OK (LAGr_SingleSourceShortestPath (&path_length, G,
+                    landmarks [j], Delta, msg)) ;
+                for (int64_t i = 0 ; i < n ; i++)
+                {
+                    int32_t d = 0 ;
+                    double x = 0 ;
+                    OK (GrB_Vector_extractElement (&d, path_length, i)) ;
+                    OK (GrB_Matrix_extractElement (&x, Dfrom, i, j)) ;
+                    TEST_CHECK (x == ((d == INT32_MAX) ? INFINITY : d)) ;
+                }
+                OK (GrB_free (&path_length)) ;
+            }
+
+            // check the queries
+            int64_t step = (n > 100) ? (3*n/4) : ((n/4) + 1) ;
+            for (int64_t src = 0 ; src < n ; src += step)
+            {
+                check_queries (src, n) ;
+            }
+            OK (GrB_free (&Dfrom)) ;
+            OK (GrB_free (&Dto)) ;
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (GrB_free (&Delta)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Landmarks_disconnected: each component gets a landmark
+//------------------------------------------------------------------------------
+
+// The graph is a path 0-1-...-7 and the edges 8-9 and 10-11.  The first
+// landmark is node 7, the farthest from the seed 0.  The next two are the
+// first nodes of the other components, not the far end (node 0) of the path.
+
+void test_Landmarks_disconnected (void)
+{
+    LAGraph_Init (msg) ;
+    OK (GrB_Scalar_new (&Delta, GrB_INT32)) ;
+    OK (GrB_Scalar_setElement (Delta, 30)) ;
+
+    GrB_Index n = 12 ;
+    OK (GrB_Matrix_new (&A, GrB_INT32, n, n)) ;
+    for (GrB_Index i = 0 ; i < 7 ; i++)
+    {
+        OK (GrB_Matrix_setElement (A, 1, i, i+1)) ;
+        OK (GrB_Matrix_setElement (A, 1, i+1, i)) ;
+    }
+    for (GrB_Index i = 8 ; i < n ; i += 2)
+    {
+        OK (GrB_Matrix_setElement (A, 1, i, i+1)) ;
+        OK (GrB_Matrix_setElement (A, 1, i+1, i)) ;
+    }
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    OK (LAGraph_Cached_EMin (G, msg)) ;
+
+    int64_t landmarks [3], nlm = 0 ;
+    OK (LAGr_Landmarks (&Dfrom, &Dto, landmarks, &nlm, G, 3, 0, Delta, msg)) ;
+    TEST_CHECK (nlm == 3) ;
+    TEST_CHECK (landmarks [0] == 7) ;
+    TEST_CHECK (landmarks [1] == 8) ;
+    TEST_CHECK (landmarks [2] == 10) ;
+
+    // each node is reached by some landmark
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        double dmin = INFINITY ;
+        for (int64_t j = 0 ; j < nlm ; j++)
+        {
+            double x = INFINITY ;
+            OK (GrB_Matrix_extractElement (&x, Dfrom, i, j)) ;
+            dmin = LAGRAPH_MIN (dmin, x) ;
+        }
+        TEST_CHECK (dmin < INFINITY) ;
+    }
+
+    // queries within and across components
+    check_queries (0, n) ;
+    check_queries (9, n) ;
+
+    OK (GrB_free (&Dfrom)) ;
+    OK (GrB_free (&Dto)) ;
+    OK (GrB_free (&Delta)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_errors
+//------------------------------------------------------------------------------
+
+void test_errors (void)
+{
+    LAGraph_Init (msg) ;
+    OK (GrB_Scalar_new (&Delta, GrB_INT32)) ;
+    OK (GrB_Scalar_setElement (Delta, 30)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "cover.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    int64_t nlm = 0 ;
+    double len = 0 ;
+
+    // G->AT is required for a directed graph
+    int result = LAGr_Landmarks (&Dfrom, &Dto, NULL, &nlm, G, 2, 0, Delta,
+        msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    result = LAGr_PointToPointShortestPath (&len, G, 0, 1, NULL, NULL, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+
+    // k is invalid
+    result = LAGr_Landmarks (&Dfrom, &Dto, NULL, &nlm, G, 0, 0, Delta, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (Dfrom == NULL && Dto == NULL) ;
+
+    // seed is invalid
+    result = LAGr_Landmarks (&Dfrom, &Dto, NULL, &nlm, G, 2, 1000, Delta,
+        msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+
+    // src and dest are invalid
+    result = LAGr_PointToPointShortestPath (&len, G, 1000, 0, NULL, NULL,
+        msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+
+    // Dto is missing
+    OK (LAGr_Landmarks (&Dfrom, &Dto, NULL, &nlm, G, 2, 0, Delta, msg)) ;
+    result = LAGr_PointToPointShortestPath (&len, G, 0, 1, Dfrom, NULL,
+        msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // Dto has the wrong size
+    OK (GrB_Matrix_resize (Dto, 3, nlm)) ;
+    result = LAGr_PointToPointShortestPath (&len, G, 0, 1, Dfrom, Dto, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+
+    // path_length is NULL
+    result = LAGr_PointToPointShortestPath (NULL, G, 0, 1, NULL, NULL, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (GrB_free (&Dfrom)) ;
+    OK (GrB_free (&Dto)) ;
+    OK (GrB_free (&Delta)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"PointToPointShortestPath", test_PointToPointShortestPath},
+    {"Landmarks_disconnected", test_Landmarks_disconnected},
+    {"PointToPointShortestPath_errors", test_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,203 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_SingleSourceShortestPath_Native.c
+//----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Scalar Delta = NULL ;
+GrB_Vector path_length = NULL, path_length2 = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "A.mtx",
+    "cover.mtx",
+    "jagmesh7.mtx",
+    "ldbc-directed-example.mtx",
+    "ldbc-undirected-example.mtx",
+    "LFAT5.mtx",
+    "LFAT5_hypersparse.mtx",
+    "msf1.mtx",
+    "msf2.mtx",
+    "sample.mtx",
+    "tree-example.mtx",
+    "west0067.mtx",
+    "karate.mtx",
+    "test_BF.mtx",
+    "bcsstk13.mtx",
+    "cryg2500.mtx",
+    ""
+} ;
+
+//------------------------------------------------------------------------------
+// check_sssp: compare with LAGr_SingleSourceShortestPath
+//------------------------------------------------------------------------------
+
+void check_sssp (GrB_Index src)
+{
+    OK (LAGr_SingleSourceShortestPath_Native (&path_length, G, src, Delta,
+        msg)) ;
+    OK (LAGr_SingleSourceShortestPath (&path_length2, G, src, Delta, msg)) ;
+    bool ok = false ;
+    OK (LAGraph_Vector_IsEqual (&ok, path_length, path_length2, msg)) ;
+    TEST_CHECK (ok) ;
+    OK (GrB_free (&path_length)) ;
+    OK (GrB_free (&path_length2)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_SingleSourceShortestPath_Native
+//------------------------------------------------------------------------------
+
+void test_SingleSourceShortestPath_Native (void)
+{
+    LAGraph_Init (msg) ;
+    OK (GrB_Scalar_new (&Delta, GrB_INT32)) ;
+    int nthreads_outer, nthreads_inner ;
+    OK (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    GrB_Type types [6] = { GrB_INT32, GrB_INT64, GrB_UINT32, GrB_UINT64,
+        GrB_FP32, GrB_FP64 } ;
+
+    for (int k = 0 ; ; k++)
+    {
+        // load the matrix as A
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break;
+        printf ("\n%s:\n", aname) ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        GrB_Matrix T = NULL, W = NULL ;
+        OK (LAGraph_MMRead (&T, f, msg)) ;
+        OK (fclose (f)) ;
+        TEST_MSG ("Loading of adjacency matrix failed") ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, T)) ;
+
+        // W = T with integer edge weights 1 to 255
+        OK (GrB_Matrix_new (&W, GrB_INT32, n, n)) ;
+        OK (GrB_assign (W, NULL, NULL, T, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+        OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (W, NULL, NULL,
+            GrB_BAND_INT32, W, 255, NULL)) ;
+        OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (W, NULL, NULL,
+            GrB_MAX_INT32, W, 1, NULL)) ;
+        OK (GrB_free (&T)) ;
+
+        for (int t = 0 ; t < 6 ; t++)
+        {
+            // A = W, typecasted to each type
+            OK (GrB_Matrix_new (&A, types [t], n, n)) ;
+            OK (GrB_assign (A, NULL, NULL, W, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+            OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+            OK (LAGraph_Cached_EMin (G, msg)) ;
+
+            int64_t step = (n > 100) ? (3*n/4) : ((n/4) + 1) ;
+            for (int64_t src = 0 ; src < n ; src += step)
+            {
+                // Delta of 1 uses many far buckets
+                int32_t Deltas [ ] = { 1, 30, 50000 } ;
+                for (int kk = 0 ; kk < 3 ; kk++)
+                {
+                    OK (GrB_Scalar_setElement (Delta, Deltas [kk])) ;
+                    check_sssp (src) ;
+                }
+            }
+
+            // with a single thread
+            OK (LAGraph_SetNumThreads (1, 1, msg)) ;
+            check_sssp (0) ;
+            OK (LAGraph_SetNumThreads (nthreads_outer, nthreads_inner, msg)) ;
+
+            OK (LAGraph_Delete (&G, msg)) ;
+        }
+
+        // add a single negative edge and try again
+        OK (GrB_Matrix_dup (&A, W)) ;
+        OK (GrB_Matrix_setElement_INT32 (A, -1, 0, 1)) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        OK (LAGraph_Cached_EMin (G, msg)) ;
+        OK (GrB_Scalar_setElement (Delta, 30)) ;
+        check_sssp (0) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+        OK (GrB_free (&W)) ;
+    }
+
+    OK (GrB_free (&Delta)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_errors
+//------------------------------------------------------------------------------
+
+void test_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (GrB_Scalar_new (&Delta, GrB_INT32)) ;
+    OK (GrB_Scalar_setElement (Delta, 1)) ;
+
+    // karate is bool, which is not supported
+    int result = LAGr_SingleSourceShortestPath_Native (&path_length, G, 0,
+        Delta, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NOT_IMPLEMENTED) ;
+    TEST_CHECK (path_length == NULL) ;
+
+    // path_length is NULL
+    result = LAGr_SingleSourceShortestPath_Native (NULL, G, 0, Delta, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // Delta is empty
+    OK (GrB_Scalar_clear (Delta)) ;
+    result = LAGr_SingleSourceShortestPath_Native (&path_length, G, 0, Delta,
+        msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_EMPTY_OBJECT) ;
+
+    // source is invalid
+    OK (GrB_Scalar_setElement (Delta, 1)) ;
+    result = LAGr_SingleSourceShortestPath_Native (&path_length, G, 1000,
+        Delta, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+
+    OK (GrB_free (&Delta)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"SSSP_Native", test_SingleSourceShortestPath_Native},
+    {"SSSP_Native_errors", test_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,244 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_SingleSourceShortestPath_Parent.c
+//----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Scalar Delta = NULL ;
+GrB_Vector path_length = NULL, path_length2 = NULL ;
+GrB_Vector parent = NULL, parent2 = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "A.mtx",
+    "cover.mtx",
+    "jagmesh7.mtx",
+    "ldbc-directed-example.mtx",
+    "ldbc-undirected-example.mtx",
+    "LFAT5.mtx",
+    "msf1.mtx",
+    "msf2.mtx",
+    "sample.mtx",
+    "tree-example.mtx",
+    "west0067.mtx",
+    "karate.mtx",
+    "test_BF.mtx",
+    "cryg2500.mtx",
+    ""
+} ;
+
+//------------------------------------------------------------------------------
+// check_parent: check the shortest-path tree
+//------------------------------------------------------------------------------
+
+void check_parent (GrB_Index src, GrB_Index n)
+{
+    GrB_Index npaths = 0, nparents = 0 ;
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        int32_t d = 0 ;
+        int64_t p = -1 ;
+        OK (GrB_Vector_extractElement (&d, path_length, i)) ;
+        int info = GrB_Vector_extractElement (&p, parent, i) ;
+        TEST_CHECK (info == GrB_SUCCESS || info == GrB_NO_VALUE) ;
+        if (d == INT32_MAX)
+        {
+            // node i is not reachable and has no parent
+            TEST_CHECK (info == GrB_NO_VALUE) ;
+            continue ;
+        }
+        npaths++ ;
+        TEST_CHECK (info == GrB_SUCCESS) ;
+        if (i == src)
+        {
+            TEST_CHECK (p == (int64_t) src && d == 0) ;
+            continue ;
+        }
+
+        // the edge (p,i) must be on a shortest path to i
+        int32_t w = 0, dp = 0 ;
+        OK (GrB_Matrix_extractElement (&w, G->A, p, i)) ;
+        OK (GrB_Vector_extractElement (&dp, path_length, p)) ;
+        TEST_CHECK (dp + w == d) ;
+
+        // the path from i back to src must not have a cycle
+        int64_t k = i ;
+        GrB_Index len = 0 ;
+        while (k != (int64_t) src && len <= n)
+        {
+            OK (GrB_Vector_extractElement (&k, parent, k)) ;
+            len++ ;
+        }
+        TEST_CHECK (k == (int64_t) src) ;
+    }
+    OK (GrB_Vector_nvals (&nparents, parent)) ;
+    TEST_CHECK (npaths == nparents) ;
+}
+
+//------------------------------------------------------------------------------
+// test_SingleSourceShortestPath_Parent
+//------------------------------------------------------------------------------
+
+void test_SingleSourceShortestPath_Parent (void)
+{
+    LAGraph_Init (msg) ;
+    OK (GrB_Scalar_new (&Delta, GrB_INT32)) ;
+    int nthreads_outer, nthreads_inner ;
+    OK (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        // load the matrix as A
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break;
+        printf ("\n%s:\n", aname) ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        GrB_Matrix T = NULL ;
+        OK (LAGraph_MMRead (&T, f, msg)) ;
+        OK (fclose (f)) ;
+        TEST_MSG ("Loading of adjacency matrix failed") ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, T)) ;
+
+        // first with edge weights 1 to 15, then with 0 to 15
+        for (int zeros = 0 ; zeros <= 1 ; zeros++)
+        {
+            OK (GrB_Matrix_new (&A, GrB_INT32, n, n)) ;
+            OK (GrB_assign (A, NULL, NULL, T, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+            OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (A, NULL, NULL,
+                GrB_BAND_INT32, A, 15, NULL)) ;
+            if (!zeros)
+            {
+                OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (A, NULL, NULL,
+                    GrB_MAX_INT32, A, 1, NULL)) ;
+            }
+            OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+            OK (LAGraph_Cached_EMin (G, msg)) ;
+
+            int64_t step = (n > 100) ? (3*n/4) : ((n/4) + 1) ;
+            for (int64_t src = 0 ; src < n ; src += step)
+            {
+                for (int32_t delta = 1 ; delta <= 64 ; delta *= 8)
+                {
+                    OK (GrB_Scalar_setElement (Delta, delta)) ;
+
+                    // compute the path lengths and parents
+                    OK (LAGr_SingleSourceShortestPath_Parent (&path_length,
+                        &parent, G, src, Delta, msg)) ;
+
+                    // compare with LAGr_SingleSourceShortestPath
+                    OK (LAGr_SingleSourceShortestPath (&path_length2, G, src,
+                        Delta, msg)) ;
+                    bool ok = false ;
+                    OK (LAGraph_Vector_IsEqual (&ok, path_length,
+                        path_length2, msg)) ;
+                    TEST_CHECK (ok) ;
+                    OK (GrB_free (&path_length2)) ;
+
+                    // check the parents
+                    check_parent (src, n) ;
+
+                    // the parents do not depend on the # of threads
+                    OK (LAGraph_SetNumThreads (1, 1, msg)) ;
+                    OK (LAGr_SingleSourceShortestPath_Parent (&path_length2,
+                        &parent2, G, src, Delta, msg)) ;
+                    OK (LAGraph_SetNumThreads (nthreads_outer, nthreads_inner,
+                        msg)) ;
+                    OK (LAGraph_Vector_IsEqual (&ok, parent, parent2, msg)) ;
+                    TEST_CHECK (ok) ;
+
+                    OK (GrB_free (&path_length)) ;
+                    OK (GrB_free (&path_length2)) ;
+                    OK (GrB_free (&parent)) ;
+                    OK (GrB_free (&parent2)) ;
+                }
+            }
+
+            OK (LAGraph_Delete (&G, msg)) ;
+        }
+        OK (GrB_free (&T)) ;
+    }
+
+    OK (GrB_free (&Delta)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_errors
+//------------------------------------------------------------------------------
+
+void test_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    OK (GrB_Scalar_new (&Delta, GrB_INT32)) ;
+    OK (GrB_Scalar_setElement (Delta, 1)) ;
+
+    // karate is bool, which is not supported
+    int result = LAGr_SingleSourceShortestPath_Parent (&path_length, &parent,
+        G, 0, Delta, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NOT_IMPLEMENTED) ;
+    TEST_CHECK (path_length == NULL && parent == NULL) ;
+
+    // path_length is NULL
+    result = LAGr_SingleSourceShortestPath_Parent (NULL, &parent, G, 0, Delta,
+        msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // Delta is empty
+    OK (GrB_Scalar_clear (Delta)) ;
+    result = LAGr_SingleSourceShortestPath_Parent (&path_length, &parent, G,
+        0, Delta, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_EMPTY_OBJECT) ;
+
+    // source is invalid
+    OK (GrB_Scalar_setElement (Delta, 1)) ;
+    result = LAGr_SingleSourceShortestPath_Parent (&path_length, &parent, G,
+        1000, Delta, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+
+    OK (GrB_free (&Delta)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"SSSP_Parent", test_SingleSourceShortestPath_Parent},
+    {"SSSP_Parent_errors", test_errors},
+    {NULL, NULL}
+};
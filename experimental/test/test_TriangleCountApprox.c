@@ -0,0 +1,226 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_TriangleCountApprox.c: test approximate TC
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    uint64_t ntriangles ;           // # triangles in original matrix
+    const char *name ;              // matrix filename
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    {     45, "karate.mtx" },
+    {     11, "A.mtx" },
+    {   2016, "jagmesh7.mtx" },
+    {      0, "LFAT5.mtx" },
+    { 342300, "bcsstk13.mtx" },
+    {      0, "tree-example.mtx" },
+    {      0, "" },
+} ;
+
+//------------------------------------------------------------------------------
+// setup: start a test
+//------------------------------------------------------------------------------
+
+void setup (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    OK (LAGraph_Random_Init (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// teardown: finalize a test
+//------------------------------------------------------------------------------
+
+void teardown (void)
+{
+    OK (LAGraph_Random_Finalize (msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_TriangleCountApprox
+//------------------------------------------------------------------------------
+
+void test_TriangleCountApprox (void)
+{
+    setup ( ) ;
+    GrB_Matrix A = NULL ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the adjacency matrix as A
+        const char *aname = files [k].name ;
+        double ntriangles = (double) files [k].ntriangles ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\n================== Matrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+
+        // create the graph
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        OK (LAGraph_DeleteSelfEdges (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+        // Doulion with p = 1 gives the exact count
+        double est, lower, upper ;
+        OK (LAGr_TriangleCountApprox (&est, &lower, &upper, G,
+            LAGr_TriangleCountApprox_Doulion, 1.0, 1, 0.95, 42, msg)) ;
+        printf ("exact: %g, Doulion (p=1): %g [%g,%g]\n", ntriangles, est,
+            lower, upper) ;
+        TEST_CHECK (est == ntriangles) ;
+        TEST_CHECK (lower == est && upper == est) ;
+
+        // Doulion with p = 0.5
+        OK (LAGr_TriangleCountApprox (&est, &lower, &upper, G,
+            LAGr_TriangleCountApprox_Doulion, 0.5, 20, 0.95, 42, msg)) ;
+        printf ("Doulion (p=0.5): %g [%g,%g]\n", est, lower, upper) ;
+        TEST_CHECK (lower <= est && est <= upper) ;
+        if (ntriangles == 0)
+        {
+            TEST_CHECK (est == 0) ;
+        }
+        else if (ntriangles > 1000)
+        {
+            TEST_CHECK (fabs (est - ntriangles) <= 0.1 * ntriangles) ;
+        }
+
+        // the same seed gives the same result
+        double est2 ;
+        OK (LAGr_TriangleCountApprox (&est2, NULL, NULL, G,
+            LAGr_TriangleCountApprox_Doulion, 0.5, 20, 0.95, 42, msg)) ;
+        TEST_CHECK (est == est2) ;
+
+        // wedge sampling
+        #if LAGRAPH_SUITESPARSE
+        OK (LAGr_TriangleCountApprox (&est, &lower, &upper, G,
+            LAGr_TriangleCountApprox_Wedge, 0, 200000, 0.95, 42, msg)) ;
+        printf ("Wedge: %g [%g,%g]\n", est, lower, upper) ;
+        TEST_CHECK (lower <= est && est <= upper) ;
+        if (ntriangles == 0)
+        {
+            TEST_CHECK (est == 0) ;
+        }
+        else
+        {
+            TEST_CHECK (fabs (est - ntriangles) <= 0.05 * ntriangles) ;
+        }
+        OK (LAGr_TriangleCountApprox (&est2, NULL, NULL, G,
+            LAGr_TriangleCountApprox_Wedge, 0, 200000, 0.95, 42, msg)) ;
+        TEST_CHECK (est == est2) ;
+
+        // G->A is restored
+        OK (LAGraph_CheckGraph (G, msg)) ;
+        #endif
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    teardown ( ) ;
+}
+
+//------------------------------------------------------------------------------
+// test_TriangleCountApprox_errors
+//------------------------------------------------------------------------------
+
+void test_TriangleCountApprox_errors (void)
+{
+    setup ( ) ;
+    GrB_Matrix A = NULL ;
+    double est = 0 ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    int result = LAGr_TriangleCountApprox (NULL, NULL, NULL, G,
+        LAGr_TriangleCountApprox_Doulion, 0.5, 1, 0.95, 42, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G->nself_edges is required
+    result = LAGr_TriangleCountApprox (&est, NULL, NULL, G,
+        LAGr_TriangleCountApprox_Doulion, 0.5, 1, 0.95, 42, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NO_SELF_EDGES_ALLOWED) ;
+    OK (LAGraph_Cached_NSelfEdges (G, msg)) ;
+
+    // invalid method, p, nsamples, and confidence
+    result = LAGr_TriangleCountApprox (&est, NULL, NULL, G, 99, 0.5, 1, 0.95,
+        42, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGr_TriangleCountApprox (&est, NULL, NULL, G,
+        LAGr_TriangleCountApprox_Doulion, 0, 1, 0.95, 42, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGr_TriangleCountApprox (&est, NULL, NULL, G,
+        LAGr_TriangleCountApprox_Doulion, 0.5, 0, 0.95, 42, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    result = LAGr_TriangleCountApprox (&est, NULL, NULL, G,
+        LAGr_TriangleCountApprox_Doulion, 0.5, 1, 1.0, 42, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    // G->out_degree is required for the Wedge method
+    #if LAGRAPH_SUITESPARSE
+    result = LAGr_TriangleCountApprox (&est, NULL, NULL, G,
+        LAGr_TriangleCountApprox_Wedge, 0, 1000, 0.95, 42, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    #endif
+
+    // the graph must have a symmetric structure
+    G->kind = LAGraph_ADJACENCY_DIRECTED ;
+    G->is_symmetric_structure = LAGRAPH_UNKNOWN ;
+    result = LAGr_TriangleCountApprox (&est, NULL, NULL, G,
+        LAGr_TriangleCountApprox_Doulion, 0.5, 1, 0.95, 42, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    teardown ( ) ;
+}
+
+//------------------------------------------------------------------------------
+// list of tests
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"TriangleCountApprox", test_TriangleCountApprox},
+    {"TriangleCountApprox_errors", test_TriangleCountApprox_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,237 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_TriangleList.c: test triangle listing
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    uint64_t ntriangles ;           // # triangles in original matrix
+    const char *name ;              // matrix filename
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    {     45, "karate.mtx" },
+    {     11, "A.mtx" },
+    {   2016, "jagmesh7.mtx" },
+    {      6, "ldbc-cdlp-undirected-example.mtx" },
+    {      4, "ldbc-undirected-example.mtx" },
+    {      0, "LFAT5.mtx" },
+    { 342300, "bcsstk13.mtx" },
+    {      0, "tree-example.mtx" },
+    {      0, "" },
+} ;
+
+//------------------------------------------------------------------------------
+// check_batch: callback that checks each batch of triangles
+//------------------------------------------------------------------------------
+
+// Adj is the dense adjacency matrix of the graph, and Tcount [i] counts the
+// triangles that contain node i.
+
+typedef struct
+{
+    int64_t n ;
+    bool *Adj ;
+    int64_t *Tcount ;
+    int64_t batch_size ;
+    int64_t ntri ;
+    int64_t nbad ;
+}
+check_info ;
+
+void check_batch (const int64_t *triangles, int64_t ntri, void *arg)
+{
+    check_info *info = (check_info *) arg ;
+    int64_t n = info->n ;
+    int64_t nbad = (ntri < 1 || ntri > info->batch_size) ;
+    for (int64_t t = 0 ; t < ntri ; t++)
+    {
+        int64_t i = triangles [3*t], j = triangles [3*t+1],
+            k = triangles [3*t+2] ;
+        if (!info->Adj [i*n+j] || !info->Adj [j*n+k] || !info->Adj [i*n+k]
+            || i == j || j == k || i == k)
+        {
+            nbad++ ;
+        }
+        #pragma omp atomic
+        info->Tcount [i]++ ;
+        #pragma omp atomic
+        info->Tcount [j]++ ;
+        #pragma omp atomic
+        info->Tcount [k]++ ;
+    }
+    #pragma omp atomic
+    info->ntri += ntri ;
+    #pragma omp atomic
+    info->nbad += nbad ;
+}
+
+//------------------------------------------------------------------------------
+// test_TriangleList
+//------------------------------------------------------------------------------
+
+void test_TriangleList (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector t = NULL, t2 = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    check_info info ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the adjacency matrix as A
+        const char *aname = files [k].name ;
+        uint64_t ntriangles = files [k].ntriangles ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\n================== Matrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+
+        // create the graph
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        OK (LAGraph_DeleteSelfEdges (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        GrB_Index n, nvals ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        OK (GrB_Matrix_nvals (&nvals, G->A)) ;
+
+        // construct the dense adjacency matrix
+        info.n = n ;
+        OK (LAGraph_Calloc ((void **) &(info.Adj), n*n, sizeof (bool), msg)) ;
+        OK (LAGraph_Malloc ((void **) &(info.Tcount), n, sizeof (int64_t),
+            msg)) ;
+        OK (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+        GrB_Index nv = nvals ;
+        OK (GrB_Matrix_extractTuples (I, J, (void *) NULL, &nv, G->A)) ;
+        for (int64_t p = 0 ; p < nvals ; p++)
+        {
+            info.Adj [I [p]*n + J [p]] = true ;
+        }
+        OK (LAGraph_Free ((void **) &I, NULL)) ;
+        OK (LAGraph_Free ((void **) &J, NULL)) ;
+
+        // t = # of triangles containing each node
+        OK (LAGr_TriangleCount_PerVertex (&t, G, NULL, NULL, msg)) ;
+
+        // list the triangles, with different batch sizes
+        int64_t batch_sizes [4] = { 1, 7, 1000, 0 } ;
+        for (int b = 0 ; b < 4 ; b++)
+        {
+            info.batch_size = (batch_sizes [b] > 0) ? batch_sizes [b] : 4096 ;
+            info.ntri = 0 ;
+            info.nbad = 0 ;
+            memset (info.Tcount, 0, n * sizeof (int64_t)) ;
+            uint64_t ntri = 0 ;
+            OK (LAGr_TriangleList (&ntri, G, check_batch, &info,
+                batch_sizes [b], msg)) ;
+            printf ("batch size %g: # triangles: %g\n",
+                (double) batch_sizes [b], (double) ntri) ;
+            TEST_CHECK (ntri == ntriangles) ;
+            TEST_CHECK (info.ntri == ntriangles) ;
+            TEST_CHECK (info.nbad == 0) ;
+
+            // each node is in the same number of triangles as from t
+            bool ok = false ;
+            OK (GrB_Vector_new (&t2, GrB_INT64, n)) ;
+            for (int64_t i = 0 ; i < n ; i++)
+            {
+                OK (GrB_Vector_setElement (t2, info.Tcount [i], i)) ;
+            }
+            OK (LAGraph_Vector_IsEqual (&ok, t, t2, msg)) ;
+            TEST_CHECK (ok) ;
+            OK (GrB_free (&t2)) ;
+        }
+
+        OK (GrB_free (&t)) ;
+        OK (LAGraph_Free ((void **) &(info.Adj), NULL)) ;
+        OK (LAGraph_Free ((void **) &(info.Tcount), NULL)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_TriangleList_errors
+//------------------------------------------------------------------------------
+
+void test_TriangleList_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    GrB_Matrix A = NULL ;
+    uint64_t ntri = 0 ;
+    check_info info ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    int result = LAGr_TriangleList (&ntri, G, NULL, NULL, 0, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G->nself_edges is required
+    result = LAGr_TriangleList (&ntri, G, check_batch, &info, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NO_SELF_EDGES_ALLOWED) ;
+    OK (LAGraph_Cached_NSelfEdges (G, msg)) ;
+
+    // G->out_degree is required
+    result = LAGr_TriangleList (&ntri, G, check_batch, &info, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    // the graph must have a symmetric structure
+    G->kind = LAGraph_ADJACENCY_DIRECTED ;
+    G->is_symmetric_structure = LAGRAPH_UNKNOWN ;
+    result = LAGr_TriangleList (&ntri, G, check_batch, &info, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// list of tests
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"TriangleList", test_TriangleList},
+    {"TriangleList_errors", test_TriangleList_errors},
+    {NULL, NULL}
+};
@@ -15,9 +15,6 @@
 
 //------------------------------------------------------------------------------
 
-// todo: write a simple scc method, as LG_check_scc, and compare its results
-// with LAGraph_scc
-
 #include <stdio.h>
 #include <acutest.h>
 
@@ -38,6 +35,94 @@ matrix_info ;
 
 int scc_cover [7] = { 0, 0, 2, 0, 4, 2, 0 } ;
 
+//------------------------------------------------------------------------------
+// check_scc: check the SCCs of a small graph by brute force
+//------------------------------------------------------------------------------
+
+// The set of nodes reachable from each node is found by a depth-first search,
+// and the SCC of node i is then the smallest node j such that i reaches j and
+// j reaches i.
+
+#define CHECK_NMAX 3000
+
+void check_scc (GrB_Vector c, GrB_Matrix A)
+{
+    GrB_Index n, nvals ;
+    OK (GrB_Matrix_nrows (&n, A)) ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    if (n > CHECK_NMAX) return ;
+
+    // get the adjacency lists of A
+    GrB_Index *I = malloc ((nvals+1) * sizeof (GrB_Index)) ;
+    GrB_Index *J = malloc ((nvals+1) * sizeof (GrB_Index)) ;
+    bool *X = malloc ((nvals+1) * sizeof (bool)) ;
+    int64_t *Ap = calloc (n+1, sizeof (int64_t)) ;
+    int64_t *Aj = malloc ((nvals+1) * sizeof (int64_t)) ;
+    int64_t *Stack = malloc ((n+1) * sizeof (int64_t)) ;
+    bool *Reach = calloc (n*n, sizeof (bool)) ;
+    uint64_t *C = malloc ((n+1) * sizeof (uint64_t)) ;
+    GrB_Index *Ci = malloc ((n+1) * sizeof (GrB_Index)) ;
+    TEST_CHECK (I != NULL && J != NULL && X != NULL && Ap != NULL &&
+        Aj != NULL && Stack != NULL && Reach != NULL && C != NULL &&
+        Ci != NULL) ;
+    OK (GrB_Matrix_extractTuples_BOOL (I, J, X, &nvals, A)) ;
+    for (int64_t k = 0 ; k < nvals ; k++) Ap [I [k] + 1]++ ;
+    for (int64_t i = 0 ; i < n ; i++) Ap [i+1] += Ap [i] ;
+    for (int64_t k = 0 ; k < nvals ; k++) Aj [Ap [I [k]]++] = J [k] ;
+    for (int64_t i = n ; i > 0 ; i--) Ap [i] = Ap [i-1] ;
+    Ap [0] = 0 ;
+
+    // Reach [i*n+j] is true if node i reaches node j
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        bool *R = Reach + i*n ;
+        int64_t top = 0 ;
+        R [i] = true ;
+        Stack [top++] = i ;
+        while (top > 0)
+        {
+            int64_t u = Stack [--top] ;
+            for (int64_t p = Ap [u] ; p < Ap [u+1] ; p++)
+            {
+                int64_t v = Aj [p] ;
+                if (!R [v])
+                {
+                    R [v] = true ;
+                    Stack [top++] = v ;
+                }
+            }
+        }
+    }
+
+    // check the result
+    GrB_Index nc = n ;
+    OK (GrB_Vector_extractTuples_UINT64 (Ci, C, &nc, c)) ;
+    TEST_CHECK (nc == n) ;
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        int64_t s = i ;
+        for (int64_t j = 0 ; j < i ; j++)
+        {
+            if (Reach [i*n+j] && Reach [j*n+i])
+            {
+                s = j ;
+                break ;
+            }
+        }
+        TEST_CHECK (Ci [i] == i && C [i] == s) ;
+    }
+
+    free (I) ;
+    free (J) ;
+    free (X) ;
+    free (Ap) ;
+    free (Aj) ;
+    free (Stack) ;
+    free (Reach) ;
+    free (C) ;
+    free (Ci) ;
+}
+
 const matrix_info files [ ] =
 {
     { "A2.mtx" },
@@ -146,6 +231,22 @@ void test_scc (void)
 
         printf ("\nscc:\n") ;
         OK (LAGraph_Vector_Print (c, pr, stdout, msg)) ;
+        check_scc (c, G->A) ;
+
+        // LAGr_StronglyConnectedComponents, without and with G->AT
+        for (int trial = 0 ; trial <= 1 ; trial++)
+        {
+            if (trial == 1)
+            {
+                OK (LAGraph_Cached_AT (G, msg)) ;
+            }
+            GrB_Vector c2 = NULL ;
+            OK (LAGr_StronglyConnectedComponents (&c2, G, msg)) ;
+            bool ok = false ;
+            OK (LAGraph_Vector_IsEqual (&ok, c, c2, msg)) ;
+            TEST_CHECK (ok) ;
+            OK (GrB_free (&c2)) ;
+        }
         OK (GrB_free (&c)) ;
         OK (LAGraph_Delete (&G, msg)) ;
     }
@@ -156,6 +257,102 @@ void test_scc (void)
     LAGraph_Finalize (msg) ;
 }
 
+//------------------------------------------------------------------------------
+// test_scc_notrim: a graph where no node is trimmed
+//------------------------------------------------------------------------------
+
+// Two cycles 0->1->2->0 and 3->4->5->3, joined by the edge 2->3.  Every node
+// has an in-edge and an out-edge, so no node is trimmed, and the
+// forward-backward search of the pivot is the first to use the labels.
+
+void test_scc_notrim (void)
+{
+    LAGraph_Init (msg) ;
+    #if LAGRAPH_SUITESPARSE
+
+    GrB_Index I [7] = { 0, 1, 2, 2, 3, 4, 5 } ;
+    GrB_Index J [7] = { 1, 2, 0, 3, 4, 5, 3 } ;
+    bool X [7] = { true, true, true, true, true, true, true } ;
+    OK (GrB_Matrix_new (&A, GrB_BOOL, 6, 6)) ;
+    OK (GrB_Matrix_build (A, I, J, X, 7, GrB_LOR)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    GrB_Vector c = NULL ;
+    OK (LAGr_StronglyConnectedComponents (&c, G, msg)) ;
+    check_scc (c, G->A) ;
+    uint64_t cgood [6] = { 0, 0, 0, 3, 3, 3 } ;
+    for (int k = 0 ; k < 6 ; k++)
+    {
+        uint64_t ck = 999 ;
+        OK (GrB_Vector_extractElement (&ck, c, k)) ;
+        TEST_CHECK (ck == cgood [k]) ;
+    }
+    OK (GrB_free (&c)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    #else
+    printf ("test skipped\n") ;
+    #endif
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_scc_reentrant: find the SCCs of several graphs at the same time
+//------------------------------------------------------------------------------
+
+#define NGRAPHS 4
+
+void test_scc_reentrant (void)
+{
+    LAGraph_Init (msg) ;
+    #if LAGRAPH_SUITESPARSE
+
+    const char *names [NGRAPHS] =
+    {
+        "cover.mtx", "west0067.mtx", "olm1000.mtx", "cryg2500.mtx"
+    } ;
+    LAGraph_Graph Gs [NGRAPHS] ;
+    GrB_Vector c1 [NGRAPHS], c2 [NGRAPHS] ;
+    int results [NGRAPHS] ;
+    for (int k = 0 ; k < NGRAPHS ; k++)
+    {
+        snprintf (filename, LEN, LG_DATA_DIR "%s", names [k]) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&(Gs [k]), &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        OK (LAGr_StronglyConnectedComponents (&(c1 [k]), Gs [k], msg)) ;
+        c2 [k] = NULL ;
+    }
+
+    // each user thread has its own msg string
+    char msgs [NGRAPHS][LAGRAPH_MSG_LEN] ;
+    int k ;
+    #pragma omp parallel for num_threads(NGRAPHS) schedule(static,1)
+    for (k = 0 ; k < NGRAPHS ; k++)
+    {
+        results [k] = LAGr_StronglyConnectedComponents (&(c2 [k]), Gs [k],
+            msgs [k]) ;
+    }
+
+    for (int k = 0 ; k < NGRAPHS ; k++)
+    {
+        OK (results [k]) ;
+        bool ok = false ;
+        OK (LAGraph_Vector_IsEqual (&ok, c1 [k], c2 [k], msg)) ;
+        TEST_CHECK (ok) ;
+        OK (GrB_free (&(c1 [k]))) ;
+        OK (GrB_free (&(c2 [k]))) ;
+        OK (LAGraph_Delete (&(Gs [k]), msg)) ;
+    }
+
+    #else
+    printf ("test skipped\n") ;
+    #endif
+    LAGraph_Finalize (msg) ;
+}
+
 //------------------------------------------------------------------------------
 // test_errors
 //------------------------------------------------------------------------------
@@ -180,6 +377,17 @@ void test_errors (void)
 
     OK (GrB_free (&c)) ;
     OK (GrB_free (&A)) ;
+
+    // c is NULL
+    result = LAGr_StronglyConnectedComponents (NULL, NULL, msg) ;
+    printf ("result: %d\n", result) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G is NULL
+    result = LAGr_StronglyConnectedComponents (&c, NULL, msg) ;
+    printf ("result: %d\n", result) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    TEST_CHECK (c == NULL) ;
     #else
     printf ("test skipped\n") ;
     #endif
@@ -190,6 +398,8 @@ void test_errors (void)
 
 TEST_LIST = {
     {"scc", test_scc},
+    {"scc_notrim", test_scc_notrim},
+    {"scc_reentrant", test_scc_reentrant},
     {"scc_errors", test_errors},
     {NULL, NULL}
 };
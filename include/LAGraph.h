@@ -200,6 +200,10 @@
  *          diagonal entries from G->A.
  *    - LAGRAPH_CONVERGENCE_FAILURE (-1005):
  *          An iterative process failed to converge to a good solution.
+ *    - LAGRAPH_NEGATIVE_CYCLE (-1006):
+ *          A shortest-path method found a cycle of negative total weight
+ *          that is reachable from the source, so the shortest paths are not
+ *          defined.
  *    - LAGRAPH_CACHE_NOT_NEEDED (1000):
  *          This is a warning, not an error.  It is returned by
  *          LAGraph_Cached_* methods when asked to compute cached properties
@@ -215,6 +219,7 @@
 #define LAGRAPH_NOT_CACHED                      (-1003)
 #define LAGRAPH_NO_SELF_EDGES_ALLOWED           (-1004)
 #define LAGRAPH_CONVERGENCE_FAILURE             (-1005)
+#define LAGRAPH_NEGATIVE_CYCLE                  (-1006)
 #define LAGRAPH_CACHE_NOT_NEEDED                ( 1000)
 
 /**
@@ -634,6 +639,7 @@ LAGraph_State ;
 //      nself_edges the number of entries on the diagonal of A
 //      emin        minimum edge weight
 //      emax        maximum edge weight
+//      delta       Delta for delta-stepping SSSP
 
 struct LAGraph_Graph_struct
 {
@@ -723,6 +729,11 @@ struct LAGraph_Graph_struct
             ///< - BOUND: emax >= max(G->A)
             ///< - UNKNOWN: emax is unknown
 
+    GrB_Scalar delta ;  ///< Delta for delta-stepping SSSP, of the same type
+            ///< as G->A, as chosen by LAGraph_SingleSourceShortestPath, or
+            ///< NULL if not yet chosen.  Any positive Delta gives the correct
+            ///< result; this cached property only affects performance.
+
     //@}
 
     // FUTURE: possible future cached properties:
@@ -735,7 +746,7 @@ struct LAGraph_Graph_struct
             // entries in its structure that are identically equal to zero.  If
             // unknown, then G->A may or may not have entries equal to zero.
     // other edge weight metrics: median, standard deviation....  Might be
-    // useful for computing Delta for a Basic SSSP.
+    // useful for refining G->delta.
     // GrB_Vector row_sum, col_sum ;
     // row_sum(i) = sum(abs(A(i,:))), regardless of kind
     // col_sum(j) = sum(abs(A(:,j))), regardless of kind
@@ -2068,6 +2079,44 @@ int LAGraph_TriangleCount
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGraph_SingleSourceShortestPath
+//------------------------------------------------------------------------------
+
+/** LAGraph_SingleSourceShortestPath: single-source shortest paths.  This is a
+ * Basic algorithm (G->emin, G->emax, G->out_degree, and G->delta are
+ * computed, if not present).  Delta for delta stepping is chosen from the
+ * largest and average edge weights and the node degrees; it is cached in
+ * G->delta and reused by later calls.  See @sphinxref{LAGr_SingleSourceShortestPath}
+ * for the supported types of G->A and the contents of path_length.
+ *
+ * @param[out]    path_length   path_length (i) is the length of the shortest
+ *                              path from the source node to node i.
+ * @param[in,out] G             input graph; cached properties computed.
+ * @param[in]     src           source node.
+ * @param[in,out] msg           any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or path_length are NULL.
+ * @retval GrB_INVALID_INDEX if src is invalid.
+ * @retval GrB_NOT_IMPLEMENTED if the type is not supported.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_SingleSourceShortestPath
+(
+    // output:
+    GrB_Vector *path_length,
+    // input/output:
+    LAGraph_Graph G,
+    // input:
+    GrB_Index src,
+    char *msg
+) ;
+
 //==============================================================================
 // LAGraph Advanced algorithms and utilities
 //==============================================================================
@@ -2283,6 +2332,42 @@ int LAGr_ConnectedComponents
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGr_WeaklyConnectedComponents: weakly connected components of a graph
+//------------------------------------------------------------------------------
+
+/** LAGr_WeaklyConnectedComponents: weakly connected components of a directed
+ * graph, which are the connected components of A+A'.  They are found without
+ * constructing A+A'.  If G is undirected, or G->is_symmetric_structure is
+ * true, the result is the same as @sphinxref{LAGr_ConnectedComponents}.  This
+ * is an Advanced algorithm (G->AT is used if present, which can make the
+ * method faster, but it is not required).
+ *
+ * @param[out] component    component(i)=s if node i is in the weakly
+ *                          connected component whose representative node is
+ *                          s, which is the smallest node in the component.
+ *                          The component vector is always dense.
+ * @param[in] G             input graph to find the components for.  It is
+ *                          modified then restored.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or component are NULL.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_WeaklyConnectedComponents
+(
+    // output:
+    GrB_Vector *component,
+    // input:
+    LAGraph_Graph G,        // input graph, modified then restored
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGr_SingleSourceShortestPath: single-source shortest paths
 //------------------------------------------------------------------------------
@@ -2313,8 +2398,8 @@ int LAGr_ConnectedComponents
  * @returns any GraphBLAS errors that may have been encountered.
  */
 
-// FUTURE: add a Basic algorithm that computes G->emin, G->emax, and then uses
-// that information to compute an appropriate (estimated) Delta.
+// See LAGraph_SingleSourceShortestPath for a Basic algorithm that computes
+// G->emin and G->emax, and uses them to choose Delta.
 
 LAGRAPH_PUBLIC
 int LAGr_SingleSourceShortestPath
@@ -2328,6 +2413,55 @@ int LAGr_SingleSourceShortestPath
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGr_BellmanFord: single-source shortest paths with negative edge weights
+//------------------------------------------------------------------------------
+
+/** LAGr_BellmanFord: single-source shortest paths for graphs that may have
+ * negative edge weights.  This is an Advanced algorithm (G->AT is used if
+ * present, but it is not required).  Each round relaxes only the edges of
+ * the nodes whose path length decreased in the prior round, with a push or
+ * pull step chosen by the size of this frontier.  G->A may have any built-in
+ * type; the edge weights are typecast to double, and it need not have any
+ * entries on its diagonal.
+ *
+ * @param[out] path_length  path_length (i) is the length of the shortest
+ *     path from the source node to node i, as a full GrB_FP64 vector.  If
+ *     node (i) is not reachable from the src node, then path_length (i) is
+ *     INFINITY.
+ * @param[out] parent   if not NULL, parent (i) is the parent of node i in a
+ *     shortest-path tree (GrB_INT64), with parent (src) = src.  Not present
+ *     for unreachable nodes.
+ * @param[out] hops     if not NULL, hops (i) is the fewest number of edges on
+ *     any shortest path from src to node i (GrB_INT64).  Not present for
+ *     unreachable nodes.
+ * @param[in] G         input graph.
+ * @param[in] src       source node.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or path_length are NULL.
+ * @retval GrB_INVALID_INDEX if src is invalid.
+ * @retval LAGRAPH_NEGATIVE_CYCLE if a negative-weight cycle is reachable
+ *     from src.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_BellmanFord
+(
+    // output:
+    GrB_Vector *path_length,
+    GrB_Vector *parent,
+    GrB_Vector *hops,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGr_Betweenness: betweeness centrality metric
 //------------------------------------------------------------------------------
@@ -2433,6 +2567,58 @@ int LAGr_PageRankGAP
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGr_PersonalizedPageRank: personalized PageRank for many seed sets
+//------------------------------------------------------------------------------
+
+/** LAGr_PersonalizedPageRank: computes k personalized PageRank vectors of a
+ * directed graph G at once, one for each row of the k-by-n seed matrix S.
+ * The sth problem teleports to node i with probability proportional to
+ * S(s,i), so a bool S teleports uniformly to the seed nodes in S(s,:).  Sinks
+ * are handled as in @sphinxref{LAGr_PageRank}.  All k problems are iterated
+ * together, with one matrix-matrix multiply with G->AT per iteration, and
+ * problems that have converged are dropped from later iterations.  This is an
+ * Advanced algorithm (G->AT and G->out_degree are required).
+ *
+ * @param[out] centrality   k-by-n matrix; centrality(s,i) is the PageRank of
+ *                          node i for the sth seed set.
+ * @param[out] iters        number of iterations taken by the slowest problem.
+ * @param[in] G             input graph.
+ * @param[in] S             k-by-n seed matrix.  Each row must have at least
+ *                          one entry, and a positive sum.
+ * @param[in] damping       damping factor (typically 0.85).
+ * @param[in] tol           stopping tolerance (typically 1e-4).
+ * @param[in] itermax       maximum number of iterations (typically 100).
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G, S, centrality, and/our iters are NULL.
+ * @retval GrB_DIMENSION_MISMATCH if S does not have n columns.
+ * @retval GrB_INVALID_VALUE if any row of S is empty or has a sum <= 0.
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present,
+ *      or if G->out_degree is not present.
+ * @retval LAGRAPH_CONVERGENCE_FAILURE if any problem fails to converge in
+ *      itermax iterations.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_PersonalizedPageRank
+(
+    // output:
+    GrB_Matrix *centrality,
+    int *iters,
+    // input:
+    const LAGraph_Graph G,
+    const GrB_Matrix S,
+    float damping,
+    float tol,
+    int itermax,
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGr_TriangleCount: triangle counting
 //------------------------------------------------------------------------------
@@ -2443,13 +2629,20 @@ int LAGr_PageRankGAP
 
 typedef enum
 {
-    LAGr_TriangleCount_AutoMethod = 0,  ///< auto selection of method
+    LAGr_TriangleCount_AutoMethod = 0,  ///< auto selection of method:
+        ///< if G->out_degree is present, the method and presort are chosen
+        ///< together, by estimating the cost of the Sandia_LL (saxpy) and
+        ///< Sandia_LUT (dot product) methods from a sample of the nodes.
+        ///< Otherwise, Sandia_LUT is used.
     LAGr_TriangleCount_Burkhardt = 1,   ///< sum (sum ((A^2) .* A)) / 6
     LAGr_TriangleCount_Cohen = 2,       ///< sum (sum ((L * U) .* A)) / 2
     LAGr_TriangleCount_Sandia_LL = 3,   ///< sum (sum ((L * L) .* L))
     LAGr_TriangleCount_Sandia_UU = 4,   ///< sum (sum ((U * U) .* U))
     LAGr_TriangleCount_Sandia_LUT = 5,  ///< sum (sum ((L * U') .* L))
     LAGr_TriangleCount_Sandia_ULT = 6,  ///< sum (sum ((U * L') .* U))
+    LAGr_TriangleCount_Merge = 7,       ///< sum (sum ((L * L') .* L)), by
+        ///< intersecting the rows of L directly, with no matrix C.  Requires
+        ///< SuiteSparse:GraphBLAS; Sandia_LUT is used otherwise.
 }
 LAGr_TriangleCount_Method ;
 
@@ -2463,13 +2656,14 @@ typedef enum
     LAGr_TriangleCount_Ascending = 1,   ///< sort by degree, ascending.
     LAGr_TriangleCount_Descending = -1, ///< sort by degree, descending.
     LAGr_TriangleCount_AutoSort = 0,    ///< auto selection of presort:
-        ///< No presort is done for the Burkhardt or Cohen methods, and
-        ///< no sort is done for the Sandia_* methods if the sampled mean
-        ///< out-degree is <= 4 * the sample median out-degree.
-        ///< Otherwise: sort in ascending order for Sandia_LL and Sandia_LUT,
-        ///< descending ordering for Sandia_UU and Sandia_ULT.  On output,
-        ///< presort is modified to reflect the sorting method used (NoSort,
-        ///< Ascending, or Descending).
+        ///< If the method is AutoMethod, the presort is chosen with it.
+        ///< Otherwise, no presort is done for the Burkhardt or Cohen methods,
+        ///< and no sort is done for the Sandia_* and Merge methods if the
+        ///< sampled mean out-degree is <= 4 * the sample median out-degree.
+        ///< Otherwise: sort in ascending order for Sandia_LL, Sandia_LUT, and
+        ///< Merge, descending ordering for Sandia_UU and Sandia_ULT.  On
+        ///< output, presort is modified to reflect the sorting method used
+        ///< (NoSort, Ascending, or Descending).
 }
 LAGr_TriangleCount_Presort ;
 
@@ -2515,6 +2709,89 @@ int LAGr_TriangleCount
     char *msg
 ) ;
 
+/** LAGr_TriangleCount_PerVertex: count the triangles that contain each node
+ * (advanced API).  The method and presort are selected as in
+ * LAGr_TriangleCount, and the result is in the original node ordering of G.
+ *
+ * @param[out] t            dense vector of type GrB_INT64, where t(i) is the
+ *                          number of triangles that contain node i.
+ * @param[in]  G            The graph, which must be undirected or have
+ *                          G->is_symmetric_structure true, with no self loops.
+ *                          G->nself_edges, G->out_degree, and
+ *                          G->is_symmetric_structure are required.
+ * @param[in,out] method    specifies which algorithm to use, and returns
+ *                          the method chosen, as in LAGr_TriangleCount.
+ * @param[in,out] presort   controls the presort of the graph, and returns the
+ *                          presort chosen, as in LAGr_TriangleCount.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or t are NULL.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @retval LAGRAPH_NO_SELF_EDGES_ALLOWED if G has any self-edges, or if
+ *      G->nself_edges is not computed.
+ * @retval LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED if G is directed with an
+ *      unsymmetric G->A matrix.
+ * @retval LAGRAPH_NOT_CACHED if G->out_degree is not present in G.
+ * @retval GrB_INVALID_VALUE method or presort are invalid.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_TriangleCount_PerVertex
+(
+    // output:
+    GrB_Vector *t,
+    // input:
+    const LAGraph_Graph G,
+    LAGr_TriangleCount_Method *method,
+    LAGr_TriangleCount_Presort *presort,
+    char *msg
+) ;
+
+/** LAGr_TriangleCount_PerEdge: count the triangles that contain each edge
+ * (advanced API).  The method and presort are selected as in
+ * LAGr_TriangleCount, and the result is in the original node ordering of G.
+ *
+ * @param[out] S            symmetric matrix of type GrB_INT64, where S(i,j)
+ *                          is the number of triangles that contain the edge
+ *                          (i,j).  Edges in no triangle have no entry in S.
+ * @param[in]  G            The graph, which must be undirected or have
+ *                          G->is_symmetric_structure true, with no self loops.
+ *                          G->nself_edges, G->out_degree, and
+ *                          G->is_symmetric_structure are required.
+ * @param[in,out] method    specifies which algorithm to use, and returns
+ *                          the method chosen, as in LAGr_TriangleCount.
+ * @param[in,out] presort   controls the presort of the graph, and returns the
+ *                          presort chosen, as in LAGr_TriangleCount.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or S are NULL.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @retval LAGRAPH_NO_SELF_EDGES_ALLOWED if G has any self-edges, or if
+ *      G->nself_edges is not computed.
+ * @retval LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED if G is directed with an
+ *      unsymmetric G->A matrix.
+ * @retval LAGRAPH_NOT_CACHED if G->out_degree is not present in G.
+ * @retval GrB_INVALID_VALUE method or presort are invalid.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_TriangleCount_PerEdge
+(
+    // output:
+    GrB_Matrix *S,
+    // input:
+    const LAGraph_Graph G,
+    LAGr_TriangleCount_Method *method,
+    LAGr_TriangleCount_Presort *presort,
+    char *msg
+) ;
+
 #if defined ( __cplusplus )
 }
 #endif
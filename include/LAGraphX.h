@@ -365,6 +365,121 @@ int LAGraph_cc_lacc (
     char *msg
 ) ;
 
+/**
+ * LAGraph_IncrementalCC: connected components of an undirected graph,
+ * maintained as a union-find forest so that they can be updated as edges are
+ * inserted, without being recomputed from scratch.  Create the object with
+ * @sphinxref{LAGr_IncrementalCC_New}, insert edges with
+ * @sphinxref{LAGraph_IncrementalCC_Insert}, get the components with
+ * @sphinxref{LAGraph_IncrementalCC_Component}, and free the object with
+ * @sphinxref{LAGraph_IncrementalCC_Delete}.
+ */
+struct LAGraph_IncrementalCC_struct
+{
+    int64_t n ;         // # of nodes in the graph
+    int64_t *Parent ;   // Parent [i]: parent of node i in the union-find
+                        // forest, or i if node i is a root.  The root of each
+                        // tree is the smallest node in its component.
+} ;
+
+typedef struct LAGraph_IncrementalCC_struct *LAGraph_IncrementalCC ;
+
+/**
+ * LAGr_IncrementalCC_New: creates an LAGraph_IncrementalCC object from the
+ * connected components of G, as computed by LAGr_ConnectedComponents.  G is
+ * not kept by the object.  This is an Advanced algorithm
+ * (G->is_symmetric_structure must be known).
+ *
+ * @param[out] state     the new object.
+ * @param[in]  G         input graph.
+ * @param[in,out] msg    any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if state is NULL.
+ * @retval LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED if G is directed and not known
+ *      to have a symmetric structure.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPHX_PUBLIC
+int LAGr_IncrementalCC_New
+(
+    // output:
+    LAGraph_IncrementalCC *state,
+    // input:
+    const LAGraph_Graph G,
+    char *msg
+) ;
+
+/**
+ * LAGraph_IncrementalCC_Insert: inserts a batch of edges.  The two nodes of
+ * each edge are linked in parallel, in O(nvals(E)*alpha(n)) time.  Each edge
+ * need only appear once in E, as either E(i,j) or E(j,i).  Edges that are
+ * already in the graph may appear in E.
+ *
+ * @param[in,out] state  object to update.
+ * @param[in]  E         n-by-n pattern of the inserted edges: E(i,j) is
+ *                       present if the edge (i,j) is inserted.  Its values
+ *                       are ignored, but its type must be built-in.
+ * @param[in,out] msg    any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if state or E are NULL.
+ * @retval GrB_DIMENSION_MISMATCH if E is not n-by-n.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPHX_PUBLIC
+int LAGraph_IncrementalCC_Insert
+(
+    // input/output:
+    LAGraph_IncrementalCC state,
+    // input:
+    const GrB_Matrix E,
+    char *msg
+) ;
+
+/**
+ * LAGraph_IncrementalCC_Component: returns the current connected components,
+ * in O(n) time.  The result is the same as LAGr_ConnectedComponents on the
+ * original graph with all of the inserted edges added: component(i) is the
+ * smallest node in the component of node i.
+ *
+ * @param[out] component component(i)=s if node i is in the component whose
+ *                       representative node is s.
+ * @param[in,out] state  the object; its trees are compressed on output.
+ * @param[in,out] msg    any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if component or state are NULL.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPHX_PUBLIC
+int LAGraph_IncrementalCC_Component
+(
+    // output:
+    GrB_Vector *component,
+    // input/output:
+    LAGraph_IncrementalCC state,
+    char *msg
+) ;
+
+/**
+ * LAGraph_IncrementalCC_Delete: frees an LAGraph_IncrementalCC object.
+ *
+ * @param[in,out] state  object to free; NULL on output.
+ * @param[in,out] msg    any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ */
+LAGRAPHX_PUBLIC
+int LAGraph_IncrementalCC_Delete
+(
+    // input/output:
+    LAGraph_IncrementalCC *state,
+    char *msg
+) ;
+
 //****************************************************************************
 // Bellman Ford variants
 //****************************************************************************
@@ -647,6 +762,730 @@ GrB_Info LAGraph_BF_pure_c_double
     const double  *W
 ) ;
 
+//****************************************************************************
+// Delta-stepping variants
+//****************************************************************************
+
+/**
+ * Delta-stepping single source shortest paths, returning both the path
+ * lengths and the shortest-path tree.  The parents are computed with a
+ * min-with-argmin semiring over (dist, parent) tuples, and ties are broken
+ * deterministically.  This is an Advanced algorithm (G->emin is required for
+ * best performance).
+ *
+ * @param[out]  path_length  as computed by LAGr_SingleSourceShortestPath
+ * @param[out]  parent       parent (i) is the parent of node i in the
+ *                           shortest-path tree (GrB_INT64), parent (src) = src,
+ *                           and not present if i is unreachable.  If NULL,
+ *                           LAGr_SingleSourceShortestPath is used instead.
+ * @param[in]   G            input graph, not modified
+ * @param[in]   src          source node
+ * @param[in]   Delta        for delta stepping
+ * @param[in,out] msg        any error messages.
+ *
+ * @retval GrB_SUCCESS          if completed successfully
+ * @retval GrB_NULL_POINTER     if G, path_length, or Delta is NULL
+ * @retval GrB_INVALID_INDEX    if src is invalid
+ * @retval GrB_EMPTY_OBJECT     if Delta does not contain a value
+ * @retval GrB_NOT_IMPLEMENTED  if the type of G->A is not supported
+ */
+LAGRAPHX_PUBLIC
+int LAGr_SingleSourceShortestPath_Parent
+(
+    // output:
+    GrB_Vector *path_length,
+    GrB_Vector *parent,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,
+    GrB_Scalar Delta,
+    char *msg
+) ;
+
+/**
+ * Delta-stepping shortest paths from a batch of sources.  The light and heavy
+ * edge matrices are computed once, and all searches advance together as an
+ * ns-by-n matrix with GrB_mxm.  If nthreads_outer > 1, the sources are split
+ * into groups that are searched in parallel.  This is an Advanced algorithm
+ * (G->emin is required for best performance).
+ *
+ * @param[out]  D            ns-by-n full matrix; D (k,i) is the length of the
+ *                           shortest path from sources [k] to node i, or
+ *                           infinity (the max integer for integer types) if i
+ *                           is not reachable from sources [k].
+ * @param[in]   G            input graph, not modified
+ * @param[in]   sources      array of size ns
+ * @param[in]   ns           number of sources
+ * @param[in]   Delta        for delta stepping
+ * @param[in,out] msg        any error messages.
+ *
+ * @retval GrB_SUCCESS          if completed successfully
+ * @retval GrB_NULL_POINTER     if G, D, sources, or Delta is NULL
+ * @retval GrB_INVALID_INDEX    if any source is invalid
+ * @retval GrB_INVALID_VALUE    if ns < 0
+ * @retval GrB_EMPTY_OBJECT     if Delta does not contain a value
+ * @retval GrB_NOT_IMPLEMENTED  if the type of G->A is not supported
+ */
+LAGRAPHX_PUBLIC
+int LAGr_MultiSourceShortestPath
+(
+    // output:
+    GrB_Matrix *D,
+    // input:
+    const LAGraph_Graph G,
+    const GrB_Index *sources,
+    int64_t ns,
+    GrB_Scalar Delta,
+    char *msg
+) ;
+
+/**
+ * Delta-stepping single source shortest paths, computed directly on the CSR
+ * form of G->A, with per-task bucket lists and a single pass that relaxes
+ * both light and heavy edges.  Same inputs and result as
+ * LAGr_SingleSourceShortestPath, but much faster when there are many small
+ * buckets.  G->A is unpacked and restored.  If SuiteSparse:GraphBLAS is not
+ * in use, LAGr_SingleSourceShortestPath is used instead.
+ *
+ * @param[out]  path_length  as computed by LAGr_SingleSourceShortestPath
+ * @param[in]   G            input graph, modified then restored
+ * @param[in]   src          source node
+ * @param[in]   Delta        for delta stepping
+ * @param[in,out] msg        any error messages.
+ *
+ * @retval GrB_SUCCESS          if completed successfully
+ * @retval GrB_NULL_POINTER     if G, path_length, or Delta is NULL
+ * @retval GrB_INVALID_INDEX    if src is invalid
+ * @retval GrB_EMPTY_OBJECT     if Delta does not contain a value
+ * @retval GrB_INVALID_VALUE    if Delta is not positive
+ * @retval GrB_NOT_IMPLEMENTED  if the type of G->A is not supported
+ */
+LAGRAPHX_PUBLIC
+int LAGr_SingleSourceShortestPath_Native
+(
+    // output:
+    GrB_Vector *path_length,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,
+    GrB_Scalar Delta,
+    char *msg
+) ;
+
+//****************************************************************************
+// Goal-directed shortest paths with landmarks
+//****************************************************************************
+
+/**
+ * Selects k landmarks by farthest-point selection, and computes the shortest
+ * path lengths between each landmark and every node, for use by
+ * LAGr_PointToPointShortestPath.  The first landmark is the node farthest from
+ * the seed node, and each following landmark is the node farthest from its
+ * closest landmark.  The path lengths are computed with
+ * LAGr_SingleSourceShortestPath, so the edge weights must not be negative.
+ * This is an Advanced algorithm (G->AT is required if G is directed).
+ *
+ * @param[out]  Dfrom        n-by-nlandmarks full GrB_FP64 matrix; Dfrom (i,j)
+ *                           is the length of the shortest path from
+ *                           landmarks [j] to node i, or INFINITY if none.
+ * @param[out]  Dto          n-by-nlandmarks full GrB_FP64 matrix; Dto (i,j) is
+ *                           the length of the shortest path from node i to
+ *                           landmarks [j].  NULL if G is undirected.
+ * @param[out]  landmarks    optional array of size k; the landmarks selected.
+ * @param[out]  nlandmarks   number of landmarks selected; less than k if all
+ *                           nodes are covered by fewer landmarks.
+ * @param[in]   G            input graph, not modified
+ * @param[in]   k            number of landmarks to select
+ * @param[in]   seed         the first landmark is the node farthest from seed
+ * @param[in]   Delta        for delta stepping
+ * @param[in,out] msg        any error messages.
+ *
+ * @retval GrB_SUCCESS          if completed successfully
+ * @retval GrB_NULL_POINTER     if G, Dfrom, Dto, or nlandmarks is NULL
+ * @retval GrB_INVALID_INDEX    if seed is invalid
+ * @retval GrB_INVALID_VALUE    if k is not positive
+ * @retval LAGRAPH_NOT_CACHED   if G is directed and G->AT is not present
+ * @retval GrB_NOT_IMPLEMENTED  if the type of G->A is not supported
+ */
+LAGRAPHX_PUBLIC
+int LAGr_Landmarks
+(
+    // output:
+    GrB_Matrix *Dfrom,
+    GrB_Matrix *Dto,
+    int64_t *landmarks,
+    int64_t *nlandmarks,
+    // input:
+    const LAGraph_Graph G,
+    int64_t k,
+    GrB_Index seed,
+    GrB_Scalar Delta,
+    char *msg
+) ;
+
+/**
+ * Length of the shortest path between two nodes, computed with a
+ * bidirectional Dijkstra search that is pruned and guided by lower bounds
+ * from the landmark distances of LAGr_Landmarks (the ALT method).  Only the
+ * nodes near the shortest path are typically visited.  The edge weights must
+ * not be negative.  G->A, G->AT, Dfrom, and Dto are unpacked and restored.
+ * This is an Advanced algorithm (G->AT is required if G is directed), and it
+ * requires SuiteSparse:GraphBLAS.
+ *
+ * @param[out]  path_length  length of the shortest path from src to dest, or
+ *                           INFINITY if dest is not reachable from src.
+ * @param[in]   G            input graph, modified then restored
+ * @param[in]   src          source node
+ * @param[in]   dest         destination node
+ * @param[in]   Dfrom        from LAGr_Landmarks, modified then restored.  If
+ *                           NULL, a plain bidirectional search is done.
+ * @param[in]   Dto          from LAGr_Landmarks (ignored if G is undirected)
+ * @param[in,out] msg        any error messages.
+ *
+ * @retval GrB_SUCCESS            if completed successfully
+ * @retval GrB_NULL_POINTER       if G or path_length is NULL, or if G is
+ *                                directed and Dfrom is present but not Dto
+ * @retval GrB_INVALID_INDEX      if src or dest is invalid
+ * @retval GrB_DIMENSION_MISMATCH if Dfrom or Dto have the wrong size
+ * @retval GrB_DOMAIN_MISMATCH    if Dfrom or Dto are not GrB_FP64
+ * @retval LAGRAPH_NOT_CACHED     if G is directed and G->AT is not present
+ * @retval GrB_NOT_IMPLEMENTED    if the type of G->A is not supported, or if
+ *                                SuiteSparse:GraphBLAS is not in use
+ */
+LAGRAPHX_PUBLIC
+int LAGr_PointToPointShortestPath
+(
+    // output:
+    double *path_length,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,
+    GrB_Index dest,
+    GrB_Matrix Dfrom,
+    GrB_Matrix Dto,
+    char *msg
+) ;
+
+//****************************************************************************
+// PageRank variants
+//****************************************************************************
+
+/**
+ * PageRank of a directed graph G, identical to LAGr_PageRank except that the
+ * iterations start from a given rank vector r0 instead of the uniform vector
+ * 1/n.  If r0 is the PageRank of a slightly different graph (such as G before
+ * a small batch of edge changes), far fewer iterations are needed.  This is an
+ * Advanced algorithm (G->AT and G->out_degree are required).
+ *
+ * @param[out] centrality   centrality(i) is the PageRank of node i.
+ * @param[out] iters        number of iterations taken.
+ * @param[in] G             input graph.
+ * @param[in] r0            initial rank vector of size n, typecasted to
+ *                          GrB_FP32 and scaled to sum to 1.  Entries not
+ *                          present are zero.  If NULL, 1/n is used.
+ * @param[in] damping       damping factor (typically 0.85).
+ * @param[in] tol           stopping tolerance (typically 1e-4).
+ * @param[in] itermax       maximum number of iterations (typically 100).
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G, centrality, and/our iters are NULL.
+ * @retval GrB_DIMENSION_MISMATCH if r0 does not have size n.
+ * @retval GrB_INVALID_VALUE if sum (r0) is not positive.
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present,
+ *      or if G->out_degree is not present.
+ * @retval LAGRAPH_CONVERGENCE_FAILURE if itermax iterations are not enough.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPHX_PUBLIC
+int LAGr_PageRankWarmStart
+(
+    // output:
+    GrB_Vector *centrality,
+    int *iters,
+    // input:
+    const LAGraph_Graph G,
+    const GrB_Vector r0,
+    float damping,
+    float tol,
+    int itermax,
+    char *msg
+) ;
+
+/**
+ * Updates the PageRank of a graph after a batch of edges has been inserted
+ * and/or deleted, with a residual-driven (Gauss-Southwell) push method.  Only
+ * the changed rows of the graph, and the nodes that the change reaches with a
+ * residual larger than tol/n, are touched, so the cost depends on the size of
+ * the change rather than the size of the graph.  The result agrees with
+ * LAGr_PageRank on G to within tol.  This is an Advanced algorithm
+ * (G->out_degree is required).
+ *
+ * @param[in,out] centrality on input, the PageRank of the graph before the
+ *                          changes, from LAGr_PageRank with the same damping.
+ *                          On output, the PageRank of G.
+ * @param[out] iters        number of push steps taken.
+ * @param[in] G             input graph, after the changes.
+ * @param[in] E             n-by-n pattern of the changed edges: E(i,j) is
+ *                          present if the edge (i,j) was inserted or deleted.
+ *                          Its values are ignored.
+ * @param[in] damping       damping factor (typically 0.85).
+ * @param[in] tol           stopping tolerance (typically 1e-4).
+ * @param[in] itermax       maximum number of push steps.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G, centrality, iters, or E are NULL.
+ * @retval GrB_DIMENSION_MISMATCH if centrality or E have the wrong size.
+ * @retval LAGRAPH_NOT_CACHED if G->out_degree is not present.
+ * @retval LAGRAPH_CONVERGENCE_FAILURE if itermax push steps are not enough.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPHX_PUBLIC
+int LAGr_PageRankIncremental
+(
+    // input/output:
+    GrB_Vector centrality,
+    // output:
+    int *iters,
+    // input:
+    const LAGraph_Graph G,
+    const GrB_Matrix E,
+    float damping,
+    float tol,
+    int itermax,
+    char *msg
+) ;
+
+/**
+ * PageRank of a directed graph G, computed with Gauss-Seidel iterations
+ * directly on the CSR form of G->AT.  The ranks are updated in place, one
+ * block of rows per task, and the norm of the change and the rank of the sinks
+ * are accumulated in the same pass, so each iteration is a single pass over
+ * G->AT.  The result is the same as LAGr_PageRank to within the tolerance,
+ * and sinks are handled the same way.  It typically converges in about half
+ * the iterations of LAGr_PageRank.  This is an Advanced algorithm (G->AT and
+ * G->out_degree are required).  G->AT is unpacked and then restored.  If
+ * SuiteSparse:GraphBLAS is not in use, LAGr_PageRank is used instead.
+ *
+ * @param[out] centrality   centrality(i) is the PageRank of node i.
+ * @param[out] iters        number of iterations taken.
+ * @param[in] G             input graph, modified then restored.
+ * @param[in] damping       damping factor (typically 0.85).
+ * @param[in] tol           stopping tolerance (typically 1e-4).
+ * @param[in] itermax       maximum number of iterations (typically 100).
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G, centrality, and/our iters are NULL.
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present,
+ *      or if G->out_degree is not present.
+ * @retval LAGRAPH_CONVERGENCE_FAILURE if itermax iterations are not enough.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPHX_PUBLIC
+int LAGr_PageRankGaussSeidel
+(
+    // output:
+    GrB_Vector *centrality,
+    int *iters,
+    // input:
+    const LAGraph_Graph G,
+    float damping,
+    float tol,
+    int itermax,
+    char *msg
+) ;
+
+/**
+ * PageRank of a directed graph G, with the same result as LAGr_PageRank, but
+ * recomputing only the ranks of the active nodes in most iterations.  A node
+ * is active if one of its in-neighbors changed by more than a threshold in the
+ * prior iteration; all other nodes are frozen and masked out of the GrB_mxv.
+ * When no nodes are active, a full iteration checks the same stopping rule as
+ * LAGr_PageRank, and the method continues with a smaller threshold if it
+ * fails.  Sinks are handled as in LAGr_PageRank.  This is an Advanced
+ * algorithm (G->AT and G->out_degree are required).
+ *
+ * @param[out] centrality   centrality(i) is the PageRank of node i.
+ * @param[out] iters        number of iterations taken, both full and
+ *                          on the active nodes only.
+ * @param[in] G             input graph.
+ * @param[in] damping       damping factor (typically 0.85).
+ * @param[in] tol           stopping tolerance (typically 1e-4).
+ * @param[in] itermax       maximum number of iterations (typically 100).
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G, centrality, and/our iters are NULL.
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present,
+ *      or if G->out_degree is not present.
+ * @retval LAGRAPH_CONVERGENCE_FAILURE if itermax iterations are not enough.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPHX_PUBLIC
+int LAGr_PageRankActiveSet
+(
+    // output:
+    GrB_Vector *centrality,
+    int *iters,
+    // input:
+    const LAGraph_Graph G,
+    float damping,
+    float tol,
+    int itermax,
+    char *msg
+) ;
+
+/** LAGr_PageRank_Precision: an enum to select the precision used by
+ * LAGr_PageRankPrecision.
+ */
+typedef enum
+{
+    LAGr_PageRank_FP32 = 0,     ///< all in single precision, as LAGr_PageRank
+    LAGr_PageRank_FP64 = 1,     ///< all in double precision
+    LAGr_PageRank_Mixed = 2,    ///< single precision ranks, double sums
+}
+LAGr_PageRank_Precision ;
+
+/**
+ * PageRank of a directed graph G, the same method as LAGr_PageRank, but with
+ * a choice of precision.  LAGr_PageRank_FP32 is the same as LAGr_PageRank.
+ * LAGr_PageRank_FP64 does all work in double precision.  LAGr_PageRank_Mixed
+ * holds the ranks in single precision, so it moves the same amount of memory
+ * as LAGr_PageRank, but it accumulates the norm of the change and the rank of
+ * the sinks in double precision, so that it can reach a small tol on very
+ * large graphs.  This is an Advanced algorithm (G->AT and G->out_degree are
+ * required).
+ *
+ * @param[out] centrality   centrality(i) is the PageRank of node i.  Its type
+ *                          is GrB_FP64 for LAGr_PageRank_FP64, or GrB_FP32
+ *                          otherwise.
+ * @param[out] iters        number of iterations taken.
+ * @param[in] G             input graph.
+ * @param[in] precision     LAGr_PageRank_FP32, _FP64, or _Mixed.
+ * @param[in] damping       damping factor (typically 0.85).
+ * @param[in] tol           stopping tolerance (typically 1e-4).
+ * @param[in] itermax       maximum number of iterations (typically 100).
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G, centrality, and/our iters are NULL.
+ * @retval GrB_INVALID_VALUE if precision is invalid.
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present,
+ *      or if G->out_degree is not present.
+ * @retval LAGRAPH_CONVERGENCE_FAILURE if itermax iterations are not enough.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPHX_PUBLIC
+int LAGr_PageRankPrecision
+(
+    // output:
+    GrB_Vector *centrality,
+    int *iters,
+    // input:
+    const LAGraph_Graph G,
+    LAGr_PageRank_Precision precision,
+    double damping,
+    double tol,
+    int itermax,
+    char *msg
+) ;
+
+//****************************************************************************
+// Betweenness centrality
+//****************************************************************************
+
+/**
+ * Betweenness centrality, computed with LAGr_Betweenness on batches of the
+ * sources, where each batch is as large as possible within a memory budget.
+ * If sources is NULL, all nodes are used as sources, which gives the exact
+ * betweenness centrality.  If nthreads_outer > 1, several batches are
+ * computed at the same time, each with nthreads_inner threads, and the budget
+ * is split among them.  This is an Advanced algorithm (G->AT is required).
+ *
+ * @param[out] centrality   centrality(i) is the metric for node i.
+ * @param[out] batch_size   number of sources in each batch (may be NULL).
+ * @param[in] G             input graph.
+ * @param[in] sources       source vertices, of size ns, or NULL for all nodes.
+ * @param[in] ns            number of source vertices (ignored if sources is
+ *                          NULL).
+ * @param[in] memory_budget maximum amount of memory to use, in bytes.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or centrality are NULL.
+ * @retval GrB_INVALID_INDEX if any source node is invalid.
+ * @retval GrB_INVALID_VALUE if ns < 0, or if the budget is too small for
+ *      a batch of one source.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPHX_PUBLIC
+int LAGr_BetweennessBatched
+(
+    // output:
+    GrB_Vector *centrality,
+    int64_t *batch_size,
+    // input:
+    const LAGraph_Graph G,
+    const GrB_Index *sources,
+    int64_t ns,
+    size_t memory_budget,
+    char *msg
+) ;
+
+/**
+ * Approximate betweenness centrality, by adaptive sampling of the sources.
+ * Sources are drawn at random in batches and their dependencies are computed
+ * with LAGr_Betweenness, until an error bound is met.  With probability at
+ * least 1-delta, abs (centrality (i) - exact (i)) <= epsilon * n * (n-1) for
+ * all nodes i, where exact is the result of LAGr_Betweenness with all nodes
+ * as sources.  If the number of sources needed in the worst case is n or
+ * more, the exact result is computed.  LAGraph_Random_Init must be called
+ * first.  This is an Advanced algorithm (G->AT is required).
+ *
+ * @param[out] centrality   centrality(i) is the estimate for node i.
+ * @param[out] nsamples     number of sources used (may be NULL).
+ * @param[in] G             input graph.
+ * @param[in] epsilon       maximum error, relative to n*(n-1), in (0,1).
+ * @param[in] delta         probability that the error bound fails, in (0,1).
+ * @param[in] seed          random number seed.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or centrality are NULL.
+ * @retval GrB_INVALID_VALUE if epsilon or delta are out of range.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @retval LAGRAPH_NOT_CACHED if G->AT is required but not present.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPHX_PUBLIC
+int LAGr_BetweennessApprox
+(
+    // output:
+    GrB_Vector *centrality,
+    int64_t *nsamples,
+    // input:
+    const LAGraph_Graph G,
+    double epsilon,
+    double delta,
+    uint64_t seed,
+    char *msg
+) ;
+
+//****************************************************************************
+// Approximate triangle counting
+//****************************************************************************
+
+/**
+ * LAGr_TriangleCountApprox_Method: the method used by
+ * LAGr_TriangleCountApprox.
+ */
+typedef enum
+{
+    /** keep each edge with probability p, and count the triangles in the
+     * sparsified graph with LAGr_TriangleCount. */
+    LAGr_TriangleCountApprox_Doulion = 0,
+    /** sample wedges (paths of length 2) at random, and find the fraction
+     * that are closed by an edge. */
+    LAGr_TriangleCountApprox_Wedge = 1,
+}
+LAGr_TriangleCountApprox_Method ;
+
+/**
+ * Estimates the number of triangles in a graph, and a confidence interval
+ * [lower,upper] that contains the exact count with about the given
+ * probability.  The Doulion method counts the triangles in nsamples
+ * sparsified graphs, each keeping an edge with probability p, and scales the
+ * mean count by 1/p^3.  The Wedge method samples nsamples wedges; it requires
+ * SuiteSparse:GraphBLAS and G->out_degree, and LAGraph_Random_Init must be
+ * called first.  This is an Advanced algorithm (G->nself_edges and
+ * G->is_symmetric_structure are required).
+ *
+ * @param[out] estimate     estimated number of triangles.
+ * @param[out] lower        lower end of the confidence interval (may be
+ *                          NULL).
+ * @param[out] upper        upper end of the confidence interval (may be
+ *                          NULL).
+ * @param[in] G             input graph, not modified (although G->A is
+ *                          modified and restored by the Wedge method).
+ * @param[in] method        LAGr_TriangleCountApprox_Doulion or
+ *                          LAGr_TriangleCountApprox_Wedge.
+ * @param[in] p             probability of keeping each edge, in (0,1]
+ *                          (Doulion method only).
+ * @param[in] nsamples      number of sparsified graphs (Doulion), or number
+ *                          of wedges (Wedge).
+ * @param[in] confidence    probability that the interval contains the exact
+ *                          count, in (0,1); typically 0.95.
+ * @param[in] seed          random number seed.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or estimate are NULL.
+ * @retval GrB_INVALID_VALUE if method, p, nsamples, or confidence are
+ *      invalid.
+ * @retval GrB_NOT_IMPLEMENTED if the Wedge method is used without
+ *      SuiteSparse:GraphBLAS.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @retval LAGRAPH_NO_SELF_EDGES_ALLOWED G has self-edges, or G->nself_edges
+ *      is not computed.
+ * @retval LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED G is directed, or
+ *      G->is_symmetric_structure is not known to be true.
+ * @retval LAGRAPH_NOT_CACHED if G->out_degree is required but not present.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPHX_PUBLIC
+int LAGr_TriangleCountApprox
+(
+    // output:
+    double *estimate,
+    double *lower,
+    double *upper,
+    // input:
+    const LAGraph_Graph G,
+    LAGr_TriangleCountApprox_Method method,
+    double p,
+    int64_t nsamples,
+    double confidence,
+    uint64_t seed,
+    char *msg
+) ;
+
+//****************************************************************************
+// k-clique counting and triangle listing
+//****************************************************************************
+
+/**
+ * LAGr_KCliqueCallback: a function called by LAGr_KCliqueCount for each
+ * k-clique it finds.  clique is an array of the k nodes of the clique, which
+ * is only valid during the call.  arg is the callback_arg passed to
+ * LAGr_KCliqueCount.  The callback may be called concurrently from several
+ * threads, so it must be thread-safe.
+ */
+typedef void (*LAGr_KCliqueCallback)
+(
+    const int64_t *clique,
+    int k,
+    void *arg
+) ;
+
+/**
+ * Counts the k-cliques of a graph (sets of k nodes that are all pairwise
+ * connected), for any k >= 2; the 3-cliques are the triangles.  The edges are
+ * oriented by ascending degree (with LAGr_SortByDegree), and the out-neighbors
+ * of each node are intersected recursively, in parallel over the nodes.  The
+ * total count, the count for each node, or both can be returned, and an
+ * optional callback lists the cliques without storing them.  This is an
+ * Advanced algorithm (G->nself_edges, G->out_degree, and
+ * G->is_symmetric_structure are required).
+ *
+ * @param[out] ncliques     total number of k-cliques (may be NULL).
+ * @param[out] count        count(i) is the number of k-cliques that contain
+ *                          node i, a dense vector of type GrB_INT64 (may be
+ *                          NULL).
+ * @param[in] G             input graph, not modified.
+ * @param[in] k             size of the cliques; k >= 2.
+ * @param[in] callback      called once for each k-clique (may be NULL).
+ * @param[in] callback_arg  passed to the callback.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G is NULL.
+ * @retval GrB_INVALID_VALUE if k < 2.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @retval LAGRAPH_NO_SELF_EDGES_ALLOWED G has self-edges, or G->nself_edges
+ *      is not computed.
+ * @retval LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED G is directed, or
+ *      G->is_symmetric_structure is not known to be true.
+ * @retval LAGRAPH_NOT_CACHED if G->out_degree is not present.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPHX_PUBLIC
+int LAGr_KCliqueCount
+(
+    // output:
+    uint64_t *ncliques,
+    GrB_Vector *count,
+    // input:
+    const LAGraph_Graph G,
+    int k,
+    LAGr_KCliqueCallback callback,
+    void *callback_arg,
+    char *msg
+) ;
+
+/**
+ * LAGr_TriangleBatchCallback: a function called by LAGr_TriangleList for each
+ * batch of triangles it finds.  triangles is an array of size 3*ntri, where
+ * triangles [3*t ... 3*t+2] are the three nodes of the t-th triangle; it is
+ * only valid during the call.  arg is the callback_arg passed to
+ * LAGr_TriangleList.  The callback may be called concurrently from several
+ * threads, so it must be thread-safe.
+ */
+typedef void (*LAGr_TriangleBatchCallback)
+(
+    const int64_t *triangles,
+    int64_t ntri,
+    void *arg
+) ;
+
+/**
+ * Lists the triangles of a graph.  The edges are oriented by ascending degree
+ * and the out-neighbors of each node are intersected, in parallel over the
+ * nodes.  Each thread collects the triangles it finds in its own buffer of
+ * batch_size triangles, and passes it to the callback when it is full, so the
+ * memory used does not depend on the number of triangles.  This is an
+ * Advanced algorithm (G->nself_edges, G->out_degree, and
+ * G->is_symmetric_structure are required).
+ *
+ * @param[out] ntriangles   total number of triangles (may be NULL).
+ * @param[in] G             input graph, not modified.
+ * @param[in] callback      called for each batch of triangles.
+ * @param[in] callback_arg  passed to the callback.
+ * @param[in] batch_size    maximum number of triangles in each batch; if
+ *                          <= 0, a default of 4096 is used.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or callback are NULL.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @retval LAGRAPH_NO_SELF_EDGES_ALLOWED G has self-edges, or G->nself_edges
+ *      is not computed.
+ * @retval LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED G is directed, or
+ *      G->is_symmetric_structure is not known to be true.
+ * @retval LAGRAPH_NOT_CACHED if G->out_degree is not present.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPHX_PUBLIC
+int LAGr_TriangleList
+(
+    // output:
+    uint64_t *ntriangles,
+    // input:
+    const LAGraph_Graph G,
+    LAGr_TriangleBatchCallback callback,
+    void *callback_arg,
+    int64_t batch_size,
+    char *msg
+) ;
+
 //****************************************************************************
 /**
  * Community detection using label propagation algorithm
@@ -709,15 +1548,20 @@ GrB_Info LAGraph_dnn
 
 //****************************************************************************
 /**
- * Compute all-pairs shortest paths using Floyd-Warshall method
+ * Compute all-pairs shortest paths using Floyd-Warshall method.  If G has many
+ * entries, a blocked (cache-tiled) parallel Floyd-Warshall method is used on a
+ * dense copy of G.  Otherwise, D is computed by repeated squaring with the
+ * min-plus semiring.
  *
  * @param[in]   G       input graph, with edge weights
- * @param[out]  D       output graph, created on output
- * @param[out]  D_type  type of scalar stored in D (see source for explanation)
+ * @param[out]  D       output graph, created on output.  D(i,j) is the length
+ *                      of the shortest path from i to j, or not present if
+ *                      there is no path.
+ * @param[out]  D_type  type of scalar stored in D: GrB_FP32 if G is
+ *                      GrB_FP32, or GrB_FP64 otherwise.
  *
  * @retval GrB_SUCCESS         if completed successfully
- * @retval GrB_NOT_IMPLEMENTED vanilla version has not been implemented yet
- * @retval GrB_NULL_POINTER    If D or D_type is NULL
+ * @retval GrB_NULL_POINTER    If G, D, or D_type is NULL
  * @retval GrB_INVALID_VALUE   If G is not square
  */
 LAGRAPHX_PUBLIC
@@ -777,6 +1621,38 @@ int LAGraph_scc (
     char *msg
 ) ;
 
+/**
+ * Strongly connected components of a graph.  Nodes with no in-edges or no
+ * out-edges are trimmed first, the SCC of a pivot node (likely the largest
+ * SCC) is found by forward and backward search, and the rest are found by
+ * label propagation.  The method has no global state, so it can be called by
+ * multiple user threads at the same time.  This is an Advanced algorithm
+ * (G->AT is used if present).  LAGraph_scc is a Basic interface to this
+ * method.  SuiteSparse:GraphBLAS is required.
+ *
+ * @param[out] component    component(i)=s if node i is in the strongly
+ *                          connected component whose representative node is
+ *                          s, which is the smallest node in the component.
+ * @param[in] G             input graph.
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G or component are NULL.
+ * @retval GrB_NOT_IMPLEMENTED if SuiteSparse:GraphBLAS is not in use.
+ * @retval LAGRAPH_INVALID_GRAPH Graph is invalid
+ *              (@sphinxref{LAGraph_CheckGraph} failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+LAGRAPHX_PUBLIC
+int LAGr_StronglyConnectedComponents
+(
+    // output:
+    GrB_Vector *component,
+    // input:
+    const LAGraph_Graph G,
+    char *msg
+) ;
+
 //****************************************************************************
 LAGRAPHX_PUBLIC
 int LAGraph_VertexCentrality_Triangle       // vertex triangle-centrality
@@ -816,6 +1692,19 @@ int LG_CC_FastSV5           // SuiteSparse:GraphBLAS method, with GxB extensions
     char *msg
 ) ;
 
+LAGRAPHX_PUBLIC
+int LG_OrientByDegree       // for LAGr_KCliqueCount and LAGr_TriangleList
+(
+    // output:
+    int64_t **Dp_handle,    // row pointers of D, of size n+1
+    int64_t **Dj_handle,    // out-neighbors of each node of D, sorted
+    int64_t **P_handle,     // node P [r] of G is node r of D, of size n
+    int64_t *dmax_handle,   // max out-degree of D
+    // input:
+    const LAGraph_Graph G,
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // kcore algorithms
 //------------------------------------------------------------------------------
@@ -854,6 +1743,26 @@ int LAGraph_KCore_Decompose
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// diameter and eccentricity
+//------------------------------------------------------------------------------
+
+LAGRAPHX_PUBLIC
+int LAGr_Diameter
+(
+    // output:
+    int64_t *diameter,      // exact diameter of G
+    int64_t *radius,        // exact radius of G; not computed if NULL
+    GrB_Vector *ecc_lower,  // lower bounds on the eccentricities; may be NULL
+    GrB_Vector *ecc_upper,  // upper bounds on the eccentricities; may be NULL
+    int64_t *nbfs,          // # of BFS traversals performed; may be NULL
+    // input:
+    const LAGraph_Graph G,  // input graph, G->A must be symmetric
+    int64_t batch_size,     // max # of BFS traversals done together
+                            // (32 is used if batch_size <= 0)
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // counting graphlets
 //------------------------------------------------------------------------------
@@ -0,0 +1,422 @@
+//------------------------------------------------------------------------------
+// LAGr_BellmanFord: single-source shortest paths with negative edge weights
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT is used if present, but it is not
+// required).
+
+// LAGr_BellmanFord computes the shortest paths from a source node to all
+// other nodes, for a graph whose edge weights may be negative.  If a
+// negative-weight cycle is reachable from the source, LAGRAPH_NEGATIVE_CYCLE
+// is returned instead.
+
+// This is a frontier-based Bellman-Ford method (also known as SPFA): each
+// round relaxes only the edges of nodes whose path length decreased in the
+// prior round, instead of the edges of all n nodes as the LAGraph_BF_*
+// methods in experimental/ do.  The tentative path lengths d are compared with
+// the product explicitly, so no diagonal entries are needed in G->A.
+
+// Like LAGraph_BF_basic_pushpull, each round uses a push step (f'*A, with
+// GrB_vxm) when the frontier f is small, or a pull step (AT*f, with GrB_mxv)
+// when it is large and the transpose is available.  AT is G->A itself if the
+// graph is undirected, or G->AT if it has been computed.
+
+// Each tentative path length is a (dist, hops, parent) tuple, of a
+// user-defined type.  The monoid selects the tuple with the smallest dist,
+// then the fewest hops, then the smallest parent, so the result does not
+// depend on the number of threads.  A node is updated only if its (dist,
+// hops) pair strictly decreases.  On output, hops (i) is the fewest number of
+// edges on any shortest path to node i, and parent (i) is its parent in a
+// shortest-path tree of such paths.
+
+// Negative cycles are detected early.  Any cycle in the parent pointers is a
+// negative-weight cycle, and the parent pointers are checked for a cycle
+// after rounds 1, 2, 4, 8, ..., so a cycle is found within about twice the
+// number of rounds it takes to form.  A decrease in the path length of the
+// source itself is also a negative cycle.  If the frontier is still not empty
+// after n rounds, a negative cycle must be present, so the method always
+// terminates.
+
+// The path lengths are computed in double precision, and returned as a full
+// GrB_FP64 vector; path_length (i) is INFINITY if node i is not reachable from
+// the source.  parent and hops are optional GrB_INT64 vectors with entries
+// only for reachable nodes; parent (source) = source and hops (source) = 0.
+
+#define LG_FREE_WORK                        \
+{                                           \
+    GrB_free (&d) ;                         \
+    GrB_free (&f) ;                         \
+    GrB_free (&t) ;                         \
+    GrB_free (&c) ;                         \
+    GrB_free (&P) ;                         \
+    GrB_free (&Tuple) ;                     \
+    GrB_free (&tuple_min) ;                 \
+    GrB_free (&tuple_min_monoid) ;          \
+    GrB_free (&tuple_plus_push) ;           \
+    GrB_free (&tuple_plus_pull) ;           \
+    GrB_free (&min_plus_push) ;             \
+    GrB_free (&min_plus_pull) ;             \
+    GrB_free (&tuple_lt) ;                  \
+    GrB_free (&set_parent) ;                \
+    GrB_free (&get_dist) ;                  \
+    GrB_free (&get_hops) ;                  \
+    GrB_free (&get_parent) ;                \
+    LAGraph_Free ((void **) &I, NULL) ;     \
+    LAGraph_Free ((void **) &X, NULL) ;     \
+    LAGraph_Free ((void **) &Px, NULL) ;    \
+    LAGraph_Free ((void **) &mark, NULL) ;  \
+}
+
+#define LG_FREE_ALL                         \
+{                                           \
+    LG_FREE_WORK ;                          \
+    GrB_free (path_length) ;                \
+    if (parent != NULL) GrB_free (parent) ; \
+    if (hops != NULL) GrB_free (hops) ;     \
+}
+
+#include "LG_internal.h"
+
+// use the pull step if the frontier has more than n/LG_BF_PULL nodes
+#define LG_BF_PULL 16
+
+//------------------------------------------------------------------------------
+// (dist, hops, parent) tuples and their operators
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    double dist ;       // tentative path length
+    int64_t hops ;      // number of edges on the path
+    int64_t parent ;    // parent node, or the node itself in the frontier
+}
+LG_BF_tuple ;
+
+// z = the tuple with the smallest (dist, hops, parent)
+static void LG_BF_min_f (void *z, const void *x, const void *y)
+{
+    const LG_BF_tuple *a = (const LG_BF_tuple *) x ;
+    const LG_BF_tuple *b = (const LG_BF_tuple *) y ;
+    bool b_is_less = (b->dist < a->dist) ||
+        (b->dist == a->dist && (b->hops < a->hops ||
+        (b->hops == a->hops && b->parent < a->parent))) ;
+    LG_BF_tuple result = b_is_less ? (*b) : (*a) ;
+    (*(LG_BF_tuple *) z) = result ;
+}
+
+// z = (x.dist + y, x.hops + 1, x.parent), for the push step f'*A
+static void LG_BF_plus_push_f (void *z, const void *x, const void *y)
+{
+    const LG_BF_tuple *a = (const LG_BF_tuple *) x ;
+    LG_BF_tuple result ;
+    result.dist = a->dist + (*(const double *) y) ;
+    result.hops = a->hops + 1 ;
+    result.parent = a->parent ;
+    (*(LG_BF_tuple *) z) = result ;
+}
+
+// z = (y.dist + x, y.hops + 1, y.parent), for the pull step AT*f
+static void LG_BF_plus_pull_f (void *z, const void *x, const void *y)
+{
+    LG_BF_plus_push_f (z, y, x) ;
+}
+
+// z = (x.dist, x.hops) < (y.dist, y.hops)
+static void LG_BF_lt_f (void *z, const void *x, const void *y)
+{
+    const LG_BF_tuple *a = (const LG_BF_tuple *) x ;
+    const LG_BF_tuple *b = (const LG_BF_tuple *) y ;
+    (*(bool *) z) = (a->dist < b->dist) ||
+        (a->dist == b->dist && a->hops < b->hops) ;
+}
+
+// z = (x.dist, x.hops, i), for the entry x = f(i)
+static void LG_BF_set_parent_f (void *z, const void *x, GrB_Index i,
+    GrB_Index j, const void *thunk)
+{
+    LG_BF_tuple result = (*(const LG_BF_tuple *) x) ;
+    result.parent = (int64_t) i ;
+    (*(LG_BF_tuple *) z) = result ;
+}
+
+// z = x.dist
+static void LG_BF_get_dist_f (void *z, const void *x)
+{
+    (*(double *) z) = ((const LG_BF_tuple *) x)->dist ;
+}
+
+// z = x.hops
+static void LG_BF_get_hops_f (void *z, const void *x)
+{
+    (*(int64_t *) z) = ((const LG_BF_tuple *) x)->hops ;
+}
+
+// z = x.parent
+static void LG_BF_get_parent_f (void *z, const void *x)
+{
+    (*(int64_t *) z) = ((const LG_BF_tuple *) x)->parent ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_BellmanFord
+//------------------------------------------------------------------------------
+
+int LAGr_BellmanFord
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source to node i
+    GrB_Vector *parent,         // parent (i) is the parent of node i in a
+                                // shortest-path tree (optional; may be NULL)
+    GrB_Vector *hops,           // hops (i) is the number of edges on the
+                                // shortest path to node i (optional)
+    // input:
+    const LAGraph_Graph G,      // input graph, not modified
+    GrB_Index source,           // source node
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector d = NULL, f = NULL, t = NULL, c = NULL, P = NULL ;
+    GrB_Type Tuple = NULL ;
+    GrB_BinaryOp tuple_min = NULL, tuple_plus_push = NULL ;
+    GrB_BinaryOp tuple_plus_pull = NULL, tuple_lt = NULL ;
+    GrB_Monoid tuple_min_monoid = NULL ;
+    GrB_Semiring min_plus_push = NULL, min_plus_pull = NULL ;
+    GrB_IndexUnaryOp set_parent = NULL ;
+    GrB_UnaryOp get_dist = NULL, get_hops = NULL, get_parent = NULL ;
+    GrB_Index *I = NULL ;
+    int64_t *X = NULL, *Px = NULL, *mark = NULL ;
+
+    LG_ASSERT (path_length != NULL, GrB_NULL_POINTER) ;
+    (*path_length) = NULL ;
+    if (parent != NULL) (*parent) = NULL ;
+    if (hops != NULL) (*hops) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+    LG_ASSERT_MSG (source < n, GrB_INVALID_INDEX, "invalid source node") ;
+
+    // the transpose of A, for the pull step, if available
+    GrB_Matrix AT = (G->kind == LAGraph_ADJACENCY_UNDIRECTED) ? A : G->AT ;
+
+    //--------------------------------------------------------------------------
+    // create the tuple type and its operators
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Type_new (&Tuple, sizeof (LG_BF_tuple))) ;
+    GRB_TRY (GrB_BinaryOp_new (&tuple_min, LG_BF_min_f, Tuple, Tuple, Tuple)) ;
+    LG_BF_tuple infinity = { INFINITY, INT64_MAX, INT64_MAX } ;
+    GRB_TRY (GrB_Monoid_new_UDT (&tuple_min_monoid, tuple_min, &infinity)) ;
+    GRB_TRY (GrB_BinaryOp_new (&tuple_plus_push, LG_BF_plus_push_f,
+        Tuple, Tuple, GrB_FP64)) ;
+    GRB_TRY (GrB_BinaryOp_new (&tuple_plus_pull, LG_BF_plus_pull_f,
+        Tuple, GrB_FP64, Tuple)) ;
+    GRB_TRY (GrB_Semiring_new (&min_plus_push, tuple_min_monoid,
+        tuple_plus_push)) ;
+    GRB_TRY (GrB_Semiring_new (&min_plus_pull, tuple_min_monoid,
+        tuple_plus_pull)) ;
+    GRB_TRY (GrB_BinaryOp_new (&tuple_lt, LG_BF_lt_f, GrB_BOOL, Tuple,
+        Tuple)) ;
+    GRB_TRY (GrB_IndexUnaryOp_new (&set_parent, LG_BF_set_parent_f,
+        Tuple, Tuple, GrB_BOOL)) ;
+    GRB_TRY (GrB_UnaryOp_new (&get_dist, LG_BF_get_dist_f, GrB_FP64, Tuple)) ;
+    GRB_TRY (GrB_UnaryOp_new (&get_hops, LG_BF_get_hops_f, GrB_INT64,
+        Tuple)) ;
+    GRB_TRY (GrB_UnaryOp_new (&get_parent, LG_BF_get_parent_f, GrB_INT64,
+        Tuple)) ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Vector_new (&d, Tuple, n)) ;
+    GRB_TRY (GrB_Vector_new (&f, Tuple, n)) ;
+    GRB_TRY (GrB_Vector_new (&t, Tuple, n)) ;
+    GRB_TRY (GrB_Vector_new (&c, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&P, GrB_INT64, n)) ;
+
+    // d (:) = (infinity, INT64_MAX, -1)
+    LG_BF_tuple unreached = { INFINITY, INT64_MAX, -1 } ;
+    GRB_TRY (GrB_Vector_assign_UDT (d, NULL, NULL, &unreached, GrB_ALL, n,
+        NULL)) ;
+
+    // d (src) = f (src) = (0, 0, src)
+    LG_BF_tuple t_source = { 0, 0, (int64_t) source } ;
+    GRB_TRY (GrB_Vector_setElement_UDT (d, &t_source, source)) ;
+    GRB_TRY (GrB_Vector_setElement_UDT (f, &t_source, source)) ;
+
+    //--------------------------------------------------------------------------
+    // relax the edges of the frontier until it is empty
+    //--------------------------------------------------------------------------
+
+    GrB_Index nq = 1 ;              // size of the frontier
+    int64_t next_check = 1 ;        // next round to check the parents
+    bool negative_cycle = false ;
+
+    for (int64_t round = 1 ; nq > 0 ; round++)
+    {
+
+        //----------------------------------------------------------------------
+        // t = the frontier f, relaxed along all its outgoing edges
+        //----------------------------------------------------------------------
+
+        // f(i).parent = i, so the product carries the node each path is from
+        GRB_TRY (GrB_apply (f, NULL, NULL, set_parent, f, 0, NULL)) ;
+
+        bool do_pull = (AT != NULL) && (nq > n / LG_BF_PULL) ;
+        if (do_pull)
+        {
+            // pull: t = AT*f
+            GRB_TRY (GrB_mxv (t, NULL, NULL, min_plus_pull, AT, f, NULL)) ;
+        }
+        else
+        {
+            // push: t = f'*A
+            GRB_TRY (GrB_vxm (t, NULL, NULL, min_plus_push, f, A, NULL)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // c = the nodes whose path length has decreased
+        //----------------------------------------------------------------------
+
+        // c = (t < d), then keep only the true entries
+        GRB_TRY (GrB_eWiseMult (c, NULL, NULL, tuple_lt, t, d, NULL)) ;
+        GRB_TRY (GrB_select (c, NULL, NULL, GrB_VALUEEQ_BOOL, c, true,
+            NULL)) ;
+
+        // d<struct(c)> = t
+        GRB_TRY (GrB_assign (d, c, NULL, t, GrB_ALL, n, GrB_DESC_S)) ;
+
+        // f<struct(c), replace> = t
+        GRB_TRY (GrB_assign (f, c, NULL, t, GrB_ALL, n, GrB_DESC_RS)) ;
+        GRB_TRY (GrB_Vector_nvals (&nq, f)) ;
+        if (nq == 0) break ;
+
+        //----------------------------------------------------------------------
+        // check for a negative-weight cycle
+        //----------------------------------------------------------------------
+
+        bool src_decreased = false ;
+        int info = GrB_Vector_extractElement_BOOL (&src_decreased, c,
+            source) ;
+        GRB_TRY (info) ;
+        if (info == GrB_SUCCESS && src_decreased)
+        {
+            // a path back to the source has negative length
+            negative_cycle = true ;
+            break ;
+        }
+
+        if (round >= (int64_t) n)
+        {
+            // the frontier is not empty after n rounds
+            negative_cycle = true ;
+            break ;
+        }
+
+        if (round == next_check)
+        {
+            // look for a cycle in the parent pointers of reachable nodes
+            next_check *= 2 ;
+            GrB_Index np = n ;
+            if (I == NULL)
+            {
+                LG_TRY (LAGraph_Malloc ((void **) &I, n, sizeof (GrB_Index),
+                    msg)) ;
+                LG_TRY (LAGraph_Malloc ((void **) &X, n, sizeof (int64_t),
+                    msg)) ;
+                LG_TRY (LAGraph_Malloc ((void **) &Px, n, sizeof (int64_t),
+                    msg)) ;
+                LG_TRY (LAGraph_Malloc ((void **) &mark, n, sizeof (int64_t),
+                    msg)) ;
+            }
+            GRB_TRY (GrB_apply (P, NULL, NULL, get_parent, d, NULL)) ;
+            GRB_TRY (GrB_select (P, NULL, NULL, GrB_VALUEGE_INT64, P, 0,
+                NULL)) ;
+            GRB_TRY (GrB_Vector_extractTuples_INT64 (I, X, &np, P)) ;
+            for (int64_t i = 0 ; i < (int64_t) n ; i++)
+            {
+                Px [i] = -1 ;
+                mark [i] = -1 ;
+            }
+            for (int64_t k = 0 ; k < (int64_t) np ; k++)
+            {
+                Px [I [k]] = X [k] ;
+            }
+            // follow the parents from each node, marking each node with the
+            // node where the walk started; stop at the source or at a node
+            // already visited.  Returning to a node marked by the current
+            // walk is a cycle.
+            for (int64_t k = 0 ; k < (int64_t) np && !negative_cycle ; k++)
+            {
+                int64_t i = I [k] ;
+                while (i != (int64_t) source && mark [i] < 0)
+                {
+                    mark [i] = I [k] ;
+                    i = Px [i] ;
+                }
+                negative_cycle = (i != (int64_t) source &&
+                    mark [i] == (int64_t) I [k]) ;
+            }
+            if (negative_cycle) break ;
+        }
+    }
+
+    LG_ASSERT_MSG (!negative_cycle, LAGRAPH_NEGATIVE_CYCLE,
+        "a negative-weight cycle is reachable from the source") ;
+
+    //--------------------------------------------------------------------------
+    // extract the path lengths, parents, and hops
+    //--------------------------------------------------------------------------
+
+    // path_length = d.dist, which is INFINITY for unreachable nodes
+    GRB_TRY (GrB_Vector_new (path_length, GrB_FP64, n)) ;
+    GRB_TRY (GrB_apply (*path_length, NULL, NULL, get_dist, d, NULL)) ;
+
+    if (parent != NULL || hops != NULL)
+    {
+        // P = d.parent, for reachable nodes only
+        GRB_TRY (GrB_apply (P, NULL, NULL, get_parent, d, NULL)) ;
+        GRB_TRY (GrB_select (P, NULL, NULL, GrB_VALUEGE_INT64, P, 0, NULL)) ;
+    }
+
+    if (hops != NULL)
+    {
+        // hops<struct(P)> = d.hops
+        GRB_TRY (GrB_Vector_new (hops, GrB_INT64, n)) ;
+        GRB_TRY (GrB_apply (*hops, P, NULL, get_hops, d, GrB_DESC_S)) ;
+    }
+
+    if (parent != NULL)
+    {
+        (*parent) = P ;
+        P = NULL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -17,8 +17,11 @@
 
 // This is an Advanced algorithm (G->is_symmetric_structure must be known).
 
-// Connected Components via LG_CC_FastSV6 if using SuiteSparse:GraphBLAS and
+// Connected Components via LG_CC_Afforest if using SuiteSparse:GraphBLAS and
 // its GxB extensions, or LG_CC_Boruvka otherwise.  The former is much faster.
+// LG_CC_FastSV6 is also available for SuiteSparse:GraphBLAS; it computes the
+// same result, but LG_CC_Afforest is typically faster since it works on the
+// CSR structure of G->A directly rather than through GraphBLAS operations.
 
 #include "LG_alg_internal.h"
 
@@ -34,7 +37,16 @@ int LAGr_ConnectedComponents
 {
 
     #if LAGRAPH_SUITESPARSE
-    return (LG_CC_FastSV6 (component, G, msg)) ;
+    // LG_CC_Afforest also handles directed graphs (see
+    // LAGr_WeaklyConnectedComponents), but this method does not
+    LG_CLEAR_MSG ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG ((G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE)),
+        LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED,
+        "G->A must be known to be symmetric") ;
+    return (LG_CC_Afforest (component, G, msg)) ;
     #else
     return (LG_CC_Boruvka (component, G, msg)) ;
     #endif
@@ -0,0 +1,340 @@
+//------------------------------------------------------------------------------
+// LAGr_PersonalizedPageRank: personalized pagerank for many seed sets at once
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT and G->out_degree are required).
+
+// LAGr_PersonalizedPageRank computes k personalized PageRank vectors at once.
+// Row s of the k-by-n seed matrix S defines the teleport vector of the sth
+// problem: v_s = S(s,:) / sum (S(s,:)).  If S is a bool matrix (such as a
+// pattern), the teleport vector is uniform over the seed nodes S(s,:).  Each
+// step of LAGr_PageRank teleports to all nodes with probability (1-damping)/n;
+// here, the sth problem teleports to node i with probability
+// (1-damping)*v_s(i) instead.  Sinks are handled as in LAGr_PageRank: the rank
+// of all sinks is spread evenly over all nodes.  If every row of S has all n
+// nodes, the result is k copies of the result of LAGr_PageRank.
+
+// The k rank vectors are held as the columns of an n-by-k matrix R, so that
+// each step is a single R += AT*W with GrB_mxm, with the same semiring as
+// LAGr_PageRank.  This reads AT once per step for all k problems, instead of
+// once per problem.  Each column of R is checked for convergence on its own.
+// Once the sth column has converged, it is copied into the result, and it is
+// removed from R, so the remaining steps only work on the columns that have
+// not yet converged.
+
+// On output, centrality is a k-by-n dense GrB_FP32 matrix, where
+// centrality(s,i) is the personalized PageRank of node i for the sth seed set,
+// and iters is the number of steps taken by the slowest problem.
+
+#define LG_FREE_WORK                        \
+{                                           \
+    GrB_free (&R) ;                         \
+    GrB_free (&T) ;                         \
+    GrB_free (&W) ;                         \
+    GrB_free (&V) ;                         \
+    GrB_free (&X) ;                         \
+    GrB_free (&Dinv) ;                      \
+    GrB_free (&Ones) ;                      \
+    GrB_free (&Tel) ;                       \
+    GrB_free (&d) ;                         \
+    GrB_free (&d1) ;                        \
+    GrB_free (&sink) ;                      \
+    GrB_free (&rsink) ;                     \
+    GrB_free (&rdiff) ;                     \
+    LAGraph_Free ((void **) &K, NULL) ;     \
+    LAGraph_Free ((void **) &Keep, NULL) ;  \
+    LAGraph_Free ((void **) &Done, NULL) ;  \
+    LAGraph_Free ((void **) &Kdone, NULL) ; \
+    LAGraph_Free ((void **) &Diff, NULL) ;  \
+    LAGraph_Free ((void **) &Dx, NULL) ;    \
+}
+
+#define LG_FREE_ALL                         \
+{                                           \
+    LG_FREE_WORK ;                          \
+    GrB_free (&C) ;                         \
+    GrB_free (centrality) ;                 \
+}
+
+#include "LG_internal.h"
+
+int LAGr_PersonalizedPageRank
+(
+    // output:
+    GrB_Matrix *centrality, // centrality(s,i): pagerank of node i, for seeds s
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Matrix S,     // k-by-n seed matrix; S(s,:) is the sth seed set
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix C = NULL, R = NULL, T = NULL, W = NULL, V = NULL, X = NULL ;
+    GrB_Matrix Dinv = NULL, Ones = NULL, Tel = NULL ;
+    GrB_Vector d = NULL, d1 = NULL, sink = NULL, rsink = NULL, rdiff = NULL ;
+    GrB_Index *K = NULL, *Keep = NULL, *Done = NULL, *Kdone = NULL ;
+    float *Diff = NULL, *Dx = NULL ;
+    LG_ASSERT (centrality != NULL && iters != NULL && S != NULL,
+        GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    GrB_Matrix AT ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE)
+    {
+        // A and A' have the same structure
+        AT = G->A ;
+    }
+    else
+    {
+        // A and A' differ
+        AT = G->AT ;
+        LG_ASSERT_MSG (AT != NULL, LAGRAPH_NOT_CACHED, "G->AT is required") ;
+    }
+    GrB_Vector d_out = G->out_degree ;
+    LG_ASSERT_MSG (d_out != NULL,
+        LAGRAPH_NOT_CACHED, "G->out_degree is required") ;
+
+    GrB_Index n, k, ncols ;
+    GRB_TRY (GrB_Matrix_nrows (&n, AT)) ;
+    GRB_TRY (GrB_Matrix_nrows (&k, S)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, S)) ;
+    LG_ASSERT_MSG (ncols == n, GrB_DIMENSION_MISMATCH,
+        "S must have n columns") ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    const float damping_over_n = damping / n ;
+
+    // the result C is n-by-k, and transposed when done
+    GRB_TRY (GrB_Matrix_new (&C, GrB_FP32, n, k)) ;
+    GRB_TRY (GrB_assign (C, NULL, NULL, (float) 0, GrB_ALL, n, GrB_ALL, k,
+        NULL)) ;
+
+    // rdiff = sum (S, 2), the size of each seed set
+    GRB_TRY (GrB_Vector_new (&rdiff, GrB_FP32, k)) ;
+    GRB_TRY (GrB_reduce (rdiff, NULL, NULL, GrB_PLUS_MONOID_FP32, S, NULL)) ;
+    GrB_Index nvals ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, rdiff)) ;
+    float smin = 1 ;
+    GRB_TRY (GrB_reduce (&smin, NULL, GrB_MIN_MONOID_FP32, rdiff, NULL)) ;
+    LG_ASSERT_MSG (nvals == k && smin > 0, GrB_INVALID_VALUE,
+        "each seed set must be nonempty with a positive sum") ;
+
+    // V = S' * diag (1 ./ rdiff), so each column of V sums to 1
+    GRB_TRY (GrB_apply (rdiff, NULL, NULL, GrB_MINV_FP32, rdiff, NULL)) ;
+    GRB_TRY (GrB_Matrix_diag (&X, rdiff, 0)) ;
+    GRB_TRY (GrB_Matrix_new (&V, GrB_FP32, n, k)) ;
+    GRB_TRY (GrB_mxm (V, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP32, S, X,
+        GrB_DESC_T0)) ;
+    GRB_TRY (GrB_free (&X)) ;
+
+    // the first rank vectors are the teleport vectors: R = V
+    GRB_TRY (GrB_Matrix_dup (&R, V)) ;
+    GRB_TRY (GrB_Matrix_new (&T, GrB_FP32, n, k)) ;
+    GRB_TRY (GrB_Matrix_new (&W, GrB_FP32, n, k)) ;
+    GRB_TRY (GrB_Matrix_new (&X, GrB_FP32, n, k)) ;
+
+    // prescale V with (1 - damping), so it isn't done each iteration
+    GRB_TRY (GrB_apply (V, NULL, NULL, GrB_TIMES_FP32, V, 1 - damping, NULL)) ;
+
+    // find all sinks, where sink(i) = true if node i has d_out(i)=0, or with
+    // d_out(i) not present, as in LAGr_PageRank
+    GrB_Index nsinks ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, d_out)) ;
+    nsinks = n - nvals ;
+    if (nsinks > 0)
+    {
+        // sink<!struct(d_out)> = true
+        GRB_TRY (GrB_Vector_new (&sink, GrB_BOOL, n)) ;
+        GRB_TRY (GrB_assign (sink, d_out, NULL, (bool) true, GrB_ALL, n,
+            GrB_DESC_SC)) ;
+        GRB_TRY (GrB_Vector_new (&rsink, GrB_FP32, k)) ;
+        // Ones = ones (n,1), Tel is 1-by-k
+        GRB_TRY (GrB_Matrix_new (&Ones, GrB_FP32, n, 1)) ;
+        GRB_TRY (GrB_assign (Ones, NULL, NULL, (float) 1, GrB_ALL, n, GrB_ALL,
+            1, NULL)) ;
+        GRB_TRY (GrB_Matrix_new (&Tel, GrB_FP32, 1, k)) ;
+    }
+
+    // Dinv = diag (1 ./ max (d_out / damping, 1 / damping))
+    GRB_TRY (GrB_Vector_new (&d, GrB_FP32, n)) ;
+    GRB_TRY (GrB_apply (d, NULL, NULL, GrB_DIV_FP32, d_out, damping, NULL)) ;
+    float dmin = 1.0 / damping ;
+    GRB_TRY (GrB_Vector_new (&d1, GrB_FP32, n)) ;
+    GRB_TRY (GrB_assign (d1, NULL, NULL, dmin, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_eWiseAdd (d, NULL, NULL, GrB_MAX_FP32, d1, d, NULL)) ;
+    GRB_TRY (GrB_apply (d, NULL, NULL, GrB_MINV_FP32, d, NULL)) ;
+    GRB_TRY (GrB_Matrix_diag (&Dinv, d, 0)) ;
+    GrB_free (&d1) ;
+    GrB_free (&d) ;
+
+    // K [0..nk-1]: the seed sets that have not yet converged
+    LG_TRY (LAGraph_Malloc ((void **) &K, k, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Keep, k, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Done, k, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Kdone, k, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Diff, k, sizeof (float), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Dx, k, sizeof (float), msg)) ;
+    for (int64_t s = 0 ; s < k ; s++)
+    {
+        K [s] = s ;
+    }
+    GrB_Index nk = k ;
+
+    //--------------------------------------------------------------------------
+    // pagerank iterations
+    //--------------------------------------------------------------------------
+
+    for ((*iters) = 0 ; nk > 0 ; (*iters)++)
+    {
+        // check for convergence
+        LG_ASSERT_MSGF ((*iters) < itermax, LAGRAPH_CONVERGENCE_FAILURE,
+            "pagerank failed to converge in %d iterations", itermax) ;
+
+        // swap T and R ; now T holds the old scores
+        GrB_Matrix temp = T ; T = R ; R = temp ;
+
+        // W = Dinv * T
+        GRB_TRY (GrB_mxm (W, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP32, Dinv,
+            T, NULL)) ;
+
+        if (nsinks > 0)
+        {
+            // handle the sinks: R(:,s) = (damping/n) * sum (T (sink,s))
+            GRB_TRY (GrB_vxm (rsink, NULL, NULL, LAGraph_plus_second_fp32,
+                sink, T, NULL)) ;
+            GRB_TRY (GrB_apply (rsink, NULL, NULL, GrB_TIMES_FP32, rsink,
+                damping_over_n, NULL)) ;
+            GRB_TRY (GrB_Row_assign (Tel, NULL, NULL, rsink, 0, GrB_ALL, nk,
+                NULL)) ;
+            GRB_TRY (GrB_mxm (R, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP32,
+                Ones, Tel, NULL)) ;
+            // R += V
+            GRB_TRY (GrB_eWiseAdd (R, NULL, NULL, GrB_PLUS_FP32, R, V, NULL)) ;
+        }
+        else
+        {
+            // R = V
+            GRB_TRY (GrB_assign (R, NULL, NULL, V, GrB_ALL, n, GrB_ALL, nk,
+                NULL)) ;
+        }
+
+        // R += AT*W
+        GRB_TRY (GrB_mxm (R, NULL, GrB_PLUS_FP32, LAGraph_plus_second_fp32,
+            AT, W, NULL)) ;
+
+        // rdiff = sum (abs (T - R)), for each column
+        GRB_TRY (GrB_eWiseAdd (X, NULL, NULL, GrB_MINUS_FP32, T, R, NULL)) ;
+        GRB_TRY (GrB_apply (X, NULL, NULL, GrB_ABS_FP32, X, NULL)) ;
+        GRB_TRY (GrB_assign (rdiff, NULL, NULL, (float) 0, GrB_ALL, nk,
+            NULL)) ;
+        GRB_TRY (GrB_reduce (rdiff, NULL, GrB_PLUS_FP32, GrB_PLUS_MONOID_FP32,
+            X, GrB_DESC_T0)) ;
+
+        //----------------------------------------------------------------------
+        // remove the columns that have converged
+        //----------------------------------------------------------------------
+
+        // Diff [s] = rdiff (s), using Done as workspace
+        GrB_Index ndiff = nk ;
+        GRB_TRY (GrB_Vector_extractTuples_FP32 (Done, Dx, &ndiff, rdiff)) ;
+        for (int64_t p = 0 ; p < ndiff ; p++)
+        {
+            Diff [Done [p]] = Dx [p] ;
+        }
+
+        GrB_Index nkeep = 0, ndone = 0 ;
+        for (int64_t s = 0 ; s < nk ; s++)
+        {
+            if (Diff [s] > tol)
+            {
+                Keep [nkeep++] = s ;
+            }
+            else
+            {
+                Done [ndone] = s ;
+                Kdone [ndone++] = K [s] ;
+            }
+        }
+        if (ndone == 0) continue ;
+
+        // C(:,Kdone) = R(:,Done)
+        GRB_TRY (GrB_free (&X)) ;
+        GRB_TRY (GrB_Matrix_new (&X, GrB_FP32, n, ndone)) ;
+        GRB_TRY (GrB_extract (X, NULL, NULL, R, GrB_ALL, n, Done, ndone,
+            NULL)) ;
+        GRB_TRY (GrB_assign (C, NULL, GrB_PLUS_FP32, X, GrB_ALL, n, Kdone,
+            ndone, NULL)) ;
+        GRB_TRY (GrB_free (&X)) ;
+        if (nkeep == 0)
+        {
+            // all seed sets have converged
+            nk = 0 ;
+            continue ;
+        }
+
+        // R = R(:,Keep), V = V(:,Keep), and K = K(Keep)
+        GRB_TRY (GrB_Matrix_new (&X, GrB_FP32, n, nkeep)) ;
+        GRB_TRY (GrB_extract (X, NULL, NULL, R, GrB_ALL, n, Keep, nkeep,
+            NULL)) ;
+        GrB_free (&R) ;
+        R = X ;
+        X = NULL ;
+        GRB_TRY (GrB_Matrix_new (&X, GrB_FP32, n, nkeep)) ;
+        GRB_TRY (GrB_extract (X, NULL, NULL, V, GrB_ALL, n, Keep, nkeep,
+            NULL)) ;
+        GrB_free (&V) ;
+        V = X ;
+        X = NULL ;
+        for (int64_t p = 0 ; p < nkeep ; p++)
+        {
+            K [p] = K [Keep [p]] ;
+        }
+        nk = nkeep ;
+
+        // resize the workspace for the remaining columns
+        GRB_TRY (GrB_Matrix_resize (T, n, nk)) ;
+        GRB_TRY (GrB_Matrix_resize (W, n, nk)) ;
+        GRB_TRY (GrB_Matrix_new (&X, GrB_FP32, n, nk)) ;
+        GRB_TRY (GrB_Vector_resize (rdiff, nk)) ;
+        if (nsinks > 0)
+        {
+            GRB_TRY (GrB_Vector_resize (rsink, nk)) ;
+            GRB_TRY (GrB_Matrix_resize (Tel, 1, nk)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    // centrality = C'
+    GRB_TRY (GrB_Matrix_new (centrality, GrB_FP32, k, n)) ;
+    GRB_TRY (GrB_transpose (*centrality, NULL, NULL, C, NULL)) ;
+    GrB_free (&C) ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
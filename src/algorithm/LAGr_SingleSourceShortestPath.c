@@ -31,12 +31,14 @@
 // LAGr_SingleSourceShortestPath computes the shortest path lengths from the
 // specified source vertex to all other vertices in the graph.
 
-// The parent vector is not computed; see LAGraph_BF_* instead.
+// The parent vector is not computed; see
+// LAGr_SingleSourceShortestPath_Parent in experimental/ instead.
 
 // NOTE: this method gets stuck in an infinite loop when there are negative-
 // weight cycles in the graph.
 
-// FUTURE: a Basic algorithm that picks Delta automatically
+// See LAGraph_SingleSourceShortestPath for a Basic algorithm that picks Delta
+// automatically.
 
 #define LG_FREE_WORK        \
 {                           \
@@ -262,11 +264,6 @@ int LAGr_SingleSourceShortestPath
         {
             GRB_TRY (GrB_Scalar_extractElement_FP64 (&emin, G->emin)) ;
         }
-//      else
-//      {
-//          // a future Basic algorithm should compute G->emin and perhaps
-//          // G->emax, then compute Delta automatically.
-//      }
         negative_edge_weights = (emin < 0) ;
     }
 
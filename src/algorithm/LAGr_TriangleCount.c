@@ -24,17 +24,23 @@
 // number of triangles in the graph.  A triangle is a clique of size three,
 // that is, 3 nodes that are all pairwise connected.
 
-// One of 6 methods are used, defined below where L and U are the strictly
+// One of 7 methods are used, defined below where L and U are the strictly
 // lower and strictly upper triangular parts of the symmetrix matrix A,
 // respectively.  Each method computes the same result, ntri:
 
-//  0:  default:    use the default method (currently method Sandia_LUT)
+//  0:  default:    the method and presort are chosen by a cost model (see
+//                  LG_TriangleCount_Select), or Sandia_LUT if G->out_degree
+//                  is not present.
 //  1:  Burkhardt:  ntri = sum (sum ((A^2) .* A)) / 6
 //  2:  Cohen:      ntri = sum (sum ((L * U) .* A)) / 2
 //  3:  Sandia_LL:  ntri = sum (sum ((L * L) .* L))
 //  4:  Sandia_UU:  ntri = sum (sum ((U * U) .* U))
 //  5:  Sandia_LUT: ntri = sum (sum ((L * U') .* L)).  Note that L=U'.
 //  6:  Sandia_ULT: ntri = sum (sum ((U * L') .* U)).  Note that U=L'.
+//  7:  Merge:      ntri = sum (sum ((L * L') .* L)), computed directly by
+//                  intersecting the rows of L (see LG_TriangleCount_Merge),
+//                  without constructing C.  If SuiteSparse:GraphBLAS is not
+//                  in use, the Sandia_LUT method is used instead.
 
 // A is a square symmetric matrix, of any type.  Its values are ignored.
 // Results are undefined for methods 1 and 2 if self-edges exist in A.  Results
@@ -64,7 +70,7 @@
     GrB_free (U) ;              \
 }
 
-#include "LG_internal.h"
+#include "LG_alg_internal.h"
 
 //------------------------------------------------------------------------------
 // tricount_prep: construct L and U for LAGr_TriangleCount
@@ -134,66 +140,20 @@ int LAGr_TriangleCount
     GrB_Matrix C = NULL, L = NULL, U = NULL, T = NULL ;
     int64_t *P = NULL ;
 
-    // get the method
+    LG_ASSERT (ntriangles != NULL, GrB_NULL_POINTER) ;
+
+    // get the method and presort, and check the graph
     LAGr_TriangleCount_Method method ;
     method = (p_method == NULL) ? LAGr_TriangleCount_AutoMethod : (*p_method) ;
-    LG_ASSERT_MSG (
-    method == LAGr_TriangleCount_AutoMethod ||  // 0: use auto method
-    method == LAGr_TriangleCount_Burkhardt  ||  // 1: sum (sum ((A^2) .* A))/6
-    method == LAGr_TriangleCount_Cohen      ||  // 2: sum (sum ((L * U) .*A))/2
-    method == LAGr_TriangleCount_Sandia_LL  ||  // 3: sum (sum ((L * L) .* L))
-    method == LAGr_TriangleCount_Sandia_UU  ||  // 4: sum (sum ((U * U) .* U))
-    method == LAGr_TriangleCount_Sandia_LUT ||  // 5: sum (sum ((L * U') .* L))
-    method == LAGr_TriangleCount_Sandia_ULT,    // 6: sum (sum ((U * L') .* U))
-    GrB_INVALID_VALUE, "method is invalid") ;
-
-    // get the presort
     LAGr_TriangleCount_Presort presort ;
     presort = (p_presort == NULL) ? LAGr_TriangleCount_AutoSort : (*p_presort) ;
-    LG_ASSERT_MSG (
-    presort == LAGr_TriangleCount_NoSort     ||
-    presort == LAGr_TriangleCount_Ascending  ||
-    presort == LAGr_TriangleCount_Descending ||
-    presort == LAGr_TriangleCount_AutoSort,
-    GrB_INVALID_VALUE, "presort is invalid") ;
-
-    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
-    LG_ASSERT (ntriangles != NULL, GrB_NULL_POINTER) ;
-    LG_ASSERT (G->nself_edges == 0, LAGRAPH_NO_SELF_EDGES_ALLOWED) ;
-
-    LG_ASSERT_MSG ((G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
-       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
-        G->is_symmetric_structure == LAGraph_TRUE)),
-        LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED,
-        "G->A must be known to be symmetric") ;
-
-    if (method == LAGr_TriangleCount_AutoMethod)
-    {
-        // AutoMethod: use default, Sandia_LUT: sum (sum ((L * U') .* L))
-        method = LAGr_TriangleCount_Sandia_LUT ;
-    }
-
-    // only the Sandia_* methods can benefit from the presort
-    bool method_can_use_presort =
-    method == LAGr_TriangleCount_Sandia_LL || // sum (sum ((L * L) .* L))
-    method == LAGr_TriangleCount_Sandia_UU || // sum (sum ((U * U) .* U))
-    method == LAGr_TriangleCount_Sandia_LUT || // sum (sum ((L * U') .* L))
-    method == LAGr_TriangleCount_Sandia_ULT ; // sum (sum ((U * L') .* U))
-
-    GrB_Matrix A = G->A ;
-    GrB_Vector Degree = G->out_degree ;
-
-    bool auto_sort = (presort == LAGr_TriangleCount_AutoSort) ;
-    if (auto_sort && method_can_use_presort)
-    {
-        LG_ASSERT_MSG (Degree != NULL,
-            LAGRAPH_NOT_CACHED, "G->out_degree is required") ;
-    }
+    LG_TRY (LG_TriangleCount_Select (&method, &presort, G, msg)) ;
 
     //--------------------------------------------------------------------------
     // initializations
     //--------------------------------------------------------------------------
 
+    GrB_Matrix A = G->A ;
     GrB_Index n ;
     GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
     GRB_TRY (GrB_Matrix_new (&C, GrB_INT64, n, n)) ;
@@ -204,75 +164,6 @@ int LAGr_TriangleCount
     #endif
     GrB_Monoid monoid = GrB_PLUS_MONOID_INT64 ;
 
-    //--------------------------------------------------------------------------
-    // heuristic sort rule
-    //--------------------------------------------------------------------------
-
-    if (!method_can_use_presort)
-    {
-        // no sorting for the Burkhardt and Cohen methods: presort parameter
-        // is ignored.
-        presort = LAGr_TriangleCount_NoSort ;
-    }
-    else if (auto_sort)
-    {
-        // auto selection of sorting method for Sandia_* methods
-        presort = LAGr_TriangleCount_NoSort ; // default is not to sort
-
-        if (method_can_use_presort)
-        {
-            // This rule is very similar to Scott Beamer's rule in the GAP TC
-            // benchmark, except that it is extended to handle the ascending
-            // sort needed by methods 3 and 5.  It also uses a stricter rule,
-            // since the performance of triangle counting in SuiteSparse:
-            // GraphBLAS is less sensitive to the sorting as compared to the
-            // GAP algorithm.  This is because the dot products in SuiteSparse:
-            // GraphBLAS use binary search if one vector is very sparse
-            // compared to the other.  As a result, SuiteSparse:GraphBLAS needs
-            // the sort for fewer matrices, as compared to the GAP algorithm.
-
-            // With this rule, the GAP-kron and GAP-twitter matrices are
-            // sorted, and the others remain unsorted.  With the rule in the
-            // GAP tc.cc benchmark, GAP-kron and GAP-twitter are sorted, and so
-            // is GAP-web, but GAP-web is not sorted here.
-
-            #define NSAMPLES 1000
-            GrB_Index nvals ;
-            GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
-            if (n > NSAMPLES && ((double) nvals / ((double) n)) >= 10)
-            {
-                // estimate the mean and median degrees
-                double mean, median ;
-                LG_TRY (LAGr_SampleDegree (&mean, &median,
-                    G, true, NSAMPLES, n, msg)) ;
-                // sort if the average degree is very high vs the median
-                if (mean > 4 * median)
-                {
-                    switch (method)
-                    {
-                        case LAGr_TriangleCount_Sandia_LL:
-                            // 3:sum (sum ((L * L) .* L))
-                            presort = LAGr_TriangleCount_Ascending  ;
-                            break ;
-                        case LAGr_TriangleCount_Sandia_UU:
-                            // 4: sum (sum ((U * U) .* U))
-                            presort = LAGr_TriangleCount_Descending ;
-                            break ;
-                        default:
-                        case LAGr_TriangleCount_Sandia_LUT:
-                            // 5: sum (sum ((L * U') .* L))
-                            presort = LAGr_TriangleCount_Ascending  ;
-                            break ;
-                        case LAGr_TriangleCount_Sandia_ULT:
-                            // 6: sum (sum ((U * L') .* U))
-                            presort = LAGr_TriangleCount_Descending ;
-                            break ;
-                    }
-                }
-            }
-        }
-    }
-
     //--------------------------------------------------------------------------
     // sort the input matrix, if requested
     //--------------------------------------------------------------------------
@@ -352,6 +243,19 @@ int LAGr_TriangleCount
             GRB_TRY (GrB_mxm (C, U, NULL, semiring, U, L, GrB_DESC_ST1)) ;
             GRB_TRY (GrB_reduce (&ntri, NULL, monoid, C, NULL)) ;
             break ;
+
+        case LAGr_TriangleCount_Merge: // 7: sum (sum ((L * L') .* L))
+
+            LG_TRY (tricount_prep (&L, NULL, A, msg)) ;
+            #if LAGRAPH_SUITESPARSE
+            // intersect the rows of L directly
+            LG_TRY (LG_TriangleCount_Merge (&ntri, L, msg)) ;
+            #else
+            // using the masked dot product
+            GRB_TRY (GrB_mxm (C, L, NULL, semiring, L, L, GrB_DESC_ST1)) ;
+            GRB_TRY (GrB_reduce (&ntri, NULL, monoid, C, NULL)) ;
+            #endif
+            break ;
     }
 
     //--------------------------------------------------------------------------
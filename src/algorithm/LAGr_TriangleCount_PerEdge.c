@@ -0,0 +1,205 @@
+//------------------------------------------------------------------------------
+// LAGr_TriangleCount_PerEdge: number of triangles incident on each edge
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->nself_edges, G->out_degree,
+// G->is_symmetric_structure are required).
+
+// LAGr_TriangleCount_PerEdge computes the support matrix S of a symmetric
+// graph with no self-edges, where S(i,j) is the number of triangles that
+// contain the edge (i,j).  S is symmetric, of type GrB_INT64, and has an entry
+// only for those edges of G->A that appear in at least one triangle.  The sum
+// of all entries in S is 6 times the number of triangles.
+
+// The method and presort are selected just as in LAGr_TriangleCount.  The
+// support is computed by a masked product, where L and U are the strictly
+// lower and upper triangular parts of A:
+
+//  1:  Burkhardt:  S = (A*A) .* A
+//  2:  Cohen:      S = (A*A) .* A, the same as Burkhardt
+//  3:  Sandia_LL:  S = (A*A) .* L, with the saxpy method, then S = S+S'
+//  4:  Sandia_UU:  S = (A*A) .* U, with the saxpy method, then S = S+S'
+//  5:  Sandia_LUT: S = (A*A') .* L, with the dot product method, then S = S+S'
+//  6:  Sandia_ULT: S = (A*A') .* U, with the dot product method, then S = S+S'
+//  7:  Merge:      S = (A*A') .* L, the same as Sandia_LUT
+
+// The Sandia_* methods compute just one triangular half of S, which is half
+// the work of the Burkhardt method.  If the graph is presorted by degree, S is
+// computed for the permuted graph and then permuted back, so that S(i,j)
+// always refers to the nodes i and j of G->A.
+
+#define LG_FREE_WORK                        \
+{                                           \
+    GrB_free (&T) ;                         \
+    GrB_free (&M) ;                         \
+    GrB_free (&C) ;                         \
+    LAGraph_Free ((void **) &P, NULL) ;     \
+}
+
+#define LG_FREE_ALL                         \
+{                                           \
+    LG_FREE_WORK ;                          \
+    GrB_free (S) ;                          \
+}
+
+#include "LG_alg_internal.h"
+
+int LAGr_TriangleCount_PerEdge
+(
+    // output:
+    GrB_Matrix *S,          // S(i,j): # of triangles containing edge (i,j)
+    // input:
+    const LAGraph_Graph G,
+    LAGr_TriangleCount_Method *p_method,
+    LAGr_TriangleCount_Presort *p_presort,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix T = NULL, M = NULL, C = NULL ;
+    int64_t *P = NULL ;
+
+    LG_ASSERT (S != NULL, GrB_NULL_POINTER) ;
+    (*S) = NULL ;
+
+    // get the method and presort, and check the graph
+    LAGr_TriangleCount_Method method ;
+    method = (p_method == NULL) ? LAGr_TriangleCount_AutoMethod : (*p_method) ;
+    LAGr_TriangleCount_Presort presort ;
+    presort = (p_presort == NULL) ? LAGr_TriangleCount_AutoSort : (*p_presort) ;
+    LG_TRY (LG_TriangleCount_Select (&method, &presort, G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    #if LAGRAPH_SUITESPARSE
+    GrB_Semiring semiring = GxB_PLUS_PAIR_INT64 ;
+    #else
+    GrB_Semiring semiring = LAGraph_plus_one_int64 ;
+    #endif
+
+    //--------------------------------------------------------------------------
+    // sort the input matrix, if requested
+    //--------------------------------------------------------------------------
+
+    if (presort != LAGr_TriangleCount_NoSort)
+    {
+        // P = permutation that sorts the rows by their degree
+        LG_TRY (LAGr_SortByDegree (&P, G, true,
+            presort == LAGr_TriangleCount_Ascending, msg)) ;
+
+        // T = A (P,P) and typecast to boolean
+        GRB_TRY (GrB_Matrix_new (&T, GrB_BOOL, n, n)) ;
+        GRB_TRY (GrB_extract (T, NULL, NULL, A, (GrB_Index *) P, n,
+            (GrB_Index *) P, n, NULL)) ;
+        A = T ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compute the support
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_new (&C, GrB_INT64, n, n)) ;
+
+    switch (method)
+    {
+
+        case LAGr_TriangleCount_Burkhardt:  // 1: C = (A*A) .* A
+        case LAGr_TriangleCount_Cohen:      // 2: C = (A*A) .* A
+
+            GRB_TRY (GrB_mxm (C, A, NULL, semiring, A, A, GrB_DESC_S)) ;
+            break ;
+
+        case LAGr_TriangleCount_Sandia_LL:  // 3: C = (A*A) .* L, then C+C'
+        case LAGr_TriangleCount_Sandia_UU:  // 4: C = (A*A) .* U, then C+C'
+
+            // M = tril (A,-1) or triu (A,1)
+            GRB_TRY (GrB_Matrix_new (&M, GrB_BOOL, n, n)) ;
+            if (method == LAGr_TriangleCount_Sandia_LL)
+            {
+                GRB_TRY (GrB_select (M, NULL, NULL, GrB_TRIL, A,
+                    (int64_t) (-1), NULL)) ;
+            }
+            else
+            {
+                GRB_TRY (GrB_select (M, NULL, NULL, GrB_TRIU, A,
+                    (int64_t) 1, NULL)) ;
+            }
+            // using the masked saxpy3 method
+            GRB_TRY (GrB_mxm (C, M, NULL, semiring, A, A, GrB_DESC_S)) ;
+            break ;
+
+        default:
+        case LAGr_TriangleCount_Sandia_LUT: // 5: C = (A*A') .* L, then C+C'
+        case LAGr_TriangleCount_Sandia_ULT: // 6: C = (A*A') .* U, then C+C'
+        case LAGr_TriangleCount_Merge:      // 7: C = (A*A') .* L, then C+C'
+
+            // M = tril (A,-1) or triu (A,1)
+            GRB_TRY (GrB_Matrix_new (&M, GrB_BOOL, n, n)) ;
+            if (method == LAGr_TriangleCount_Sandia_ULT)
+            {
+                GRB_TRY (GrB_select (M, NULL, NULL, GrB_TRIU, A,
+                    (int64_t) 1, NULL)) ;
+            }
+            else
+            {
+                GRB_TRY (GrB_select (M, NULL, NULL, GrB_TRIL, A,
+                    (int64_t) (-1), NULL)) ;
+            }
+            // using the masked dot product
+            GRB_TRY (GrB_mxm (C, M, NULL, semiring, A, A, GrB_DESC_ST1)) ;
+            break ;
+    }
+
+    if (M != NULL)
+    {
+        // C = C + C', to include the other triangular half
+        GRB_TRY (GrB_eWiseAdd (C, NULL, NULL, GrB_PLUS_INT64, C, C,
+            GrB_DESC_T1)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // undo the presort: S (P,P) = C
+    //--------------------------------------------------------------------------
+
+    if (P != NULL)
+    {
+        GRB_TRY (GrB_Matrix_new (S, GrB_INT64, n, n)) ;
+        GRB_TRY (GrB_assign (*S, NULL, NULL, C, (GrB_Index *) P, n,
+            (GrB_Index *) P, n, NULL)) ;
+    }
+    else
+    {
+        (*S) = C ;
+        C = NULL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    if (p_method != NULL) (*p_method) = method ;
+    if (p_presort != NULL) (*p_presort) = presort ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,84 @@
+//------------------------------------------------------------------------------
+// LAGr_TriangleCount_PerVertex: number of triangles incident on each node
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->nself_edges, G->out_degree,
+// G->is_symmetric_structure are required).
+
+// LAGr_TriangleCount_PerVertex computes a dense vector t of type GrB_INT64,
+// where t(i) is the number of triangles that contain node i.  The sum of t is
+// 3 times the number of triangles.  Each triangle that contains node i has two
+// edges incident on i, so t = sum (S,2) / 2, where S is the support matrix
+// computed by LAGr_TriangleCount_PerEdge, with the same method and presort.
+
+#define LG_FREE_WORK                        \
+{                                           \
+    GrB_free (&S) ;                         \
+}
+
+#define LG_FREE_ALL                         \
+{                                           \
+    LG_FREE_WORK ;                          \
+    GrB_free (t) ;                          \
+}
+
+#include "LG_alg_internal.h"
+
+int LAGr_TriangleCount_PerVertex
+(
+    // output:
+    GrB_Vector *t,          // t(i): # of triangles containing node i
+    // input:
+    const LAGraph_Graph G,
+    LAGr_TriangleCount_Method *method,
+    LAGr_TriangleCount_Presort *presort,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix S = NULL ;
+    LG_ASSERT (t != NULL, GrB_NULL_POINTER) ;
+    (*t) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // S = support of each edge
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGr_TriangleCount_PerEdge (&S, G, method, presort, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // t = sum (S,2) / 2
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, S)) ;
+    GRB_TRY (GrB_Vector_new (t, GrB_INT64, n)) ;
+    GRB_TRY (GrB_assign (*t, NULL, NULL, (int64_t) 0, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_reduce (*t, NULL, GrB_PLUS_INT64, GrB_PLUS_MONOID_INT64, S,
+        NULL)) ;
+    GRB_TRY (GrB_apply (*t, NULL, NULL, GrB_DIV_INT64, *t, (int64_t) 2,
+        NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,165 @@
+//------------------------------------------------------------------------------
+// LAGr_WeaklyConnectedComponents: weakly connected components of a graph
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->AT is used if present).
+
+// The weakly connected components of a directed graph are the connected
+// components of the undirected graph with adjacency matrix A+A'.  They are
+// found here without constructing A+A'.  If G is undirected, or directed with
+// a symmetric structure, the components are the same as those found by
+// LAGr_ConnectedComponents.
+
+// With SuiteSparse:GraphBLAS, LG_CC_Afforest is used.  It links the two
+// nodes of each edge of A in a union-find forest, which does not depend on the
+// direction of the edge.  If G->AT is present, it is also used, so that the
+// nodes in the largest component can be skipped in the last phase.
+// Otherwise, all edges of A are linked.
+
+// Otherwise, if G is undirected or has a symmetric structure, the components
+// are found by LAGr_ConnectedComponents.  Its representative of a component
+// need not be the smallest node in it, so the result is relabeled.  If G is
+// directed and unsymmetric, the smallest node index in each component is
+// propagated along the edges of A in both directions, with GrB_mxv on A and
+// on A' (with the GrB_DESC_T0 descriptor, so A' is not constructed), until no
+// labels change.  This takes O(d) iterations, where d is the largest diameter
+// of any component.
+
+// On output, component(i) is the smallest node index in the weakly connected
+// component of node i.
+
+#define LG_FREE_WORK                                                        \
+{                                                                           \
+    GrB_free (&f_prior) ;                                                   \
+    LAGraph_Free ((void **) &I, NULL) ;                                     \
+    LAGraph_Free ((void **) &X, NULL) ;                                     \
+    LAGraph_Free ((void **) &Min, NULL) ;                                   \
+}
+
+#define LG_FREE_ALL                                                         \
+{                                                                           \
+    LG_FREE_WORK ;                                                          \
+    GrB_free (&f) ;                                                         \
+}
+
+#include "LG_alg_internal.h"
+
+int LAGr_WeaklyConnectedComponents
+(
+    // output:
+    GrB_Vector *component,  // component(i)=s if node i is in the weakly
+                            // connected component whose representative is s
+    // input:
+    LAGraph_Graph G,        // input graph (modified then restored)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector f = NULL, f_prior = NULL ;
+    GrB_Index *I = NULL ;
+    uint64_t *X = NULL, *Min = NULL ;
+    LG_ASSERT (component != NULL, GrB_NULL_POINTER) ;
+    (*component) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // find the weakly connected components
+    //--------------------------------------------------------------------------
+
+    #if LAGRAPH_SUITESPARSE
+
+        // union-find on G->A (and G->AT if present)
+        LG_TRY (LG_CC_Afforest (component, G, msg)) ;
+
+    #else
+
+        GrB_Index n ;
+        GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &I, LAGRAPH_MAX (n, 1),
+            sizeof (GrB_Index), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &X, LAGRAPH_MAX (n, 1),
+            sizeof (uint64_t), msg)) ;
+
+        if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+           (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+            G->is_symmetric_structure == LAGraph_TRUE))
+        {
+            // the weakly connected components are the connected components
+            LG_TRY (LAGr_ConnectedComponents (&f, G, msg)) ;
+
+            // Min [s] = smallest node in the component with representative s
+            LG_TRY (LAGraph_Malloc ((void **) &Min, LAGRAPH_MAX (n, 1),
+                sizeof (uint64_t), msg)) ;
+            GrB_Index nvals = n ;
+            GRB_TRY (GrB_Vector_extractTuples_UINT64 (I, X, &nvals, f)) ;
+            for (int64_t k = 0 ; k < n ; k++)
+            {
+                Min [k] = n ;
+            }
+            for (int64_t p = 0 ; p < nvals ; p++)
+            {
+                Min [X [p]] = LAGRAPH_MIN (Min [X [p]], I [p]) ;
+            }
+
+            // f(i) = Min [f(i)]
+            for (int64_t p = 0 ; p < nvals ; p++)
+            {
+                X [p] = Min [X [p]] ;
+            }
+            GRB_TRY (GrB_Vector_clear (f)) ;
+            GRB_TRY (GrB_Vector_build (f, I, X, nvals, GrB_PLUS_UINT64)) ;
+        }
+        else
+        {
+            // f = 0:n-1
+            for (int64_t i = 0 ; i < n ; i++)
+            {
+                I [i] = i ;
+                X [i] = i ;
+            }
+            GRB_TRY (GrB_Vector_new (&f, GrB_UINT64, n)) ;
+            GRB_TRY (GrB_Vector_build (f, I, X, n, GrB_PLUS_UINT64)) ;
+            GRB_TRY (GrB_Vector_new (&f_prior, GrB_UINT64, n)) ;
+
+            bool done = false ;
+            while (!done)
+            {
+                GRB_TRY (GrB_assign (f_prior, NULL, NULL, f, GrB_ALL, n,
+                    NULL)) ;
+                // f = min (f, min (A*f)): along the edges of A in reverse
+                GRB_TRY (GrB_mxv (f, NULL, GrB_MIN_UINT64,
+                    GrB_MIN_SECOND_SEMIRING_UINT64, G->A, f, NULL)) ;
+                // f = min (f, min (A'*f)): along the edges of A
+                GRB_TRY (GrB_mxv (f, NULL, GrB_MIN_UINT64,
+                    GrB_MIN_SECOND_SEMIRING_UINT64, G->A, f, GrB_DESC_T0)) ;
+                LG_TRY (LAGraph_Vector_IsEqual (&done, f, f_prior, msg)) ;
+            }
+        }
+        (*component) = f ;
+        f = NULL ;
+
+    #endif
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
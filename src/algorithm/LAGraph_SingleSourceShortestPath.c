@@ -0,0 +1,166 @@
+//------------------------------------------------------------------------------
+// LAGraph_SingleSourceShortestPath: single-source shortest path (Basic)
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is a Basic algorithm (G->emin, G->emax, G->out_degree, and G->delta
+// are computed, if not present).
+
+// Delta stepping is correct for any Delta > 0, but its performance depends
+// strongly on Delta.  If Delta is too small, there are many nearly empty
+// buckets and each costs several GraphBLAS calls; if Delta is too large,
+// nodes are relaxed many times before their path length settles.  For random
+// edge weights in the range [0,emax] and an average degree d, a Delta of
+// emax/d is a good choice (Meyer and Sanders, "Delta-stepping: a
+// parallelizable shortest path algorithm", J. Algorithms, 2003).
+
+// Delta is chosen here as follows.  The largest edge weight is replaced with
+// twice the mean edge weight if that is smaller, so that a few outliers in
+// the edge weights do not inflate Delta.  The degree d is the average
+// out-degree, unless a sample of the out-degrees shows that the degree
+// distribution is highly skewed (the mean more than 4 times the median), in
+// which case the sampled median is used instead, since most nodes relaxed
+// then have a degree closer to the median.  Delta is then at least emin (if
+// emin is positive), and at least 1 for integer types.
+
+// The resulting Delta is cached in G->delta, and reused by subsequent calls.
+
+#define LG_FREE_ALL         \
+{                           \
+    GrB_free (&Delta) ;     \
+}
+
+#include "LG_internal.h"
+
+#define NSAMPLES 1000
+
+int LAGraph_SingleSourceShortestPath
+(
+    // output:
+    GrB_Vector *path_length,    // path_length (i) is the length of the shortest
+                                // path from the source vertex to vertex i
+    // input/output:
+    LAGraph_Graph G,            // input graph; cached properties computed
+    // input:
+    GrB_Index source,           // source vertex
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Scalar Delta = NULL ;
+    LG_ASSERT (path_length != NULL, GrB_NULL_POINTER) ;
+    (*path_length) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    GrB_Type etype ;
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, G->A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&etype, typename, msg)) ;
+    bool is_int = (etype == GrB_INT32 || etype == GrB_INT64 ||
+                   etype == GrB_UINT32 || etype == GrB_UINT64) ;
+    LG_ASSERT_MSG (is_int || etype == GrB_FP32 || etype == GrB_FP64,
+        GrB_NOT_IMPLEMENTED, "type not supported") ;
+
+    //--------------------------------------------------------------------------
+    // compute the cached properties
+    //--------------------------------------------------------------------------
+
+    // G->emin is needed by LAGr_SingleSourceShortestPath
+    LG_TRY (LAGraph_Cached_EMin (G, msg)) ;
+
+    if (G->delta == NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // get the edge weight statistics
+        //----------------------------------------------------------------------
+
+        LG_TRY (LAGraph_Cached_EMax (G, msg)) ;
+        LG_TRY (LAGraph_Cached_OutDegree (G, msg)) ;
+
+        GrB_Index n, nvals ;
+        GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+        GRB_TRY (GrB_Matrix_nvals (&nvals, G->A)) ;
+
+        double emin = 0, emax = 0, esum = 0 ;
+        if (nvals > 0)
+        {
+            GRB_TRY (GrB_Scalar_extractElement_FP64 (&emin, G->emin)) ;
+            GRB_TRY (GrB_Scalar_extractElement_FP64 (&emax, G->emax)) ;
+            GRB_TRY (GrB_reduce (&esum, NULL, GrB_PLUS_MONOID_FP64, G->A,
+                NULL)) ;
+        }
+
+        // the scale of the edge weights: emax, or 2*mean if smaller
+        double emean = (nvals > 0) ? (esum / (double) nvals) : 0 ;
+        double escale = LAGRAPH_MIN (emax, 2 * emean) ;
+        if (escale <= 0)
+        {
+            // all or most edge weights are negative or zero
+            escale = LAGRAPH_MAX (emax, fabs (emin)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // get the degree
+        //----------------------------------------------------------------------
+
+        double d = (n > 0) ? ((double) nvals / (double) n) : 1 ;
+        if (n > NSAMPLES)
+        {
+            double mean, median ;
+            LG_TRY (LAGr_SampleDegree (&mean, &median, G, true, NSAMPLES, n,
+                msg)) ;
+            if (mean > 4 * median)
+            {
+                d = median ;
+            }
+        }
+        d = LAGRAPH_MAX (d, 1) ;
+
+        //----------------------------------------------------------------------
+        // choose Delta and cache it in G->delta
+        //----------------------------------------------------------------------
+
+        double delta = escale / d ;
+        if (emin > 0)
+        {
+            // each bucket should include at least the lightest edges
+            delta = LAGRAPH_MAX (delta, emin) ;
+        }
+        if (is_int)
+        {
+            delta = LAGRAPH_MAX (floor (delta), 1) ;
+        }
+        if (!isfinite (delta) || delta <= 0)
+        {
+            delta = 1 ;
+        }
+
+        GRB_TRY (GrB_Scalar_new (&Delta, etype)) ;
+        GRB_TRY (GrB_Scalar_setElement_FP64 (Delta, delta)) ;
+        G->delta = Delta ;
+        Delta = NULL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compute the shortest paths
+    //--------------------------------------------------------------------------
+
+    return (LAGr_SingleSourceShortestPath (path_length, G, source, G->delta,
+        msg)) ;
+}
@@ -0,0 +1,277 @@
+//------------------------------------------------------------------------------
+// LG_CC_Afforest: connected components by sampled union-find
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced algorithm (G->is_symmetric_structure must be known),
+// but it is not user-callable (see LAGr_ConnectedComponents and
+// LAGr_WeaklyConnectedComponents instead).
+
+// Code is based on the algorithm described in the following paper:
+// Sutton, Ben-Nun, Barak: Optimizing Parallel Graph Connectivity Computation
+// via Subgraph Sampling (IPDPS 2018), and on the Afforest kernel in the GAP
+// benchmark suite (cc.cc).
+
+// Each node starts in its own tree of a union-find forest.  Two trees are
+// linked with LG_union_link, which hooks the root with the larger index onto
+// the one with the smaller index with an atomic compare-and-swap, so no locks
+// are needed.  The computation has three phases:
+
+// (1) sampling: for each of the first LG_AFFOREST_ROUNDS neighbors j of each
+//     node i, the trees of i and j are linked.  The trees are then compressed
+//     (with LG_union_compress) so that each node points directly to its
+//     root.  This typically finds most of the largest component.
+// (2) the largest component: its root is estimated as the most frequent root
+//     in a random sample of LG_AFFOREST_SAMPLES nodes.
+// (3) finish: each node i not in the largest component is linked with all of
+//     its remaining neighbors.  Nodes in the largest component are skipped;
+//     since A is symmetric, any edge between them and another component is
+//     found from the other end.  The trees are compressed once more.
+
+// On output, component(i) is the smallest node index in the component of i.
+
+// If G is undirected, or directed with an adjacency matrix that has a
+// symmetric structure, the connected components are found.  Otherwise, the
+// weakly connected components of the directed graph are found, since linking
+// two trees does not depend on the direction of the edge.  No symmetric copy
+// of A is made.  In phase (3), the nodes in the largest component can then
+// only be skipped if G->AT is present, since an edge (i,j) from a skipped
+// node i is only found from the other end as the entry AT(j,i).  If G->AT is
+// not present, phase (3) links all the remaining edges of all nodes.
+
+// Self-edges (diagonal entries) are OK, and are ignored.  The values and type
+// of A are ignored; just its structure is accessed.
+
+// NOTE: This function must not be called by multiple user threads at the same
+// time on the same graph G, since it unpacks G->A (and G->AT, if used) and
+// then packs them back when done.  G->A and G->AT are unchanged when the
+// function returns, but during execution they are empty.
+
+#define LG_FREE_WORK                                                        \
+{                                                                           \
+    LAGraph_Free ((void **) &Comp, NULL) ;                                  \
+    LAGraph_Free ((void **) &Comp32, NULL) ;                                \
+    LAGraph_Free ((void **) &Samples, NULL) ;                               \
+    if (Ap != NULL)                                                         \
+    {                                                                       \
+        /* pack A back into G */                                            \
+        GxB_Matrix_pack_CSR (G->A, &Ap, &Aj, &Ax, Ap_size, Aj_size,         \
+            Ax_size, A_iso, A_jumbled, NULL) ;                              \
+    }                                                                       \
+    if (Tp != NULL)                                                         \
+    {                                                                       \
+        /* pack AT back into G */                                           \
+        GxB_Matrix_pack_CSR (G->AT, &Tp, &Tj, &Tx, Tp_size, Tj_size,        \
+            Tx_size, T_iso, T_jumbled, NULL) ;                              \
+    }                                                                       \
+}
+
+#define LG_FREE_ALL                                                         \
+{                                                                           \
+    LG_FREE_WORK ;                                                          \
+    GrB_free (&parent) ;                                                    \
+}
+
+#include "LG_internal.h"
+
+// number of neighbors of each node used in the sampling phase
+#define LG_AFFOREST_ROUNDS 2
+
+// number of nodes sampled to find the largest component
+#define LG_AFFOREST_SAMPLES 1024
+
+//------------------------------------------------------------------------------
+// LG_CC_Afforest
+//------------------------------------------------------------------------------
+
+int LG_CC_Afforest          // SuiteSparse:GraphBLAS method, with GxB extensions
+(
+    // output:
+    GrB_Vector *component,  // component(i)=r if node is in the component r
+    // input:
+    LAGraph_Graph G,        // input graph (modified then restored)
+    char *msg
+)
+{
+
+#if !LAGRAPH_SUITESPARSE
+    return (GrB_NOT_IMPLEMENTED) ;
+#else
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    int64_t *Comp = NULL, *Samples = NULL ;
+    uint32_t *Comp32 = NULL ;
+    GrB_Index *Ap = NULL, *Aj = NULL, Ap_size, Aj_size, Ax_size ;
+    GrB_Index *Tp = NULL, *Tj = NULL, Tp_size, Tj_size, Tx_size ;
+    void *Ax = NULL, *Tx = NULL ;
+    bool A_iso = false, A_jumbled = false, T_iso = false, T_jumbled = false ;
+    GrB_Vector parent = NULL ;
+
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (component != NULL, GrB_NULL_POINTER) ;
+    (*component) = NULL ;
+
+    bool symmetric = (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE)) ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+
+    int nthreads, nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    nthreads = nthreads_outer * nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, n / 16) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    // Comp [i] = i: each node is in its own tree
+    LG_TRY (LAGraph_Malloc ((void **) &Comp, LAGRAPH_MAX (n, 1),
+        sizeof (int64_t), msg)) ;
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (i = 0 ; i < n ; i++)
+    {
+        Comp [i] = i ;
+    }
+
+    // unpack A in CSR format; the rows need not be sorted
+    GRB_TRY (GxB_Matrix_unpack_CSR (G->A, &Ap, &Aj, &Ax, &Ap_size, &Aj_size,
+        &Ax_size, &A_iso, &A_jumbled, NULL)) ;
+    if (!symmetric && G->AT != NULL)
+    {
+        // unpack AT in CSR format, for the in-edges of each node
+        GRB_TRY (GxB_Matrix_unpack_CSR (G->AT, &Tp, &Tj, &Tx, &Tp_size,
+            &Tj_size, &Tx_size, &T_iso, &T_jumbled, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // phase 1: link each node with its first few neighbors
+    //--------------------------------------------------------------------------
+
+    for (int r = 0 ; r < LG_AFFOREST_ROUNDS ; r++)
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,16384)
+        for (i = 0 ; i < n ; i++)
+        {
+            int64_t p = Ap [i] + r ;
+            if (p < (int64_t) Ap [i+1])
+            {
+                LG_union_link (Comp, i, Aj [p]) ;
+            }
+        }
+        LG_union_compress (Comp, n, nthreads) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // phase 2: find the root of the largest component, by sampling
+    //--------------------------------------------------------------------------
+
+    int64_t c = -1 ;
+    if (n > 0)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &Samples, LG_AFFOREST_SAMPLES,
+            sizeof (int64_t), msg)) ;
+        uint64_t seed = n ;
+        for (int k = 0 ; k < LG_AFFOREST_SAMPLES ; k++)
+        {
+            Samples [k] = Comp [LG_Random60 (&seed) % n] ;
+        }
+        // c = the most frequent root in the sample
+        LG_qsort_1a (Samples, LG_AFFOREST_SAMPLES) ;
+        int64_t cmax = 0 ;
+        for (int k = 0 ; k < LG_AFFOREST_SAMPLES ; )
+        {
+            int k2 = k ;
+            while (k2 < LG_AFFOREST_SAMPLES && Samples [k2] == Samples [k])
+            {
+                k2++ ;
+            }
+            if (k2 - k > cmax)
+            {
+                cmax = k2 - k ;
+                c = Samples [k] ;
+            }
+            k = k2 ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // phase 3: link all other nodes with their remaining neighbors
+    //--------------------------------------------------------------------------
+
+    // the largest component can be skipped if each edge is seen from both ends
+    bool skip = symmetric || (Tp != NULL) ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,16384)
+    for (i = 0 ; i < n ; i++)
+    {
+        // skip the node if it is already in the largest component
+        if (skip && Comp [i] == c) continue ;
+        for (int64_t p = Ap [i] + LG_AFFOREST_ROUNDS ; p < (int64_t) Ap [i+1] ;
+            p++)
+        {
+            LG_union_link (Comp, i, Aj [p]) ;
+        }
+        if (Tp != NULL)
+        {
+            // link i with all of its in-neighbors
+            for (int64_t p = Tp [i] ; p < (int64_t) Tp [i+1] ; p++)
+            {
+                LG_union_link (Comp, i, Tj [p]) ;
+            }
+        }
+    }
+    LG_union_compress (Comp, n, nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // construct the component vector
+    //--------------------------------------------------------------------------
+
+    // the vector has the same type as the output of LG_CC_FastSV6
+    if (n > INT32_MAX)
+    {
+        GRB_TRY (GrB_Vector_new (&parent, GrB_UINT64, n)) ;
+        GRB_TRY (GxB_Vector_pack_Full (parent, (void **) &Comp,
+            n * sizeof (uint64_t), false, NULL)) ;
+    }
+    else
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &Comp32, LAGRAPH_MAX (n, 1),
+            sizeof (uint32_t), msg)) ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (i = 0 ; i < n ; i++)
+        {
+            Comp32 [i] = (uint32_t) Comp [i] ;
+        }
+        GRB_TRY (GrB_Vector_new (&parent, GrB_UINT32, n)) ;
+        GRB_TRY (GxB_Vector_pack_Full (parent, (void **) &Comp32,
+            n * sizeof (uint32_t), false, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*component) = parent ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+#endif
+}
@@ -0,0 +1,221 @@
+//------------------------------------------------------------------------------
+// LG_PageRank: pagerank iteration, with an optional start and precision
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis and Mohsen Aznaveh, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// This is an Advanced method (G->AT and G->out_degree are required), but it
+// is not user-callable.  It is the method of LAGr_PageRank, which is also used
+// by LAGr_PageRankWarmStart and LAGr_PageRankPrecision.  See LAGr_PageRank
+// for a description of the method and of how sinks are handled.
+
+// If r0 is NULL, the iterations start from the uniform vector r = 1/n.
+// Otherwise, they start from r0, typecasted to the type of r, with zeros
+// where r0 has no entry, and scaled so that it sums to 1.
+
+// type is the type of the vectors d, r, t, and w, and of the product AT*w:
+// GrB_FP32 or GrB_FP64.  If sum_fp64 is true, the sum of the rank of the
+// sinks and the sum of abs (t-r) (for the stopping rule) are done in double
+// precision; otherwise they are done in the precision of type.  centrality
+// is returned with the given type.
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&d1) ;                \
+    GrB_free (&d) ;                 \
+    GrB_free (&t) ;                 \
+    GrB_free (&w) ;                 \
+    GrB_free (&sink) ;              \
+    GrB_free (&rsink) ;             \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (&r) ;                 \
+}
+
+#include "LG_internal.h"
+
+int LG_PageRank
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Vector r0,    // initial rank vector, or NULL for r = 1/n
+    GrB_Type type,          // GrB_FP32 or GrB_FP64
+    bool sum_fp64,          // if true, sums are done in double precision
+    double damping,         // damping factor (typically 0.85)
+    double tol,             // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector r = NULL, d = NULL, t = NULL, w = NULL, d1 = NULL ;
+    GrB_Vector sink = NULL, rsink = NULL ;
+    LG_ASSERT (centrality != NULL && iters != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (type == GrB_FP32 || type == GrB_FP64, GrB_INVALID_VALUE,
+        "type must be GrB_FP32 or GrB_FP64") ;
+    GrB_Matrix AT ;
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+        G->is_symmetric_structure == LAGraph_TRUE)
+    {
+        // A and A' have the same structure
+        AT = G->A ;
+    }
+    else
+    {
+        // A and A' differ
+        AT = G->AT ;
+        LG_ASSERT_MSG (AT != NULL, LAGRAPH_NOT_CACHED, "G->AT is required") ;
+    }
+    GrB_Vector d_out = G->out_degree ;
+    LG_ASSERT_MSG (d_out != NULL,
+        LAGRAPH_NOT_CACHED, "G->out_degree is required") ;
+
+    //--------------------------------------------------------------------------
+    // select the operators
+    //--------------------------------------------------------------------------
+
+    bool fp64 = (type == GrB_FP64) ;
+    GrB_BinaryOp div_op   = fp64 ? GrB_DIV_FP64   : GrB_DIV_FP32 ;
+    GrB_BinaryOp max_op   = fp64 ? GrB_MAX_FP64   : GrB_MAX_FP32 ;
+    GrB_BinaryOp plus_op  = fp64 ? GrB_PLUS_FP64  : GrB_PLUS_FP32 ;
+    GrB_BinaryOp minus_op = fp64 ? GrB_MINUS_FP64 : GrB_MINUS_FP32 ;
+    GrB_UnaryOp  abs_op   = fp64 ? GrB_ABS_FP64   : GrB_ABS_FP32 ;
+    GrB_Semiring semiring = fp64 ?
+        LAGraph_plus_second_fp64 : LAGraph_plus_second_fp32 ;
+    GrB_Monoid sum_monoid = (fp64 || sum_fp64) ?
+        GrB_PLUS_MONOID_FP64 : GrB_PLUS_MONOID_FP32 ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, AT)) ;
+
+    const double damping_over_n = damping / n ;
+    const double scaled_damping = (1 - damping) / n ;
+    double rdiff = 1 ;      // first iteration is always done
+
+    GRB_TRY (GrB_Vector_new (&t, type, n)) ;
+    GRB_TRY (GrB_Vector_new (&r, type, n)) ;
+    GRB_TRY (GrB_Vector_new (&w, type, n)) ;
+    if (r0 == NULL)
+    {
+        // r = 1 / n
+        GRB_TRY (GrB_assign (r, NULL, NULL, 1.0 / n, GrB_ALL, n, NULL)) ;
+    }
+    else
+    {
+        // r = r0 / sum (r0), with zeros where r0 has no entry
+        GrB_Index n0 ;
+        GRB_TRY (GrB_Vector_size (&n0, r0)) ;
+        LG_ASSERT_MSG (n0 == n, GrB_DIMENSION_MISMATCH,
+            "r0 must have size n") ;
+        GRB_TRY (GrB_assign (r, NULL, NULL, (double) 0, GrB_ALL, n, NULL)) ;
+        GRB_TRY (GrB_assign (r, NULL, plus_op, r0, GrB_ALL, n, NULL)) ;
+        double rsum = 0 ;
+        GRB_TRY (GrB_reduce (&rsum, NULL, sum_monoid, r, NULL)) ;
+        LG_ASSERT_MSG (rsum > 0, GrB_INVALID_VALUE,
+            "r0 must have a positive sum") ;
+        GRB_TRY (GrB_apply (r, NULL, NULL, div_op, r, rsum, NULL)) ;
+    }
+
+    // find all sinks, where sink(i) = true if node i has d_out(i)=0, or with
+    // d_out(i) not present.  LAGraph_Cached_OutDegree computes d_out =
+    // G->out_degree so that it has no explicit zeros, so a structural mask can
+    // be used here.
+    GrB_Index nsinks, nvals ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, d_out)) ;
+    nsinks = n - nvals ;
+    if (nsinks > 0)
+    {
+        // sink<!struct(d_out)> = true
+        GRB_TRY (GrB_Vector_new (&sink, GrB_BOOL, n)) ;
+        GRB_TRY (GrB_assign (sink, d_out, NULL, (bool) true, GrB_ALL, n,
+            GrB_DESC_SC)) ;
+        GRB_TRY (GrB_Vector_new (&rsink, type, n)) ;
+    }
+
+    // prescale with damping factor, so it isn't done each iteration
+    // d = d_out / damping ;
+    GRB_TRY (GrB_Vector_new (&d, type, n)) ;
+    GRB_TRY (GrB_apply (d, NULL, NULL, div_op, d_out, damping, NULL)) ;
+
+    // d1 = 1 / damping
+    double dmin = 1.0 / damping ;
+    GRB_TRY (GrB_Vector_new (&d1, type, n)) ;
+    GRB_TRY (GrB_assign (d1, NULL, NULL, dmin, GrB_ALL, n, NULL)) ;
+    // d = max (d1, d)
+    GRB_TRY (GrB_eWiseAdd (d, NULL, NULL, max_op, d1, d, NULL)) ;
+    GrB_free (&d1) ;
+
+    //--------------------------------------------------------------------------
+    // pagerank iterations
+    //--------------------------------------------------------------------------
+
+    for ((*iters) = 0 ; rdiff > tol ; (*iters)++)
+    {
+        // check for convergence
+        LG_ASSERT_MSGF ((*iters) < itermax, LAGRAPH_CONVERGENCE_FAILURE,
+            "pagerank failed to converge in %d iterations", itermax) ;
+        // determine teleport and handle any sinks
+        double teleport = scaled_damping ; // teleport = (1 - damping) / n
+        if (nsinks > 0)
+        {
+            // handle the sinks: teleport += (damping/n) * sum (r (sink))
+            // rsink<struct(sink)> = r
+            GRB_TRY (GrB_Vector_clear (rsink)) ;
+            GRB_TRY (GrB_assign (rsink, sink, NULL, r, GrB_ALL, n, GrB_DESC_S));
+            // sum_rsink = sum (rsink)
+            double sum_rsink = 0 ;
+            GRB_TRY (GrB_reduce (&sum_rsink, NULL, sum_monoid, rsink, NULL)) ;
+            teleport += damping_over_n * sum_rsink ;
+        }
+        // swap t and r ; now t is the old score
+        GrB_Vector temp = t ; t = r ; r = temp ;
+        // w = t ./ d
+        GRB_TRY (GrB_eWiseMult (w, NULL, NULL, div_op, t, d, NULL)) ;
+        // r = teleport
+        GRB_TRY (GrB_assign (r, NULL, NULL, teleport, GrB_ALL, n, NULL)) ;
+        // r += A'*w
+        GRB_TRY (GrB_mxv (r, NULL, plus_op, semiring, AT, w, NULL)) ;
+        // t -= r
+        GRB_TRY (GrB_assign (t, NULL, minus_op, r, GrB_ALL, n, NULL)) ;
+        // t = abs (t)
+        GRB_TRY (GrB_apply (t, NULL, NULL, abs_op, t, NULL)) ;
+        // rdiff = sum (t)
+        GRB_TRY (GrB_reduce (&rdiff, NULL, sum_monoid, t, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*centrality) = r ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,277 @@
+//------------------------------------------------------------------------------
+// LG_TriangleCount_Merge: count triangles by direct set intersection
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+// LG_TriangleCount_Merge computes ntri = sum (sum ((L * L') .* L)), the same
+// result as the Sandia_LUT method, where L is the strictly lower triangular
+// part of a symmetric matrix.  Instead of computing the masked product C and
+// then reducing it, L is unpacked in CSR form (with sorted rows) and each
+// entry L(u,v) counts the nodes w < v in both L(u,:) and L(v,:) directly.
+// The entries of L(u,:) before v are exactly those less than v, so only that
+// prefix of L(u,:) is intersected with L(v,:).  No n-by-n matrix is created.
+
+// For each edge, the intersection method depends on the lengths a and b of
+// the two lists:
+
+//  (1) if one list is more than LG_TC_RATIO times longer than the other: each
+//      entry of the shorter list is found in the longer one by a galloping
+//      (exponential, then binary) search, starting where the last one ended.
+//  (2) otherwise: the two sorted lists are merged in blocks of 4 entries.
+//      All 16 pairs of a block of each list are compared, with no
+//      data-dependent branches, and then the block with the smaller last
+//      entry is skipped (or both, if their last entries are equal).  Any
+//      entries left over are merged one at a time.
+
+// The rows of L are split among the threads so that each has about the same
+// number of entries, and each thread has its own count.  No other workspace
+// is needed.
+
+// L is unpacked and then packed back, so it is modified (but restored) while
+// this method runs.  It requires SuiteSparse:GraphBLAS; LAGr_TriangleCount
+// uses the Sandia_LUT method instead if it is not in use.
+
+#define LG_FREE_WORK                                                        \
+{                                                                           \
+    LAGraph_Free ((void **) &Count, NULL) ;                                 \
+    LAGraph_Free ((void **) &Rows, NULL) ;                                  \
+    if (Lp != NULL)                                                         \
+    {                                                                       \
+        /* pack L back */                                                   \
+        GxB_Matrix_pack_CSR (L, &Lp, &Lj, &Lx, Lp_size, Lj_size, Lx_size,   \
+            L_iso, false, NULL) ;                                           \
+    }                                                                       \
+}
+
+#define LG_FREE_ALL LG_FREE_WORK
+
+#include "LG_alg_internal.h"
+
+// method (1) is used if one list is this many times longer than the other
+#define LG_TC_RATIO 32
+
+//------------------------------------------------------------------------------
+// LG_gallop: find the first entry >= w in a sorted list
+//------------------------------------------------------------------------------
+
+// Returns the first position p in X [lo:hi-1] with X [p] >= w, or hi if there
+// is none.  The steps from lo double in size until an entry >= w is found,
+// and then a binary search finishes within the last step, so the cost is
+// O(log (p-lo)) rather than O(log (hi-lo)).
+
+static inline int64_t LG_gallop
+(
+    const GrB_Index *restrict X,
+    int64_t lo,
+    int64_t hi,
+    GrB_Index w
+)
+{
+    int64_t p = lo, step = 1 ;
+    while (p < hi && X [p] < w)
+    {
+        lo = p + 1 ;
+        p += step ;
+        step <<= 1 ;
+    }
+    hi = LAGRAPH_MIN (p, hi) ;
+    while (lo < hi)
+    {
+        int64_t mid = (lo + hi) / 2 ;
+        if (X [mid] < w)
+        {
+            lo = mid + 1 ;
+        }
+        else
+        {
+            hi = mid ;
+        }
+    }
+    return (lo) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_TriangleCount_Merge
+//------------------------------------------------------------------------------
+
+int LG_TriangleCount_Merge
+(
+    // output:
+    int64_t *ntriangles,    // # of triangles
+    // input:
+    GrB_Matrix L,           // L = tril (A,-1), modified then restored
+    char *msg
+)
+{
+
+#if !LAGRAPH_SUITESPARSE
+    return (GrB_NOT_IMPLEMENTED) ;
+#else
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    int64_t *Count = NULL, *Rows = NULL ;
+    GrB_Index *Lp = NULL, *Lj = NULL, Lp_size, Lj_size, Lx_size ;
+    void *Lx = NULL ;
+    bool L_iso = false ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, L)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = LAGRAPH_MAX (nthreads_outer * nthreads_inner, 1) ;
+    GrB_Index nvals ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, L)) ;
+    nthreads = (int) LAGRAPH_MIN (nthreads, 1 + nvals / 4096) ;
+
+    LG_TRY (LAGraph_Calloc ((void **) &Count, nthreads, sizeof (int64_t),
+        msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Rows, nthreads + 1, sizeof (int64_t),
+        msg)) ;
+
+    //--------------------------------------------------------------------------
+    // unpack L in CSR format, with sorted rows
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GxB_Matrix_unpack_CSR (L, &Lp, &Lj, &Lx, &Lp_size, &Lj_size,
+        &Lx_size, &L_iso, NULL, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // split the rows so each thread has about the same number of entries
+    //--------------------------------------------------------------------------
+
+    Rows [0] = 0 ;
+    for (int tid = 1 ; tid < nthreads ; tid++)
+    {
+        // Rows [tid] = first row u with Lp [u] >= tid*nvals/nthreads
+        int64_t target = (int64_t) LG_PART (tid, nvals, nthreads) ;
+        int64_t lo = Rows [tid-1], hi = n ;
+        while (lo < hi)
+        {
+            int64_t mid = (lo + hi) / 2 ;
+            if ((int64_t) Lp [mid] < target)
+            {
+                lo = mid + 1 ;
+            }
+            else
+            {
+                hi = mid ;
+            }
+        }
+        Rows [tid] = lo ;
+    }
+    Rows [nthreads] = n ;
+
+    //--------------------------------------------------------------------------
+    // count the triangles
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t ntri = 0 ;
+        for (int64_t u = Rows [tid] ; u < Rows [tid+1] ; u++)
+        {
+            const int64_t pu_start = Lp [u] ;
+            for (int64_t p = pu_start ; p < (int64_t) Lp [u+1] ; p++)
+            {
+                // ntri += number of entries in L(u,0:v-1) and L(v,:)
+                const int64_t v = Lj [p] ;
+                const int64_t pv_start = Lp [v] ;
+                const int64_t pv_end = Lp [v+1] ;
+                const int64_t a = p - pu_start ;
+                const int64_t b = pv_end - pv_start ;
+                if (a == 0 || b == 0) continue ;
+
+                if (a > LG_TC_RATIO * b || b > LG_TC_RATIO * a)
+                {
+                    // (1) find each entry of the shorter list in the longer
+                    int64_t ps, ps_end, pl, pl_end ;
+                    if (a < b)
+                    {
+                        ps = pu_start ; ps_end = p ;
+                        pl = pv_start ; pl_end = pv_end ;
+                    }
+                    else
+                    {
+                        ps = pv_start ; ps_end = pv_end ;
+                        pl = pu_start ; pl_end = p ;
+                    }
+                    for ( ; ps < ps_end ; ps++)
+                    {
+                        const GrB_Index w = Lj [ps] ;
+                        pl = LG_gallop (Lj, pl, pl_end, w) ;
+                        if (pl == pl_end) break ;
+                        ntri += (Lj [pl] == w) ;
+                    }
+                }
+                else
+                {
+                    // (2) merge L(u,0:v-1) and L(v,:), 4 entries at a time
+                    int64_t pa = pu_start, pb = pv_start ;
+                    while (pa + 4 <= p && pb + 4 <= pv_end)
+                    {
+                        const GrB_Index *restrict A4 = Lj + pa ;
+                        const GrB_Index *restrict B4 = Lj + pb ;
+                        int64_t c = 0 ;
+                        for (int i = 0 ; i < 4 ; i++)
+                        {
+                            for (int j = 0 ; j < 4 ; j++)
+                            {
+                                c += (A4 [i] == B4 [j]) ;
+                            }
+                        }
+                        ntri += c ;
+                        const GrB_Index amax = A4 [3] ;
+                        const GrB_Index bmax = B4 [3] ;
+                        pa += 4 * (amax <= bmax) ;
+                        pb += 4 * (bmax <= amax) ;
+                    }
+                    // merge the rest of the two lists
+                    while (pa < p && pb < pv_end)
+                    {
+                        const int64_t ia = Lj [pa] ;
+                        const int64_t ib = Lj [pb] ;
+                        ntri += (ia == ib) ;
+                        pa += (ia <= ib) ;
+                        pb += (ib <= ia) ;
+                    }
+                }
+            }
+        }
+        Count [tid] = ntri ;
+    }
+
+    // sum up the counts of each thread
+    int64_t ntri = 0 ;
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        ntri += Count [tid] ;
+    }
+    (*ntriangles) = ntri ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+#endif
+}
@@ -0,0 +1,392 @@
+//------------------------------------------------------------------------------
+// LG_TriangleCount_Select: select the method and presort for triangle counting
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+// Contributed by Timothy A. Davis, Texas A&M University
+
+//------------------------------------------------------------------------------
+
+// LG_TriangleCount_Select checks the graph and the method and presort
+// parameters for LAGr_TriangleCount, LAGr_TriangleCount_PerVertex, and
+// LAGr_TriangleCount_PerEdge.  On output, the AutoMethod and AutoSort choices
+// have been replaced with the method and presort to use.
+
+// If the method is AutoMethod and G->out_degree is present, the method and
+// presort are chosen together with a cost model (see tricount_cost below).
+// Only the Sandia_LL (saxpy) and Sandia_LUT (dot product) methods are
+// considered, or Sandia_UU and Sandia_ULT if the presort is Descending.  If
+// G->out_degree is not present, the AutoMethod is Sandia_LUT.
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&E) ;                                 \
+    GrB_free (&W) ;                                 \
+    GrB_free (&WD) ;                                \
+    LAGraph_Free ((void **) &Nodes, NULL) ;         \
+    LAGraph_Free ((void **) &Nbr, NULL) ;           \
+    LAGraph_Free ((void **) &Nbr_degree, NULL) ;    \
+    LAGraph_Free ((void **) &Sample_degree, NULL) ; \
+}
+
+#define LG_FREE_ALL LG_FREE_WORK
+
+#include "LG_alg_internal.h"
+
+// relative cost of one multiply-add of a saxpy-based method, as compared to
+// one step of a merge in a dot product
+#define LG_TC_SAXPY_COST 1.5
+
+//------------------------------------------------------------------------------
+// tricount_merge: estimated cost of a dot product of two sorted lists
+//------------------------------------------------------------------------------
+
+// The lists are merged if their lengths a and b are similar.  Otherwise, each
+// entry of the shorter list is found in the longer one by binary search.
+
+static inline double tricount_merge (double a, double b)
+{
+    double amin = LAGRAPH_MIN (a, b) ;
+    double amax = LAGRAPH_MAX (a, b) ;
+    return (LAGRAPH_MIN (a + b, amin * (1 + log2 (1 + amax)))) ;
+}
+
+int LG_TriangleCount_Select
+(
+    // input/output:
+    LAGr_TriangleCount_Method *p_method,    // method to use
+    LAGr_TriangleCount_Presort *p_presort,  // presort to use
+    // input:
+    const LAGraph_Graph G,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Vector E = NULL, W = NULL, WD = NULL ;
+    int64_t *Nodes = NULL, *Nbr_degree = NULL, *Sample_degree = NULL ;
+    GrB_Index *Nbr = NULL ;
+
+    LAGr_TriangleCount_Method method = (*p_method) ;
+    LG_ASSERT_MSG (
+    method == LAGr_TriangleCount_AutoMethod ||  // 0: use auto method
+    method == LAGr_TriangleCount_Burkhardt  ||  // 1: sum (sum ((A^2) .* A))/6
+    method == LAGr_TriangleCount_Cohen      ||  // 2: sum (sum ((L * U) .*A))/2
+    method == LAGr_TriangleCount_Sandia_LL  ||  // 3: sum (sum ((L * L) .* L))
+    method == LAGr_TriangleCount_Sandia_UU  ||  // 4: sum (sum ((U * U) .* U))
+    method == LAGr_TriangleCount_Sandia_LUT ||  // 5: sum (sum ((L * U') .* L))
+    method == LAGr_TriangleCount_Sandia_ULT ||  // 6: sum (sum ((U * L') .* U))
+    method == LAGr_TriangleCount_Merge,         // 7: sum (sum ((L * L') .* L))
+    GrB_INVALID_VALUE, "method is invalid") ;
+
+    LAGr_TriangleCount_Presort presort = (*p_presort) ;
+    LG_ASSERT_MSG (
+    presort == LAGr_TriangleCount_NoSort     ||
+    presort == LAGr_TriangleCount_Ascending  ||
+    presort == LAGr_TriangleCount_Descending ||
+    presort == LAGr_TriangleCount_AutoSort,
+    GrB_INVALID_VALUE, "presort is invalid") ;
+
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (G->nself_edges == 0, LAGRAPH_NO_SELF_EDGES_ALLOWED) ;
+
+    LG_ASSERT_MSG ((G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE)),
+        LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED,
+        "G->A must be known to be symmetric") ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Vector Degree = G->out_degree ;
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+
+    if (method == LAGr_TriangleCount_AutoMethod && (Degree == NULL || n == 0))
+    {
+        // AutoMethod: use default, Sandia_LUT: sum (sum ((L * U') .* L))
+        method = LAGr_TriangleCount_Sandia_LUT ;
+    }
+    else if (method == LAGr_TriangleCount_AutoMethod)
+    {
+
+        //----------------------------------------------------------------------
+        // cost model for the Sandia_LL and Sandia_LUT methods
+        //----------------------------------------------------------------------
+
+        // The work of both methods is a sum over the entries L(v,j) of L,
+        // where j comes before v in the node ordering.  The saxpy-based
+        // Sandia_LL method scans all of L(j,:) for each L(v,j), and the
+        // dot-product-based Sandia_LUT method intersects L(v,:) with L(j,:).
+        // Let l(v) = |L(v,:)|, the number of neighbors of v that come before
+        // it.  Summed over all v, the saxpy work is the number of wedges
+        // i-j-k with i,k before j, and the dot product work is the merge
+        // cost of l(v) and l(j), for each entry L(v,j).
+
+        // Up to NSAMPLES nodes v are sampled at random (or all of them, if n
+        // is small), and row A(v,:) is extracted to find l(v) exactly.  The
+        // length l(j) of each neighbor j is estimated from its degree d(j):
+        // with no sort, l(j) is about d(j)*j/n; with an ascending sort, it is
+        // about d(j)*F(d(j)), where F(d) is the fraction of sampled nodes with
+        // degree less than d.
+
+        // Both orderings are considered (unless presort is NoSort, Ascending,
+        // or Descending), and an ascending sort is charged for sorting the
+        // degrees and permuting A.  Constructing U for Sandia_LUT is charged
+        // as well, so the saxpy method is preferred for small graphs, for
+        // which the cost of constructing L and U dominates.  The descending
+        // sort with U (Sandia_UU and Sandia_ULT) mirrors the ascending sort
+        // with L, so it has the same cost.
+
+        #define NSAMPLES 1000
+        int64_t dmax = 0 ;
+        GRB_TRY (GrB_reduce (&dmax, NULL, GrB_MAX_MONOID_INT64, Degree,
+            NULL)) ;
+        int64_t nsamples = LAGRAPH_MIN (n, NSAMPLES) ;
+        dmax = LAGRAPH_MAX (dmax, 1) ;
+
+        LG_TRY (LAGraph_Malloc ((void **) &Nodes, nsamples, sizeof (int64_t),
+            msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Sample_degree, nsamples,
+            sizeof (int64_t), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Nbr, dmax, sizeof (GrB_Index),
+            msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Nbr_degree, dmax, sizeof (int64_t),
+            msg)) ;
+        GRB_TRY (GrB_Vector_new (&E, GrB_BOOL, n)) ;
+        GRB_TRY (GrB_Vector_new (&W, GrB_BOOL, n)) ;
+        GRB_TRY (GrB_Vector_new (&WD, GrB_INT64, n)) ;
+
+        // pick the sample nodes, and find their degrees
+        uint64_t seed = n ;
+        for (int64_t k = 0 ; k < nsamples ; k++)
+        {
+            int64_t v = (n <= NSAMPLES) ? k : (LG_Random60 (&seed) % n) ;
+            int64_t d = 0 ;
+            GRB_TRY (GrB_Vector_extractElement (&d, Degree, v)) ;
+            Nodes [k] = v ;
+            Sample_degree [k] = d ;
+        }
+        LG_qsort_1a (Sample_degree, nsamples) ;
+
+        // cost [0]: no sort, cost [1]: ascending sort
+        double saxpy [2] = { 0, 0 }, dot [2] = { 0, 0 } ;
+        for (int64_t k = 0 ; k < nsamples ; k++)
+        {
+            // get the neighbors of v and their degrees
+            int64_t v = Nodes [k] ;
+            int64_t dv = 0 ;
+            GRB_TRY (GrB_Vector_extractElement (&dv, Degree, v)) ;
+            if (dv == 0) continue ;
+            // W = pattern of A(v,:), computed as W = E'*A where E = e_v.
+            // The any_one semiring ignores the values of A, so this works
+            // for any type of A, including user-defined types.
+            GRB_TRY (GrB_Vector_setElement (E, (bool) true, v)) ;
+            GRB_TRY (GrB_vxm (W, NULL, NULL, LAGraph_any_one_bool, E, A,
+                NULL)) ;
+            GRB_TRY (GrB_Vector_removeElement (E, v)) ;
+            GRB_TRY (GrB_eWiseMult (WD, NULL, NULL, GrB_SECOND_INT64, W,
+                Degree, NULL)) ;
+            GrB_Index nnbr = dmax ;
+            GRB_TRY (GrB_Vector_extractTuples_INT64 (Nbr, Nbr_degree, &nnbr,
+                WD)) ;
+
+            // l [0] and l [1]: # of neighbors of v that come before it
+            int64_t l [2] = { 0, 0 } ;
+            for (int64_t p = 0 ; p < (int64_t) nnbr ; p++)
+            {
+                int64_t j = Nbr [p], dj = Nbr_degree [p] ;
+                l [0] += (j < v) ;
+                l [1] += (dj < dv || (dj == dv && j < v)) ;
+            }
+
+            // add the work for each entry L(v,j)
+            for (int64_t p = 0 ; p < (int64_t) nnbr ; p++)
+            {
+                int64_t j = Nbr [p], dj = Nbr_degree [p] ;
+                if (j < v)
+                {
+                    // estimate l(j) with no sort
+                    double lj = ((double) dj) * ((double) j) / ((double) n) ;
+                    lj = LAGRAPH_MIN (lj, (double) j) ;
+                    saxpy [0] += lj ;
+                    dot [0] += tricount_merge ((double) l [0], lj) ;
+                }
+                if (dj < dv || (dj == dv && j < v))
+                {
+                    // estimate l(j) with an ascending sort, from the
+                    // fraction of sampled nodes with degree less than dj
+                    int64_t lo = 0, hi = nsamples ;
+                    while (lo < hi)
+                    {
+                        int64_t mid = (lo + hi) / 2 ;
+                        if (Sample_degree [mid] < dj)
+                        {
+                            lo = mid + 1 ;
+                        }
+                        else
+                        {
+                            hi = mid ;
+                        }
+                    }
+                    double lj = ((double) dj) * ((double) lo) / nsamples ;
+                    saxpy [1] += lj ;
+                    dot [1] += tricount_merge ((double) l [1], lj) ;
+                }
+            }
+        }
+
+        // choose the ordering and method with the least estimated cost
+        double scale = ((double) n) / nsamples ;
+        double sort_cost = ((double) n) * log2 ((double) n + 1) + nvals ;
+        int ofirst = (presort == LAGr_TriangleCount_NoSort ||
+                      presort == LAGr_TriangleCount_AutoSort) ? 0 : 1 ;
+        int olast  = (presort == LAGr_TriangleCount_NoSort) ? 0 : 1 ;
+        double best = INFINITY ;
+        bool use_saxpy = false ;
+        int order = ofirst ;
+        for (int o = ofirst ; o <= olast ; o++)
+        {
+            double extra = (o == 1 && presort == LAGr_TriangleCount_AutoSort)
+                ? sort_cost : 0 ;
+            // Sandia_LL constructs L; Sandia_LUT constructs L and U
+            double cost_saxpy = LG_TC_SAXPY_COST * scale * saxpy [o]
+                + ((double) nvals) / 2 + extra ;
+            double cost_dot = scale * dot [o] + ((double) nvals) + extra ;
+            if (cost_saxpy < best)
+            {
+                best = cost_saxpy ;
+                use_saxpy = true ;
+                order = o ;
+            }
+            if (cost_dot < best)
+            {
+                best = cost_dot ;
+                use_saxpy = false ;
+                order = o ;
+            }
+        }
+
+        if (order == 0)
+        {
+            presort = LAGr_TriangleCount_NoSort ;
+        }
+        else if (presort != LAGr_TriangleCount_Descending)
+        {
+            presort = LAGr_TriangleCount_Ascending ;
+        }
+        if (presort == LAGr_TriangleCount_Descending)
+        {
+            method = use_saxpy ? LAGr_TriangleCount_Sandia_UU :
+                LAGr_TriangleCount_Sandia_ULT ;
+        }
+        else
+        {
+            method = use_saxpy ? LAGr_TriangleCount_Sandia_LL :
+                LAGr_TriangleCount_Sandia_LUT ;
+        }
+        LG_FREE_WORK ;
+    }
+
+    // only the Sandia_* and Merge methods can benefit from the presort
+    bool method_can_use_presort =
+    method == LAGr_TriangleCount_Sandia_LL || // sum (sum ((L * L) .* L))
+    method == LAGr_TriangleCount_Sandia_UU || // sum (sum ((U * U) .* U))
+    method == LAGr_TriangleCount_Sandia_LUT || // sum (sum ((L * U') .* L))
+    method == LAGr_TriangleCount_Sandia_ULT || // sum (sum ((U * L') .* U))
+    method == LAGr_TriangleCount_Merge ;      // sum (sum ((L * L') .* L))
+
+    bool auto_sort = (presort == LAGr_TriangleCount_AutoSort) ;
+    if (auto_sort && method_can_use_presort)
+    {
+        LG_ASSERT_MSG (Degree != NULL,
+            LAGRAPH_NOT_CACHED, "G->out_degree is required") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // heuristic sort rule
+    //--------------------------------------------------------------------------
+
+    if (!method_can_use_presort)
+    {
+        // no sorting for the Burkhardt and Cohen methods: presort parameter
+        // is ignored.
+        presort = LAGr_TriangleCount_NoSort ;
+    }
+    else if (auto_sort)
+    {
+        // auto selection of sorting method for Sandia_* methods
+        presort = LAGr_TriangleCount_NoSort ; // default is not to sort
+
+        if (method_can_use_presort)
+        {
+            // This rule is very similar to Scott Beamer's rule in the GAP TC
+            // benchmark, except that it is extended to handle the ascending
+            // sort needed by methods 3 and 5.  It also uses a stricter rule,
+            // since the performance of triangle counting in SuiteSparse:
+            // GraphBLAS is less sensitive to the sorting as compared to the
+            // GAP algorithm.  This is because the dot products in SuiteSparse:
+            // GraphBLAS use binary search if one vector is very sparse
+            // compared to the other.  As a result, SuiteSparse:GraphBLAS needs
+            // the sort for fewer matrices, as compared to the GAP algorithm.
+
+            // With this rule, the GAP-kron and GAP-twitter matrices are
+            // sorted, and the others remain unsorted.  With the rule in the
+            // GAP tc.cc benchmark, GAP-kron and GAP-twitter are sorted, and so
+            // is GAP-web, but GAP-web is not sorted here.
+
+            if (n > NSAMPLES && ((double) nvals / ((double) n)) >= 10)
+            {
+                // estimate the mean and median degrees
+                double mean, median ;
+                LG_TRY (LAGr_SampleDegree (&mean, &median,
+                    G, true, NSAMPLES, n, msg)) ;
+                // sort if the average degree is very high vs the median
+                if (mean > 4 * median)
+                {
+                    switch (method)
+                    {
+                        case LAGr_TriangleCount_Sandia_LL:
+                            // 3:sum (sum ((L * L) .* L))
+                            presort = LAGr_TriangleCount_Ascending  ;
+                            break ;
+                        case LAGr_TriangleCount_Sandia_UU:
+                            // 4: sum (sum ((U * U) .* U))
+                            presort = LAGr_TriangleCount_Descending ;
+                            break ;
+                        default:
+                        case LAGr_TriangleCount_Sandia_LUT:
+                            // 5: sum (sum ((L * U') .* L))
+                        case LAGr_TriangleCount_Merge:
+                            // 7: sum (sum ((L * L') .* L))
+                            presort = LAGr_TriangleCount_Ascending  ;
+                            break ;
+                        case LAGr_TriangleCount_Sandia_ULT:
+                            // 6: sum (sum ((U * L') .* U))
+                            presort = LAGr_TriangleCount_Descending ;
+                            break ;
+                    }
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*p_method) = method ;
+    (*p_presort) = presort ;
+    return (GrB_SUCCESS) ;
+}
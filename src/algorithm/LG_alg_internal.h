@@ -54,6 +54,15 @@ int LG_CC_FastSV6           // SuiteSparse:GraphBLAS method, with GxB extensions
     char *msg
 ) ;
 
+int LG_CC_Afforest          // SuiteSparse:GraphBLAS method, with GxB extensions
+(
+    // output:
+    GrB_Vector *component,  // output: array of component identifiers
+    // input:
+    LAGraph_Graph G,        // input graph (modified then restored)
+    char *msg
+) ;
+
 int LG_CC_Boruvka
 (
     // output:
@@ -63,4 +72,23 @@ int LG_CC_Boruvka
     char *msg
 ) ;
 
+int LG_TriangleCount_Merge
+(
+    // output:
+    int64_t *ntriangles,    // # of triangles
+    // input:
+    GrB_Matrix L,           // L = tril (A,-1), modified then restored
+    char *msg
+) ;
+
+int LG_TriangleCount_Select
+(
+    // input/output:
+    LAGr_TriangleCount_Method *p_method,    // method to use
+    LAGr_TriangleCount_Presort *p_presort,  // presort to use
+    // input:
+    const LAGraph_Graph G,
+    char *msg
+) ;
+
 #endif
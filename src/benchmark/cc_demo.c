@@ -162,6 +162,39 @@ int main (int argc, char **argv)
             LAGRAPH_TRY (LAGr_ConnectedComponents (&components2, G, msg)) ;
             ttrial = LAGraph_WallClockTime ( ) - ttrial ;
             ttt += ttrial ;
+            printf ("Afforest: nthreads: %2d trial: %2d time: %10.4f sec\n",
+                nthreads, k, ttrial) ;
+            GrB_Index nCC2 = countCC (components2, n) ;
+            if (nCC != nCC2) printf ("failure! %g %g diff %g\n",
+                (double) nCC, (double) nCC2, (double) (nCC-nCC2)) ;
+        }
+        ttt = ttt / ntrials ;
+        printf ("Afforest: nthreads: %2d Avg: time: %10.4f sec ntrials %d\n\n",
+                nthreads, ttt, ntrials) ;
+        fprintf (stderr,
+                "Afforest: nthreads: %2d Avg: time: %10.4f sec ntrials %d\n",
+                nthreads, ttt, ntrials) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // LG_CC_FastSV6
+    //--------------------------------------------------------------------------
+
+#if LAGRAPH_SUITESPARSE
+    for (int trial = 1 ; trial <= nt ; trial++)
+    {
+        int nthreads = Nthreads [trial] ;
+        if (nthreads > nthreads_max) continue ;
+        LAGRAPH_TRY (LAGraph_SetNumThreads (1, nthreads, NULL)) ;
+        double ttt = 0 ;
+        int ntrials = NTRIALS ;
+        for (int k = 0 ; k < ntrials ; k++)
+        {
+            GrB_free (&components2) ;
+            double ttrial = LAGraph_WallClockTime ( ) ;
+            LAGRAPH_TRY (LG_CC_FastSV6 (&components2, G, msg)) ;
+            ttrial = LAGraph_WallClockTime ( ) - ttrial ;
+            ttt += ttrial ;
             printf ("SV6:      nthreads: %2d trial: %2d time: %10.4f sec\n",
                 nthreads, k, ttrial) ;
             GrB_Index nCC2 = countCC (components2, n) ;
@@ -175,6 +208,7 @@ int main (int argc, char **argv)
                 "SV6:      nthreads: %2d Avg: time: %10.4f sec ntrials %d\n",
                 nthreads, ttt, ntrials) ;
     }
+#endif
 
     //--------------------------------------------------------------------------
     // 7: draft version
@@ -0,0 +1,301 @@
+//----------------------------------------------------------------------------
+// LAGraph/src/test/test_BellmanFord.c: test cases for LAGr_BellmanFord
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraph_test.h>
+#include "LG_internal.h"
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector path_length = NULL, parent = NULL, hops = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "A.mtx",
+    "cover.mtx",
+    "jagmesh7.mtx",
+    "ldbc-directed-example.mtx",
+    "ldbc-undirected-example.mtx",
+    "LFAT5.mtx",
+    "msf1.mtx",
+    "msf2.mtx",
+    "sample.mtx",
+    "tree-example.mtx",
+    "west0067.mtx",
+    "karate.mtx",
+    "test_BF.mtx",
+    "test_FW_1000.mtx",
+    ""
+} ;
+
+//------------------------------------------------------------------------------
+// check_bf: check the result with a simple Bellman-Ford method
+//------------------------------------------------------------------------------
+
+// The reference solution finds the shortest paths with the fewest hops, by
+// relaxing all edges until no (dist, hops) pair decreases, or reports a
+// negative cycle if one still decreases after n passes.
+
+void check_bf (int result, GrB_Index src)
+{
+    GrB_Index n, nvals ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+    OK (GrB_Matrix_nvals (&nvals, G->A)) ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL, *dist = NULL ;
+    int64_t *hop = NULL ;
+    OK (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+    OK (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+    OK (LAGraph_Malloc ((void **) &X, nvals, sizeof (double), msg)) ;
+    OK (LAGraph_Malloc ((void **) &dist, n, sizeof (double), msg)) ;
+    OK (LAGraph_Malloc ((void **) &hop, n, sizeof (int64_t), msg)) ;
+    OK (GrB_Matrix_extractTuples_FP64 (I, J, X, &nvals, G->A)) ;
+
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        dist [i] = INFINITY ;
+        hop [i] = INT64_MAX ;
+    }
+    dist [src] = 0 ;
+    hop [src] = 0 ;
+    bool changed = true ;
+    for (int64_t pass = 0 ; pass < n && changed ; pass++)
+    {
+        changed = false ;
+        for (int64_t k = 0 ; k < nvals ; k++)
+        {
+            int64_t i = I [k], j = J [k] ;
+            if (hop [i] == INT64_MAX) continue ;
+            double t = dist [i] + X [k] ;
+            int64_t h = hop [i] + 1 ;
+            if (t < dist [j] || (t == dist [j] && h < hop [j]))
+            {
+                dist [j] = t ;
+                hop [j] = h ;
+                changed = true ;
+            }
+        }
+    }
+
+    if (changed)
+    {
+        // a negative cycle is reachable from the source
+        TEST_CHECK (result == LAGRAPH_NEGATIVE_CYCLE) ;
+        TEST_CHECK (path_length == NULL && parent == NULL && hops == NULL) ;
+    }
+    else
+    {
+        OK (result) ;
+        GrB_Index nreach = 0, np = 0, nh = 0 ;
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            double d = 0 ;
+            OK (GrB_Vector_extractElement (&d, path_length, i)) ;
+            TEST_CHECK (d == dist [i]) ;
+            if (hop [i] == INT64_MAX) continue ;
+            nreach++ ;
+
+            // check the hops and the parent
+            int64_t h = -1, p = -1 ;
+            OK (GrB_Vector_extractElement (&h, hops, i)) ;
+            OK (GrB_Vector_extractElement (&p, parent, i)) ;
+            TEST_CHECK (h == hop [i]) ;
+            if (i == src)
+            {
+                TEST_CHECK (p == src) ;
+                continue ;
+            }
+            double w = 0 ;
+            OK (GrB_Matrix_extractElement (&w, G->A, p, i)) ;
+            TEST_CHECK (dist [p] + w == dist [i]) ;
+            TEST_CHECK (hop [p] + 1 == hop [i]) ;
+        }
+        OK (GrB_Vector_nvals (&np, parent)) ;
+        OK (GrB_Vector_nvals (&nh, hops)) ;
+        TEST_CHECK (np == nreach && nh == nreach) ;
+    }
+
+    OK (LAGraph_Free ((void **) &I, msg)) ;
+    OK (LAGraph_Free ((void **) &J, msg)) ;
+    OK (LAGraph_Free ((void **) &X, msg)) ;
+    OK (LAGraph_Free ((void **) &dist, msg)) ;
+    OK (LAGraph_Free ((void **) &hop, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BellmanFord
+//------------------------------------------------------------------------------
+
+void test_BellmanFord (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        // load the matrix as A
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break;
+        printf ("\n%s:\n", aname) ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        GrB_Matrix T = NULL ;
+        OK (LAGraph_MMRead (&T, f, msg)) ;
+        OK (fclose (f)) ;
+        TEST_MSG ("Loading of adjacency matrix failed") ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, T)) ;
+
+        // weights 1 to 16, then -3 to 12, then a few negative ones
+        for (int trial = 0 ; trial < 3 ; trial++)
+        {
+            OK (GrB_Matrix_new (&A, GrB_INT32, n, n)) ;
+            OK (GrB_assign (A, NULL, NULL, T, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+            OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (A, NULL, NULL,
+                GrB_BAND_INT32, A, 15, NULL)) ;
+            int32_t shift = (trial == 0) ? 1 : ((trial == 1) ? -3 : 0) ;
+            OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (A, NULL, NULL,
+                GrB_PLUS_INT32, A, shift, NULL)) ;
+            if (trial == 2)
+            {
+                // all weights positive except for a few negative edges
+                OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (A, NULL, NULL,
+                    GrB_MAX_INT32, A, 1, NULL)) ;
+                OK (GrB_Matrix_setElement (A, -4, n/2, n/3)) ;
+                OK (GrB_Matrix_setElement (A, -2, n-1, 0)) ;
+            }
+
+            // as a directed graph with no G->AT, then with G->AT
+            OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+            for (int with_AT = 0 ; with_AT <= 1 ; with_AT++)
+            {
+                if (with_AT) OK (LAGraph_Cached_AT (G, msg)) ;
+                int64_t step = (n > 100) ? (3*n/4) : ((n/4) + 1) ;
+                for (int64_t src = 0 ; src < n ; src += step)
+                {
+                    int result = LAGr_BellmanFord (&path_length, &parent,
+                        &hops, G, src, msg) ;
+                    printf ("src %d result %d\n", (int) src, result) ;
+                    check_bf (result, src) ;
+                    OK (GrB_free (&path_length)) ;
+                    OK (GrB_free (&parent)) ;
+                    OK (GrB_free (&hops)) ;
+                }
+            }
+
+            // the optional outputs can be NULL
+            int result = LAGr_BellmanFord (&path_length, NULL, NULL, G, 0,
+                msg) ;
+            TEST_CHECK (result == GrB_SUCCESS ||
+                result == LAGRAPH_NEGATIVE_CYCLE) ;
+            OK (GrB_free (&path_length)) ;
+            OK (LAGraph_Delete (&G, msg)) ;
+        }
+        OK (GrB_free (&T)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_BellmanFord_undirected
+//------------------------------------------------------------------------------
+
+void test_BellmanFord_undirected (void)
+{
+    LAGraph_Init (msg) ;
+
+    // an undirected graph with positive weights, where A is its own transpose
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "jagmesh7.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    GrB_Matrix T = NULL ;
+    OK (LAGraph_MMRead (&T, f, msg)) ;
+    OK (fclose (f)) ;
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, T)) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_apply (A, NULL, NULL, GrB_ONEB_FP64, T, 1, NULL)) ;
+    OK (GrB_free (&T)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    int result = LAGr_BellmanFord (&path_length, &parent, &hops, G, 0, msg) ;
+    check_bf (result, 0) ;
+    OK (GrB_free (&path_length)) ;
+    OK (GrB_free (&parent)) ;
+    OK (GrB_free (&hops)) ;
+
+    // any negative edge in an undirected graph is a negative cycle
+    OK (GrB_Matrix_setElement (G->A, -1, 0, 1)) ;
+    OK (GrB_Matrix_setElement (G->A, -1, 1, 0)) ;
+    OK (GrB_Matrix_wait (G->A, GrB_MATERIALIZE)) ;
+    result = LAGr_BellmanFord (&path_length, &parent, &hops, G, 0, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NEGATIVE_CYCLE) ;
+    TEST_CHECK (path_length == NULL && parent == NULL && hops == NULL) ;
+
+    // a negative self edge on the source
+    OK (GrB_Matrix_setElement (G->A, 1, 0, 1)) ;
+    OK (GrB_Matrix_setElement (G->A, 1, 1, 0)) ;
+    OK (GrB_Matrix_setElement (G->A, -1, 0, 0)) ;
+    result = LAGr_BellmanFord (&path_length, NULL, NULL, G, 0, msg) ;
+    TEST_CHECK (result == LAGRAPH_NEGATIVE_CYCLE) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_errors
+//------------------------------------------------------------------------------
+
+void test_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    // path_length is NULL
+    int result = LAGr_BellmanFord (NULL, &parent, &hops, G, 0, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // source is invalid
+    result = LAGr_BellmanFord (&path_length, &parent, &hops, G, 1000, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (path_length == NULL && parent == NULL && hops == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"BellmanFord", test_BellmanFord},
+    {"BellmanFord_undirected", test_BellmanFord_undirected},
+    {"BellmanFord_errors", test_errors},
+    {NULL, NULL}
+};
@@ -112,7 +112,7 @@ void test_cc_matrices (void)
         for (int trial = 0 ; trial <= 1 ; trial++)
         {
             // find the connected components
-            printf ("\n--- CC: FastSV6 if SuiteSparse, Boruvka if vanilla:\n") ;
+            printf ("\n--- CC: Afforest if SuiteSparse, Boruvka if vanilla:\n") ;
             OK (LAGr_ConnectedComponents (&C, G, msg)) ;
             OK (LAGraph_Vector_Print (C, 2, stdout, msg)) ;
 
@@ -128,6 +128,16 @@ void test_cc_matrices (void)
             OK (LG_check_cc (C, G, msg)) ;
             OK (GrB_free (&C)) ;
 
+            // find the connected components with LG_CC_FastSV6
+            #if LAGRAPH_SUITESPARSE
+            printf ("\n------ CC_FastSV6:\n") ;
+            OK (LG_CC_FastSV6 (&C2, G, msg)) ;
+            ncomponents = count_connected_components (C2) ;
+            TEST_CHECK (ncomponents == ncomp) ;
+            OK (LG_check_cc (C2, G, msg)) ;
+            OK (GrB_free (&C2)) ;
+            #endif
+
             // find the connected components with LG_CC_FastSV5
             #if LAGRAPH_SUITESPARSE
             printf ("\n------ CC_FastSV5:\n") ;
@@ -197,6 +207,8 @@ void test_cc_errors (void)
     #if LAGRAPH_SUITESPARSE
     result = LG_CC_FastSV6 (NULL, NULL, msg) ;
     TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LG_CC_Afforest (NULL, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
     #endif
 
     // load a valid matrix
@@ -217,6 +229,14 @@ void test_cc_errors (void)
     result = LG_CC_FastSV6 (&C, G, msg) ;
     TEST_CHECK (result == -1001) ;
     printf ("result expected: %d msg:\n%s\n", result, msg) ;
+    result = LAGr_ConnectedComponents (&C, G, msg) ;
+    TEST_CHECK (result == -1001) ;
+    printf ("result expected: %d msg:\n%s\n", result, msg) ;
+
+    // LG_CC_Afforest finds the weakly connected components of a directed graph
+    OK (LG_CC_Afforest (&C, G, msg)) ;
+    TEST_CHECK (count_connected_components (C) == 6) ;
+    OK (GrB_free (&C)) ;
     #endif
 
     OK (LAGraph_Finalize (msg)) ;
@@ -247,7 +267,7 @@ void test_cc_brutal (void)
     LG_BRUTAL_BURBLE (LAGraph_CheckGraph (G, msg)) ;
 
     // find the connected components
-    printf ("\n--- CC: FastSV6 if SuiteSparse, Boruvka if vanilla:\n") ;
+    printf ("\n--- CC: Afforest if SuiteSparse, Boruvka if vanilla:\n") ;
     LG_BRUTAL_BURBLE (LAGr_ConnectedComponents (&C, G, msg)) ;
     LG_BRUTAL_BURBLE (LAGraph_Vector_Print (C, LAGraph_SHORT, stdout, msg)) ;
 
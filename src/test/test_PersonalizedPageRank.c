@@ -0,0 +1,259 @@
+//------------------------------------------------------------------------------
+// LAGraph/src/test/test_PersonalizedPageRank.c: test batched personalized PR
+// -----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraph_test.h>
+
+#define LEN 512
+char msg [LAGRAPH_MSG_LEN] ;
+char filename [LEN+1] ;
+LAGraph_Graph G = NULL ;
+
+typedef struct
+{
+    LAGraph_Kind kind ;
+    const char *name ;
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    LAGraph_ADJACENCY_UNDIRECTED, "karate.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "west0067.mtx",
+    LAGraph_ADJACENCY_DIRECTED,   "ldbc-directed-example.mtx",  // has sinks
+    LAGraph_ADJACENCY_DIRECTED,   "cover.mtx",                  // has sinks
+    LAGRAPH_UNKNOWN, ""
+} ;
+
+//------------------------------------------------------------------------------
+// difference: max (abs (C (s,:) - r))
+//------------------------------------------------------------------------------
+
+float difference (GrB_Matrix C, GrB_Index s, GrB_Vector r) ;
+
+float difference (GrB_Matrix C, GrB_Index s, GrB_Vector r)
+{
+    GrB_Vector c = NULL ;
+    GrB_Index n = 0 ;
+    OK (GrB_Vector_size (&n, r)) ;
+    // c = C (s,:)
+    OK (GrB_Vector_new (&c, GrB_FP32, n)) ;
+    OK (GrB_Col_extract (c, NULL, NULL, C, GrB_ALL, n, s, GrB_DESC_T0)) ;
+    // c = abs (c - r)
+    OK (GrB_eWiseAdd (c, NULL, NULL, GrB_MINUS_FP32, c, r, NULL)) ;
+    OK (GrB_apply (c, NULL, NULL, GrB_ABS_FP32, c, NULL)) ;
+    float err = 0 ;
+    OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP32, c, NULL)) ;
+    OK (GrB_free (&c)) ;
+    return (err) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PersonalizedPageRank
+//------------------------------------------------------------------------------
+
+void test_PersonalizedPageRank (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL, S = NULL, S1 = NULL, C = NULL, C1 = NULL ;
+    GrB_Vector r = NULL, rsum = NULL ;
+    int niters = 0, niters1 = 0 ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        //----------------------------------------------------------------------
+        // load the graph
+        //----------------------------------------------------------------------
+
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break ;
+        LAGraph_Kind kind = files [k].kind ;
+        TEST_CASE (aname) ;
+        printf ("\n================== Matrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, kind, msg)) ;
+        TEST_CHECK (A == NULL) ;    // A has been moved into G->A
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        //----------------------------------------------------------------------
+        // all nodes in each seed set: same as LAGr_PageRank
+        //----------------------------------------------------------------------
+
+        OK (LAGr_PageRank (&r, &niters, G, 0.85, 1e-5, 100, msg)) ;
+        int nseeds = 3 ;
+        OK (GrB_Matrix_new (&S, GrB_BOOL, nseeds, n)) ;
+        OK (GrB_assign (S, NULL, NULL, (bool) true, GrB_ALL, nseeds,
+            GrB_ALL, n, NULL)) ;
+        OK (LAGr_PersonalizedPageRank (&C, &niters1, G, S, 0.85, 1e-5, 100,
+            msg)) ;
+        printf ("pagerank iters: %d, personalized: %d\n", niters, niters1) ;
+        for (int s = 0 ; s < nseeds ; s++)
+        {
+            float err = difference (C, s, r) ;
+            TEST_CHECK (err < 1e-4) ;
+        }
+        OK (GrB_free (&r)) ;
+        OK (GrB_free (&C)) ;
+        OK (GrB_free (&S)) ;
+
+        //----------------------------------------------------------------------
+        // small seed sets: compare the batch with one seed set at a time
+        //----------------------------------------------------------------------
+
+        nseeds = 8 ;
+        OK (GrB_Matrix_new (&S, GrB_FP64, nseeds, n)) ;
+        for (int s = 0 ; s < nseeds ; s++)
+        {
+            // seed set s has the nodes (s*7) mod n and (s*13+1) mod n
+            OK (GrB_Matrix_setElement_FP64 (S, 1, s, (s*7) % n)) ;
+            OK (GrB_Matrix_setElement_FP64 (S, 2, s, (s*13+1) % n)) ;
+        }
+        OK (LAGr_PersonalizedPageRank (&C, &niters, G, S, 0.85, 1e-5, 100,
+            msg)) ;
+        printf ("personalized pagerank, %d seed sets, iters: %d\n",
+            nseeds, niters) ;
+
+        // each rank vector sums to 1
+        OK (GrB_Vector_new (&rsum, GrB_FP32, nseeds)) ;
+        OK (GrB_reduce (rsum, NULL, NULL, GrB_PLUS_MONOID_FP32, C, NULL)) ;
+        float smin = 0, smax = 0 ;
+        OK (GrB_reduce (&smin, NULL, GrB_MIN_MONOID_FP32, rsum, NULL)) ;
+        OK (GrB_reduce (&smax, NULL, GrB_MAX_MONOID_FP32, rsum, NULL)) ;
+        printf ("sum (r): min %g max %g\n", smin, smax) ;
+        TEST_CHECK (fabs (smin - 1) < 1e-3) ;
+        TEST_CHECK (fabs (smax - 1) < 1e-3) ;
+        OK (GrB_free (&rsum)) ;
+
+        for (int s = 0 ; s < nseeds ; s++)
+        {
+            // C1 = rank for the seed set S (s,:) alone
+            OK (GrB_Matrix_new (&S1, GrB_FP64, 1, n)) ;
+            GrB_Index I [1] ;
+            I [0] = s ;
+            OK (GrB_extract (S1, NULL, NULL, S, I, 1, GrB_ALL, n, NULL)) ;
+            OK (LAGr_PersonalizedPageRank (&C1, &niters1, G, S1, 0.85, 1e-5,
+                100, msg)) ;
+            TEST_CHECK (niters1 <= niters) ;
+            OK (GrB_Vector_new (&r, GrB_FP32, n)) ;
+            OK (GrB_Col_extract (r, NULL, NULL, C1, GrB_ALL, n, 0,
+                GrB_DESC_T0)) ;
+            float err = difference (C, s, r) ;
+            TEST_CHECK (err < 1e-5) ;
+            // the seeds have a rank of at least (1-damping) * v_s(i)
+            float x = 0 ;
+            OK (GrB_Vector_extractElement (&x, r, (s*13+1) % n)) ;
+            TEST_CHECK (x >= 0.15 * (2./3.) - 1e-5) ;
+            OK (GrB_free (&r)) ;
+            OK (GrB_free (&C1)) ;
+            OK (GrB_free (&S1)) ;
+        }
+        OK (GrB_free (&C)) ;
+        OK (GrB_free (&S)) ;
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_PersonalizedPageRank_errors
+//------------------------------------------------------------------------------
+
+void test_PersonalizedPageRank_errors (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL, S = NULL, C = NULL ;
+    int niters = 0 ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+    OK (GrB_Matrix_new (&S, GrB_BOOL, 2, n)) ;
+    OK (GrB_Matrix_setElement_BOOL (S, true, 0, 0)) ;
+    OK (GrB_Matrix_setElement_BOOL (S, true, 1, 1)) ;
+
+    // NULL inputs
+    int result = LAGr_PersonalizedPageRank (NULL, &niters, G, S, 0.85, 1e-4,
+        100, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGr_PersonalizedPageRank (&C, &niters, G, NULL, 0.85, 1e-4,
+        100, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G->AT and G->out_degree are required
+    result = LAGr_PersonalizedPageRank (&C, &niters, G, S, 0.85, 1e-4,
+        100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (C == NULL) ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    result = LAGr_PersonalizedPageRank (&C, &niters, G, S, 0.85, 1e-4,
+        100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    // failure to converge
+    result = LAGr_PersonalizedPageRank (&C, &niters, G, S, 0.85, 1e-4,
+        2, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_CONVERGENCE_FAILURE) ;
+    TEST_CHECK (C == NULL) ;
+
+    // an empty seed set
+    OK (GrB_Matrix_resize (S, 3, n)) ;
+    result = LAGr_PersonalizedPageRank (&C, &niters, G, S, 0.85, 1e-4,
+        100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    // S has the wrong number of columns
+    OK (GrB_Matrix_resize (S, 2, n+1)) ;
+    result = LAGr_PersonalizedPageRank (&C, &niters, G, S, 0.85, 1e-4,
+        100, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+
+    OK (GrB_free (&S)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// list of tests
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"PersonalizedPageRank", test_PersonalizedPageRank},
+    {"PersonalizedPageRank_errors", test_PersonalizedPageRank_errors},
+    {NULL, NULL}
+};
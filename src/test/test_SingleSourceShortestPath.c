@@ -305,6 +305,104 @@ void test_SingleSourceShortestPath_types (void)
     LAGraph_Finalize (msg) ;
 }
 
+//------------------------------------------------------------------------------
+// test_SingleSourceShortestPath_Basic
+//------------------------------------------------------------------------------
+
+void test_SingleSourceShortestPath_Basic (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL, T = NULL ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the adjacency matrix as A
+        const char *aname = files [k].name ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        printf ("\nMatrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        TEST_MSG ("Loading of adjacency matrix failed") ;
+
+        GrB_Index n = 0 ;
+        OK (GrB_Matrix_nrows (&n, A)) ;
+
+        // convert A to int32, with all entries in the range 1 to 255
+        OK (GrB_Matrix_new (&T, GrB_INT32, n, n)) ;
+        OK (GrB_assign (T, NULL, NULL, A, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+        OK (GrB_free (&A)) ;
+        OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (T, NULL, NULL,
+            GrB_BAND_INT32, T, 255, NULL)) ;
+        OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (T, NULL, NULL,
+            GrB_MAX_INT32, T, 1, NULL)) ;
+
+        for (int trial = 0 ; trial <= 1 ; trial++)
+        {
+            if (trial == 0)
+            {
+                // int32 edge weights
+                OK (GrB_Matrix_dup (&A, T)) ;
+            }
+            else
+            {
+                // fp64 edge weights, in the range 0.1 to 25.5
+                OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+                OK (GrB_Matrix_apply_BinaryOp2nd_FP64 (A, NULL, NULL,
+                    GrB_TIMES_FP64, T, 0.1, NULL)) ;
+            }
+
+            // create the graph
+            OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+            OK (LAGraph_CheckGraph (G, msg)) ;
+            TEST_CHECK (G->delta == NULL) ;
+
+            // run the SSSP; G->delta is computed on the first call
+            GrB_Vector path_length = NULL ;
+            GrB_Scalar Delta = NULL ;
+            int64_t step = (n > 100) ? (3*n/4) : ((n/4) + 1) ;
+            for (int64_t src = 0 ; src < n ; src += step)
+            {
+                OK (LAGraph_SingleSourceShortestPath (&path_length, G, src,
+                    msg)) ;
+                TEST_CHECK (G->delta != NULL) ;
+                TEST_CHECK (Delta == NULL || Delta == G->delta) ;
+                Delta = G->delta ;
+                int res = LG_check_sssp (path_length, G, src, msg) ;
+                if (res != GrB_SUCCESS) printf ("res: %d msg: %s\n", res, msg) ;
+                OK (res) ;
+                OK (GrB_free (&path_length)) ;
+            }
+
+            // Delta must be positive
+            double delta = 0 ;
+            OK (GrB_Scalar_extractElement_FP64 (&delta, G->delta)) ;
+            printf ("delta: %g\n", delta) ;
+            TEST_CHECK (delta > 0) ;
+
+            OK (LAGraph_Delete (&G, msg)) ;
+        }
+        OK (GrB_free (&T)) ;
+    }
+
+    // the type of G->A must be supported
+    OK (GrB_Matrix_new (&A, GrB_BOOL, 4, 4)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    GrB_Vector path_length = NULL ;
+    int result = LAGraph_SingleSourceShortestPath (&path_length, G, 0, msg) ;
+    printf ("\nres: %d msg: %s\n", result, msg) ;
+    TEST_CHECK (path_length == NULL) ;
+    TEST_CHECK (result == GrB_NOT_IMPLEMENTED) ;
+    TEST_CHECK (G->delta == NULL) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    LAGraph_Finalize (msg) ;
+}
+
 //------------------------------------------------------------------------------
 // test_SingleSourceShortestPath_failure
 //------------------------------------------------------------------------------
@@ -448,6 +546,7 @@ void test_SingleSourceShortestPath_brutal (void)
 TEST_LIST = {
     {"SSSP", test_SingleSourceShortestPath},
     {"SSSP_types", test_SingleSourceShortestPath_types},
+    {"SSSP_Basic", test_SingleSourceShortestPath_Basic},
     {"SSSP_failure", test_SingleSourceShortestPath_failure},
     #if LAGRAPH_SUITESPARSE
     {"SSSP_brutal", test_SingleSourceShortestPath_brutal },
@@ -327,7 +327,7 @@ void test_TriangleCount_many (void)
         TEST_CHECK (nt0 == nt1) ;
 
         // try each method
-        for (int method = 0 ; method <= 6 ; method++)
+        for (int method = 0 ; method <= 7 ; method++)
         {
             for (int presort = 0 ; presort <= 2 ; presort++)
             {
@@ -335,9 +335,26 @@ void test_TriangleCount_many (void)
                 LAGr_TriangleCount_Method m = method ;
                 OK (LAGr_TriangleCount (&nt1, G, &m, &s, msg)) ;
                 TEST_CHECK (nt1 == ntriangles) ;
+                TEST_CHECK (m != LAGr_TriangleCount_AutoMethod) ;
+                TEST_CHECK (s != LAGr_TriangleCount_AutoSort) ;
             }
         }
 
+        // the auto method is chosen by the cost model
+        LAGr_TriangleCount_Presort s = LAGr_TriangleCount_AutoSort ;
+        LAGr_TriangleCount_Method m = LAGr_TriangleCount_AutoMethod ;
+        OK (LAGr_TriangleCount (&nt1, G, &m, &s, msg)) ;
+        TEST_CHECK (nt1 == ntriangles) ;
+        TEST_CHECK (m == LAGr_TriangleCount_Sandia_LL ||
+                    m == LAGr_TriangleCount_Sandia_LUT) ;
+        s = LAGr_TriangleCount_Descending ;
+        m = LAGr_TriangleCount_AutoMethod ;
+        OK (LAGr_TriangleCount (&nt1, G, &m, &s, msg)) ;
+        TEST_CHECK (nt1 == ntriangles) ;
+        TEST_CHECK (m == LAGr_TriangleCount_Sandia_UU ||
+                    m == LAGr_TriangleCount_Sandia_ULT) ;
+        TEST_CHECK (s == LAGr_TriangleCount_Descending) ;
+
         // invalid method
         LAGr_TriangleCount_Method method = 99 ;
         int result = LAGr_TriangleCount (&nt1, G, &method, NULL, msg) ;
@@ -383,7 +400,7 @@ void test_TriangleCount_autosort (void)
 
     // try each method; with autosort
     GrB_Index nt1 = 0 ;
-    for (int method = 0 ; method <= 6 ; method++)
+    for (int method = 0 ; method <= 7 ; method++)
     {
         LAGr_TriangleCount_Presort presort = LAGr_TriangleCount_AutoSort ;
         LAGr_TriangleCount_Method m = method ;
@@ -392,6 +409,16 @@ void test_TriangleCount_autosort (void)
         TEST_CHECK (nt1 == 2749560) ;
     }
 
+    // the auto method chooses the method and the presort together
+    LAGr_TriangleCount_Presort presort = LAGr_TriangleCount_AutoSort ;
+    LAGr_TriangleCount_Method m = LAGr_TriangleCount_AutoMethod ;
+    nt1 = 0 ;
+    OK (LAGr_TriangleCount (&nt1, G, &m, &presort, msg)) ;
+    TEST_CHECK (nt1 == 2749560) ;
+    TEST_CHECK (m == LAGr_TriangleCount_Sandia_LL ||
+                m == LAGr_TriangleCount_Sandia_LUT) ;
+    TEST_CHECK (presort != LAGr_TriangleCount_AutoSort) ;
+
     nt1 = 0 ;
     OK (LAGraph_TriangleCount (&nt1, G, msg)) ;
     TEST_CHECK (nt1 == 2749560) ;
@@ -452,7 +479,7 @@ void test_TriangleCount_brutal (void)
         TEST_CHECK (nt0 == nt1) ;
 
         // try each method
-        for (int method = 0 ; method <= 6 ; method++)
+        for (int method = 0 ; method <= 7 ; method++)
         {
             for (int presort = 0 ; presort <= 2 ; presort++)
             {
@@ -0,0 +1,209 @@
+//----------------------------------------------------------------------------
+// LAGraph/src/test/test_TriangleCount_PerEdge.c: test per-vertex and per-edge
+// triangle counts
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+typedef struct
+{
+    uint64_t ntriangles ;           // # triangles in original matrix
+    const char *name ;              // matrix filename
+}
+matrix_info ;
+
+const matrix_info files [ ] =
+{
+    {     45, "karate.mtx" },
+    {     11, "A.mtx" },
+    {   2016, "jagmesh7.mtx" },
+    {      6, "ldbc-cdlp-undirected-example.mtx" },
+    {      4, "ldbc-undirected-example.mtx" },
+    {      0, "LFAT5.mtx" },
+    { 342300, "bcsstk13.mtx" },
+    {      0, "tree-example.mtx" },
+    {      0, "" },
+} ;
+
+//------------------------------------------------------------------------------
+// test_TriangleCount_PerEdge
+//------------------------------------------------------------------------------
+
+void test_TriangleCount_PerEdge (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL, S = NULL, S0 = NULL ;
+    GrB_Vector t = NULL, t0 = NULL ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the adjacency matrix as A
+        const char *aname = files [k].name ;
+        uint64_t ntriangles = files [k].ntriangles ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\n================== Matrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+
+        // create the graph
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        OK (LAGraph_DeleteSelfEdges (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+        // S0 and t0: the Burkhardt method, with no presort
+        LAGr_TriangleCount_Method m = LAGr_TriangleCount_Burkhardt ;
+        LAGr_TriangleCount_Presort s = LAGr_TriangleCount_NoSort ;
+        OK (LAGr_TriangleCount_PerEdge (&S0, G, &m, &s, msg)) ;
+        m = LAGr_TriangleCount_Burkhardt ;
+        s = LAGr_TriangleCount_NoSort ;
+        OK (LAGr_TriangleCount_PerVertex (&t0, G, &m, &s, msg)) ;
+
+        // sum (S0) is 6*ntriangles, and sum (t0) is 3*ntriangles
+        int64_t ssum = 0, tsum = 0 ;
+        OK (GrB_reduce (&ssum, NULL, GrB_PLUS_MONOID_INT64, S0, NULL)) ;
+        OK (GrB_reduce (&tsum, NULL, GrB_PLUS_MONOID_INT64, t0, NULL)) ;
+        printf ("# triangles: %g, sum (S): %g, sum (t): %g\n",
+            (double) ntriangles, (double) ssum, (double) tsum) ;
+        TEST_CHECK (ssum == 6 * ntriangles) ;
+        TEST_CHECK (tsum == 3 * ntriangles) ;
+
+        // S0 is symmetric
+        bool ok = false ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        OK (GrB_Matrix_new (&S, GrB_INT64, n, n)) ;
+        OK (GrB_transpose (S, NULL, NULL, S0, NULL)) ;
+        OK (LAGraph_Matrix_IsEqual (&ok, S, S0, msg)) ;
+        TEST_CHECK (ok) ;
+        OK (GrB_free (&S)) ;
+
+        if (k == 0)
+        {
+            // node 0 of the karate graph is in 18 triangles
+            int64_t t_0 = 0 ;
+            OK (GrB_Vector_extractElement (&t_0, t0, 0)) ;
+            TEST_CHECK (t_0 == 18) ;
+        }
+
+        // try each method and presort
+        for (int method = 0 ; method <= 7 ; method++)
+        {
+            for (int presort = -1 ; presort <= 2 ; presort++)
+            {
+                m = method ;
+                s = presort ;
+                OK (LAGr_TriangleCount_PerEdge (&S, G, &m, &s, msg)) ;
+                OK (LAGraph_Matrix_IsEqual (&ok, S, S0, msg)) ;
+                TEST_CHECK (ok) ;
+                m = method ;
+                s = presort ;
+                OK (LAGr_TriangleCount_PerVertex (&t, G, &m, &s, msg)) ;
+                OK (LAGraph_Vector_IsEqual (&ok, t, t0, msg)) ;
+                TEST_CHECK (ok) ;
+                TEST_CHECK (m != LAGr_TriangleCount_AutoMethod) ;
+                TEST_CHECK (s != LAGr_TriangleCount_AutoSort) ;
+                OK (GrB_free (&S)) ;
+                OK (GrB_free (&t)) ;
+            }
+        }
+
+        OK (GrB_free (&S0)) ;
+        OK (GrB_free (&t0)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_TriangleCount_PerEdge_errors
+//------------------------------------------------------------------------------
+
+void test_TriangleCount_PerEdge_errors (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL, S = NULL ;
+    GrB_Vector t = NULL ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    int result = LAGr_TriangleCount_PerEdge (NULL, G, NULL, NULL, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGr_TriangleCount_PerVertex (NULL, G, NULL, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G->nself_edges is required
+    result = LAGr_TriangleCount_PerEdge (&S, G, NULL, NULL, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NO_SELF_EDGES_ALLOWED) ;
+    TEST_CHECK (S == NULL) ;
+    OK (LAGraph_Cached_NSelfEdges (G, msg)) ;
+
+    // G->out_degree is required for the auto presort
+    result = LAGr_TriangleCount_PerVertex (&t, G, NULL, NULL, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NOT_CACHED) ;
+    TEST_CHECK (t == NULL) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+    // invalid method and presort
+    LAGr_TriangleCount_Method method = 99 ;
+    result = LAGr_TriangleCount_PerEdge (&S, G, &method, NULL, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    LAGr_TriangleCount_Presort presort = 99 ;
+    result = LAGr_TriangleCount_PerVertex (&t, G, NULL, &presort, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
+    // the graph must have a symmetric structure
+    G->kind = LAGraph_ADJACENCY_DIRECTED ;
+    G->is_symmetric_structure = LAGRAPH_UNKNOWN ;
+    result = LAGr_TriangleCount_PerEdge (&S, G, NULL, NULL, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// list of tests
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"TriangleCount_PerEdge", test_TriangleCount_PerEdge},
+    {"TriangleCount_PerEdge_errors", test_TriangleCount_PerEdge_errors},
+    {NULL, NULL}
+};
@@ -0,0 +1,218 @@
+//------------------------------------------------------------------------------
+// LAGraph/src/test/test_WeaklyConnectedComponents.c: test weakly CC
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2019-2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// For additional details (including references to third party source code and
+// other files) see the LICENSE file or contact permission@sei.cmu.edu. See
+// Contributors.txt for a full list of contributors. Created, in part, with
+// funding and support from the U.S. Government (see Acknowledgments.txt file).
+// DM22-0790
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include "LAGraph_test.h"
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL, S = NULL ;
+GrB_Matrix A = NULL, A2 = NULL ;
+GrB_Vector W = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "cover.mtx",
+    "ldbc-directed-example.mtx",
+    "ldbc-cdlp-directed-example.mtx",
+    "msf1.mtx",
+    "sample.mtx",
+    "west0067.mtx",
+    "olm1000.mtx",
+    "cryg2500.mtx",
+    "karate.mtx",
+    "LFAT5_two.mtx",
+    "",
+} ;
+
+//------------------------------------------------------------------------------
+// check_wcc: check the weakly CC of G against the CC of A+A'
+//------------------------------------------------------------------------------
+
+void check_wcc (void)
+{
+    GrB_Index n, nvals1, nvals2 ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+    OK (GrB_Matrix_nvals (&nvals1, G->A)) ;
+
+    // S = the undirected graph A+A'
+    OK (GrB_Matrix_new (&A2, GrB_BOOL, n, n)) ;
+    OK (GrB_eWiseAdd (A2, NULL, NULL, GrB_ONEB_BOOL, G->A, G->A,
+        GrB_DESC_T1)) ;
+    OK (LAGraph_New (&S, &A2, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    // W = weakly connected components of G, without and with G->AT
+    for (int trial = 0 ; trial <= 1 ; trial++)
+    {
+        if (trial == 1 && G->kind == LAGraph_ADJACENCY_DIRECTED)
+        {
+            OK (LAGraph_Cached_AT (G, msg)) ;
+        }
+        OK (LAGr_WeaklyConnectedComponents (&W, G, msg)) ;
+        OK (LG_check_cc (W, S, msg)) ;
+
+        // W(i) is the smallest node in the component of node i, so it is no
+        // larger than i, and is its own representative
+        for (GrB_Index i = 0 ; i < n ; i++)
+        {
+            uint64_t wi = n, wwi = n ;
+            OK (GrB_Vector_extractElement (&wi, W, i)) ;
+            OK (GrB_Vector_extractElement (&wwi, W, wi)) ;
+            TEST_CHECK (wi <= i && wwi == wi) ;
+        }
+        OK (GrB_free (&W)) ;
+
+        // G->A is unchanged
+        OK (GrB_Matrix_nvals (&nvals2, G->A)) ;
+        TEST_CHECK (nvals1 == nvals2) ;
+    }
+
+    OK (LAGraph_Delete (&S, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_WeaklyConnectedComponents
+//------------------------------------------------------------------------------
+
+void test_WeaklyConnectedComponents (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        // load the adjacency matrix as A
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        printf ("\n================== Matrix: %s\n", aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+
+        // construct a directed graph G with adjacency matrix A
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        check_wcc ( ) ;
+
+        // also try it as an undirected graph, if A is symmetric
+        OK (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+        if (G->is_symmetric_structure == LAGraph_TRUE)
+        {
+            G->kind = LAGraph_ADJACENCY_UNDIRECTED ;
+            OK (GrB_free (&(G->AT))) ;
+            check_wcc ( ) ;
+        }
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_WeaklyConnectedComponents_oneway
+//------------------------------------------------------------------------------
+
+// A large component, with one node that has only out-edges to many other
+// nodes, which are each reached by no other edge.  These edges are found only
+// from their source node, which is in the largest component.
+
+void test_WeaklyConnectedComponents_oneway (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    GrB_Index n = 2000 ;
+    OK (GrB_Matrix_new (&A, GrB_BOOL, n, n)) ;
+    // nodes 0 to 999: a path
+    for (GrB_Index i = 0 ; i < 999 ; i++)
+    {
+        OK (GrB_Matrix_setElement (A, true, i, i+1)) ;
+    }
+    // node 5 has out-edges to nodes 1000 to 1099
+    for (GrB_Index j = 1000 ; j < 1100 ; j++)
+    {
+        OK (GrB_Matrix_setElement (A, true, 5, j)) ;
+    }
+    // nodes 1100 to 1999: pairs of nodes
+    for (GrB_Index i = 1100 ; i < n ; i += 2)
+    {
+        OK (GrB_Matrix_setElement (A, true, i+1, i)) ;
+    }
+    OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    check_wcc ( ) ;
+
+    // all of nodes 0 to 1099 are in component 0
+    OK (LAGr_WeaklyConnectedComponents (&W, G, msg)) ;
+    int64_t c = -1 ;
+    OK (GrB_Vector_extractElement (&c, W, 1099)) ;
+    TEST_CHECK (c == 0) ;
+    OK (GrB_Vector_extractElement (&c, W, 1101)) ;
+    TEST_CHECK (c == 1100) ;
+    OK (GrB_free (&W)) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_WeaklyConnectedComponents_errors
+//------------------------------------------------------------------------------
+
+void test_WeaklyConnectedComponents_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "cover.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+    int result = LAGr_WeaklyConnectedComponents (NULL, G, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    result = LAGr_WeaklyConnectedComponents (&W, NULL, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    TEST_CHECK (W == NULL) ;
+
+    // LAGr_ConnectedComponents requires a symmetric structure
+    result = LAGr_ConnectedComponents (&W, G, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// list of tests
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"WeaklyConnectedComponents", test_WeaklyConnectedComponents},
+    {"WeaklyConnectedComponents_oneway",
+        test_WeaklyConnectedComponents_oneway},
+    {"WeaklyConnectedComponents_errors",
+        test_WeaklyConnectedComponents_errors},
+    {NULL, NULL}
+};
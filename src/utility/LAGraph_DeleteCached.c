@@ -45,6 +45,7 @@ int LAGraph_DeleteCached
     GRB_TRY (GrB_free (&(G->in_degree))) ;
     GRB_TRY (GrB_free (&(G->emin))) ;
     GRB_TRY (GrB_free (&(G->emax))) ;
+    GRB_TRY (GrB_free (&(G->delta))) ;
 
     //--------------------------------------------------------------------------
     // clear the cached scalar properties of the graph
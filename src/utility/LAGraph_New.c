@@ -68,6 +68,7 @@ int LAGraph_New
     (*G)->emin_state = LAGRAPH_UNKNOWN ;
     (*G)->emax = NULL ;
     (*G)->emax_state = LAGRAPH_UNKNOWN ;
+    (*G)->delta = NULL ;
 
     //--------------------------------------------------------------------------
     // assign its primary components
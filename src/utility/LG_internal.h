@@ -392,6 +392,80 @@ static inline void LG_eslice
     Slice [ntasks] = e ;
 }
 
+//------------------------------------------------------------------------------
+// LG_CAS: atomic compare-and-swap
+//------------------------------------------------------------------------------
+
+// If (*p) is equal to old, set (*p) to new and return true; otherwise return
+// false.  p must point to an int64_t.
+
+#if defined ( _MSC_VER ) && !defined ( __INTEL_COMPILER )
+    #include <intrin.h>
+    #define LG_CAS(p,old,new)                                               \
+        (_InterlockedCompareExchange64 ((volatile __int64 *) (p),           \
+            (__int64) (new), (__int64) (old)) == (__int64) (old))
+#else
+    #define LG_CAS(p,old,new)                                               \
+        __sync_bool_compare_and_swap ((p), (old), (new))
+#endif
+
+//------------------------------------------------------------------------------
+// LG_union_link: link the trees of nodes u and v in a union-find forest
+//------------------------------------------------------------------------------
+
+// Parent [i] is the parent of node i, or i itself if i is a root.  The root
+// with the larger index is always hooked onto the root with the smaller index,
+// with LG_CAS, so many threads can link trees at the same time without locks,
+// and the root of each tree is its smallest node.
+
+static inline void LG_union_link
+(
+    int64_t *Parent,
+    int64_t u,
+    int64_t v
+)
+{
+    int64_t p1 = Parent [u] ;
+    int64_t p2 = Parent [v] ;
+    while (p1 != p2)
+    {
+        int64_t high = LAGRAPH_MAX (p1, p2) ;
+        int64_t low  = LAGRAPH_MIN (p1, p2) ;
+        int64_t p_high = Parent [high] ;
+        // done if high has already been linked to low
+        if (p_high == low) break ;
+        // if high is a root, try to hook it onto low
+        if (p_high == high && LG_CAS (&Parent [high], high, low)) break ;
+        // otherwise, move up the trees and try again
+        p1 = Parent [Parent [high]] ;
+        p2 = Parent [low] ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// LG_union_compress: make each node of a union-find forest point to its root
+//------------------------------------------------------------------------------
+
+// This must not be done at the same time as any LG_union_link.
+
+static inline void LG_union_compress
+(
+    int64_t *Parent,
+    int64_t n,
+    int nthreads
+)
+{
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,16384)
+    for (i = 0 ; i < n ; i++)
+    {
+        while (Parent [i] != Parent [Parent [i]])
+        {
+            Parent [i] = Parent [Parent [i]] ;
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 // definitions for sorting functions
 //------------------------------------------------------------------------------
@@ -614,6 +688,33 @@ int LG_KindName
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LG_PageRank: the pagerank iteration shared by all LAGr_PageRank* methods
+//------------------------------------------------------------------------------
+
+// LG_PageRank is the method of LAGr_PageRank, with an optional initial rank
+// vector r0 (see LAGr_PageRankWarmStart) and a choice of precision (see
+// LAGr_PageRankPrecision).  type is the type of the rank vectors and of the
+// product AT*w (GrB_FP32 or GrB_FP64), and if sum_fp64 is true, the sums of
+// the rank of the sinks and of abs (t-r) are done in double precision.
+
+LAGRAPH_PUBLIC
+int LG_PageRank
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    const GrB_Vector r0,    // initial rank vector, or NULL for r = 1/n
+    GrB_Type type,          // GrB_FP32 or GrB_FP64
+    bool sum_fp64,          // if true, sums are done in double precision
+    double damping,         // damping factor (typically 0.85)
+    double tol,             // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 
 // # of entries to print for LAGraph_Matrix_Print and LAGraph_Vector_Print